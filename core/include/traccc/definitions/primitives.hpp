@@ -21,6 +21,13 @@
 
 #include <Eigen/Core>
 
+// The scalar type of the numerically sensitive calculations of the track
+// parameter estimation and of the track fitting. Set up by the build system
+// through the TRACCC_FITTING_SCALARTYPE CMake variable.
+#ifndef TRACCC_CUSTOM_FITTING_SCALARTYPE
+#define TRACCC_CUSTOM_FITTING_SCALARTYPE double
+#endif
+
 namespace traccc {
 
 using geometry_id = uint64_t;
@@ -35,4 +42,19 @@ using vector3 = __plugin::point3<traccc::scalar>;
 using variance3 = __plugin::point3<traccc::scalar>;
 using transform3 = __plugin::transform3<traccc::scalar>;
 
+/// Scalar type used in the calculations of the track parameter estimation
+/// and of the track fitting
+///
+/// Clusterization, spacepoint formation and seeding use @c traccc::scalar
+/// throughout. The parameter estimation and the Kalman filter convert their
+/// inputs to this type, and their results back to @c traccc::scalar, which
+/// the event data model uses for storage.
+///
+using fitting_scalar = TRACCC_CUSTOM_FITTING_SCALARTYPE;
+
+using fitting_vector2 = __plugin::point2<traccc::fitting_scalar>;
+using fitting_point3 = __plugin::point3<traccc::fitting_scalar>;
+using fitting_vector3 = __plugin::point3<traccc::fitting_scalar>;
+using fitting_transform3 = __plugin::transform3<traccc::fitting_scalar>;
+
 }  // namespace traccc
@@ -31,3 +31,19 @@
 #else
 #define TRACCC_ALIGN(x) alignas(x)
 #endif
+
+// Ask the compiler to vectorize the loop that follows, asserting that its
+// iterations are independent. This does not need OpenMP to be enabled.
+#if defined(__CUDACC__)
+#define TRACCC_PRAGMA_SIMD
+#elif defined(_OPENMP)
+#define TRACCC_PRAGMA_SIMD _Pragma("omp simd")
+#elif defined(__clang__)
+#define TRACCC_PRAGMA_SIMD _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+#define TRACCC_PRAGMA_SIMD _Pragma("GCC ivdep")
+#elif defined(_MSC_VER)
+#define TRACCC_PRAGMA_SIMD __pragma(loop(ivdep))
+#else
+#define TRACCC_PRAGMA_SIMD
+#endif
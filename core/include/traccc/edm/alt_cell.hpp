@@ -8,6 +8,7 @@
 #pragma once
 
 // traccc include(s).
+#include "traccc/definitions/qualifiers.hpp"
 #include "traccc/edm/cell.hpp"
 #include "traccc/edm/container.hpp"
 
@@ -28,6 +29,39 @@ struct alt_cell {
 /// Declare all cell collection types
 using alt_cell_collection_types = collection_types<alt_cell>;
 
+/// @name Member access used by the clusterization functions
+/// @{
+
+/// @return The first channel identifier of cell @c i
+TRACCC_HOST_DEVICE
+inline channel_id get_channel0(
+    const alt_cell_collection_types::const_device& cells, unsigned int i) {
+    return cells[i].c.channel0;
+}
+
+/// @return The second channel identifier of cell @c i
+TRACCC_HOST_DEVICE
+inline channel_id get_channel1(
+    const alt_cell_collection_types::const_device& cells, unsigned int i) {
+    return cells[i].c.channel1;
+}
+
+/// @return The module link of cell @c i
+TRACCC_HOST_DEVICE
+inline alt_cell::link_type get_module_link(
+    const alt_cell_collection_types::const_device& cells, unsigned int i) {
+    return cells[i].module_link;
+}
+
+/// @return Cell @c i, without its module link
+TRACCC_HOST_DEVICE
+inline cell get_cell(const alt_cell_collection_types::const_device& cells,
+                     unsigned int i) {
+    return cells[i].c;
+}
+
+/// @}
+
 /// Type definition for the reading of cells into a vector of alt_cells and a
 /// vector of modules. The alt_cells hold a link to a position in the modules'
 /// vector.
@@ -0,0 +1,248 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// traccc include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/alt_cell.hpp"
+#include "traccc/edm/cell.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/containers/data/vector_view.hpp>
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+namespace traccc {
+
+/// Collection of alternative cells, with the members of the cells held in
+/// separate arrays
+///
+/// The adjacency search of the clusterization only needs the channel
+/// identifiers and the module links of the cells. With this layout it does
+/// not need to load the activation and time of every cell it looks at.
+///
+/// @tparam vector_t The (host/device/view/buffer) type of one array
+///
+template <template <typename> class vector_t>
+struct alt_cell_soa {
+
+    /// Default constructor
+    alt_cell_soa() = default;
+
+    /// Constructor from the individual arrays
+    TRACCC_HOST_DEVICE
+    alt_cell_soa(vector_t<channel_id> c0, vector_t<channel_id> c1,
+                 vector_t<scalar> act, vector_t<scalar> t,
+                 vector_t<alt_cell::link_type> links)
+        : channel0(c0),
+          channel1(c1),
+          activation(act),
+          time(t),
+          module_link(links) {}
+
+    /// Constructor from a collection with different array types
+    ///
+    /// Used to create views from buffers, and device collections from views.
+    ///
+    template <template <typename> class other_vector_t>
+    TRACCC_HOST_DEVICE alt_cell_soa(const alt_cell_soa<other_vector_t>& other)
+        : channel0(other.channel0),
+          channel1(other.channel1),
+          activation(other.activation),
+          time(other.time),
+          module_link(other.module_link) {}
+
+    /// Constructor of an empty host collection
+    explicit alt_cell_soa(vecmem::memory_resource* mr)
+        : channel0(mr),
+          channel1(mr),
+          activation(mr),
+          time(mr),
+          module_link(mr) {}
+
+    /// Constructor of a buffer with a given size
+    alt_cell_soa(unsigned int size, vecmem::memory_resource& mr)
+        : channel0(size, mr),
+          channel1(size, mr),
+          activation(size, mr),
+          time(size, mr),
+          module_link(size, mr) {}
+
+    /// @return The number of cells in the collection
+    TRACCC_HOST_DEVICE
+    unsigned int size() const {
+        return static_cast<unsigned int>(channel0.size());
+    }
+
+    /// Reserve memory for a given number of cells (host only)
+    void reserve(std::size_t size) {
+        channel0.reserve(size);
+        channel1.reserve(size);
+        activation.reserve(size);
+        time.reserve(size);
+        module_link.reserve(size);
+    }
+
+    /// Add a cell to the end of the collection (host only)
+    void push_back(const alt_cell& c) {
+        channel0.push_back(c.c.channel0);
+        channel1.push_back(c.c.channel1);
+        activation.push_back(c.c.activation);
+        time.push_back(c.c.time);
+        module_link.push_back(c.module_link);
+    }
+
+    /// @return The cell at a given index, put back together
+    TRACCC_HOST_DEVICE
+    alt_cell get(unsigned int i) const {
+        return {{channel0[i], channel1[i], activation[i], time[i]},
+                module_link[i]};
+    }
+
+    /// The first channel identifiers of the cells
+    vector_t<channel_id> channel0;
+    /// The second channel identifiers of the cells
+    vector_t<channel_id> channel1;
+    /// The activations of the cells
+    vector_t<scalar> activation;
+    /// The time stamps of the cells
+    vector_t<scalar> time;
+    /// The links of the cells to their modules
+    vector_t<alt_cell::link_type> module_link;
+
+};  // struct alt_cell_soa
+
+namespace details {
+
+/// Constant device vector, as a template with a single parameter
+template <typename T>
+using const_device_vector = vecmem::device_vector<const T>;
+
+/// Constant vector view, as a template with a single parameter
+template <typename T>
+using const_vector_view = vecmem::data::vector_view<const T>;
+
+}  // namespace details
+
+/// Declare all structure-of-arrays alt_cell collection types
+struct alt_cell_soa_types {
+
+    /// Host collection
+    using host = alt_cell_soa<vecmem::vector>;
+    /// Non-const device collection
+    using device = alt_cell_soa<vecmem::device_vector>;
+    /// Constant device collection
+    using const_device = alt_cell_soa<details::const_device_vector>;
+
+    /// Non-constant view of a collection
+    using view = alt_cell_soa<vecmem::data::vector_view>;
+    /// Constant view of a collection
+    using const_view = alt_cell_soa<details::const_vector_view>;
+
+    /// Buffer for a collection
+    using buffer = alt_cell_soa<vecmem::data::vector_buffer>;
+
+};  // struct alt_cell_soa_types
+
+/// Type definition for the reading of cells into structure-of-arrays
+/// alt_cells and a vector of modules
+struct alt_cell_soa_reader_output_t {
+    alt_cell_soa_types::host cells;
+    cell_module_collection_types::host modules;
+};
+
+/// Get a view of a host collection
+inline alt_cell_soa_types::view get_data(alt_cell_soa_types::host& cells) {
+
+    return {vecmem::get_data(cells.channel0), vecmem::get_data(cells.channel1),
+            vecmem::get_data(cells.activation), vecmem::get_data(cells.time),
+            vecmem::get_data(cells.module_link)};
+}
+
+/// Get a constant view of a host collection
+inline alt_cell_soa_types::const_view get_data(
+    const alt_cell_soa_types::host& cells) {
+
+    return {vecmem::get_data(cells.channel0), vecmem::get_data(cells.channel1),
+            vecmem::get_data(cells.activation), vecmem::get_data(cells.time),
+            vecmem::get_data(cells.module_link)};
+}
+
+/// Copy the contents of one collection into another one
+///
+/// @param copy The copy object to use
+/// @param from The collection to copy from
+/// @param to The collection to copy into (with the right size)
+///
+inline void copy_alt_cells(vecmem::copy& copy,
+                           const alt_cell_soa_types::const_view& from,
+                           const alt_cell_soa_types::view& to) {
+
+    copy(from.channel0, to.channel0);
+    copy(from.channel1, to.channel1);
+    copy(from.activation, to.activation);
+    copy(from.time, to.time);
+    copy(from.module_link, to.module_link);
+}
+
+/// Convert an array-of-structures alt_cell collection
+///
+/// @param cells The cells to convert
+/// @param mr The memory resource to create the result with
+/// @return The same cells, with their members in separate arrays
+///
+inline alt_cell_soa_types::host make_alt_cell_soa(
+    const alt_cell_collection_types::host& cells,
+    vecmem::memory_resource* mr = nullptr) {
+
+    alt_cell_soa_types::host result{mr};
+    result.reserve(cells.size());
+    for (const alt_cell& c : cells) {
+        result.push_back(c);
+    }
+    return result;
+}
+
+/// @name Member access used by the clusterization functions
+/// @{
+
+/// @return The first channel identifier of cell @c i
+TRACCC_HOST_DEVICE
+inline channel_id get_channel0(const alt_cell_soa_types::const_device& cells,
+                               unsigned int i) {
+    return cells.channel0[i];
+}
+
+/// @return The second channel identifier of cell @c i
+TRACCC_HOST_DEVICE
+inline channel_id get_channel1(const alt_cell_soa_types::const_device& cells,
+                               unsigned int i) {
+    return cells.channel1[i];
+}
+
+/// @return The module link of cell @c i
+TRACCC_HOST_DEVICE
+inline alt_cell::link_type get_module_link(
+    const alt_cell_soa_types::const_device& cells, unsigned int i) {
+    return cells.module_link[i];
+}
+
+/// @return Cell @c i, without its module link
+TRACCC_HOST_DEVICE
+inline cell get_cell(const alt_cell_soa_types::const_device& cells,
+                     unsigned int i) {
+    return {cells.channel0[i], cells.channel1[i], cells.activation[i],
+            cells.time[i]};
+}
+
+/// @}
+
+}  // namespace traccc
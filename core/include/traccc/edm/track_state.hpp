@@ -158,6 +158,31 @@ struct track_state {
     bound_track_parameters_type m_smoothed;
 };
 
+/// Compact fitting result per measurement
+///
+/// Holds only the smoothed track parameters (which know their surface) and
+/// their chi square, for fits that do not need the intermediate results of
+/// the Kalman filter.
+template <typename algebra_t>
+struct fitted_track_state {
+
+    using bound_track_parameters_type =
+        detray::bound_track_parameters<algebra_t>;
+    using scalar_type = typename algebra_t::scalar_type;
+
+    fitted_track_state() = default;
+
+    /// Construction from a full track state
+    TRACCC_HOST_DEVICE
+    fitted_track_state(const track_state<algebra_t>& state)
+        : smoothed(state.smoothed()), smoothed_chi2(state.smoothed_chi2()) {}
+
+    /// The smoothed track parameters
+    bound_track_parameters_type smoothed;
+    /// Chi square of the smoothed track parameters
+    scalar_type smoothed_chi2;
+};
+
 /// Declare all track_state collection types
 using track_state_collection_types = collection_types<track_state<transform3>>;
 
@@ -165,4 +190,12 @@ using track_state_collection_types = collection_types<track_state<transform3>>;
 using track_state_container_types =
     container_types<fitter_info<transform3>, track_state<transform3>>;
 
+/// Declare all fitted_track_state collection types
+using fitted_track_state_collection_types =
+    collection_types<fitted_track_state<transform3>>;
+
+/// Declare all fitted_track_state container types
+using fitted_track_state_container_types =
+    container_types<fitter_info<transform3>, fitted_track_state<transform3>>;
+
 }  // namespace traccc
\ No newline at end of file
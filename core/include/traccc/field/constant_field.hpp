@@ -0,0 +1,57 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+
+// Acts include(s).
+#include <Acts/Definitions/Units.hpp>
+
+namespace traccc {
+
+/// Magnetic field with the same value everywhere
+///
+/// Field providers return the field in native units, at a global position
+/// given in millimeters. Every provider declares whether it is constant, and
+/// the type of the cache that it can re-use between consecutive lookups.
+///
+class constant_field {
+
+    public:
+    /// The field does not depend on the position
+    static constexpr bool is_constant = true;
+
+    /// Nothing needs to be cached between lookups
+    struct cache_type {};
+
+    /// The default field strength along the z axis
+    static constexpr scalar default_bz =
+        static_cast<scalar>(2. * Acts::UnitConstants::T);
+
+    /// Constructor with the field value (2 T along the z axis by default)
+    TRACCC_HOST_DEVICE
+    constant_field(const vector3& value = {0.f, 0.f, default_bz})
+        : m_value(value) {}
+
+    /// @return The field at a given position
+    TRACCC_HOST_DEVICE
+    vector3 at(scalar, scalar, scalar) const { return m_value; }
+
+    /// @return The field at a given position
+    TRACCC_HOST_DEVICE
+    vector3 at(scalar, scalar, scalar, cache_type&) const { return m_value; }
+
+    private:
+    /// The value of the field
+    vector3 m_value;
+
+};  // class constant_field
+
+}  // namespace traccc
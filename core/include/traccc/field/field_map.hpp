@@ -0,0 +1,265 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+
+// System include(s).
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace traccc {
+
+/// Field values at the corners of one cell of a field map
+///
+/// Consecutive lookups along a track usually fall into the same cell of the
+/// map. Keeping the corners of the last cell around lets these lookups skip
+/// the search for the cell and the loads of its corners.
+///
+struct field_map_cache {
+
+    /// Type of one field value
+    using value_type = std::array<scalar, 3>;
+
+    /// Whether a cell was loaded into the cache already
+    bool valid = false;
+    /// The lower edges of the cell along x, y and z
+    std::array<scalar, 3> lower{};
+    /// The upper edges of the cell along x, y and z
+    std::array<scalar, 3> upper{};
+    /// The field values at the corners of the cell, with the index built as
+    /// <tt>4 * ix + 2 * iy + iz</tt>
+    std::array<value_type, 8> corners{};
+
+};  // struct field_map_cache
+
+/// Non-owning view of a magnetic field map, defined on a regular grid in
+/// x, y and z
+///
+/// The field is interpolated trilinearly between the grid points. Positions
+/// outside of the grid are clamped onto its boundary.
+///
+class field_map_view {
+
+    public:
+    /// The field depends on the position
+    static constexpr bool is_constant = false;
+
+    /// Type of one field value
+    using value_type = field_map_cache::value_type;
+    /// The interpolation cell re-used between lookups
+    using cache_type = field_map_cache;
+
+    /// Default constructor, for an empty view
+    field_map_view() = default;
+
+    /// Constructor from the grid description and the field values
+    ///
+    /// @param min The position of the first grid point along x, y and z
+    /// @param max The position of the last grid point along x, y and z
+    /// @param n_points The number of grid points along x, y and z
+    /// @param values The field values, with the z index running fastest
+    ///
+    TRACCC_HOST_DEVICE
+    field_map_view(const std::array<scalar, 3>& min,
+                   const std::array<scalar, 3>& max,
+                   const std::array<unsigned int, 3>& n_points,
+                   const value_type* values)
+        : m_min(min), m_max(max), m_n_points(n_points), m_values(values) {
+
+        for (unsigned int i = 0; i < 3; ++i) {
+            m_step[i] = (m_max[i] - m_min[i]) /
+                        static_cast<scalar>(m_n_points[i] - 1);
+            m_inv_step[i] = 1.f / m_step[i];
+        }
+    }
+
+    /// @return The field at a given position, re-using the cell held in the
+    ///         cache if the position is inside of it
+    TRACCC_HOST_DEVICE
+    vector3 at(scalar x, scalar y, scalar z, cache_type& cache) const {
+
+        const std::array<scalar, 3> pos = {clamp(x, 0), clamp(y, 1),
+                                           clamp(z, 2)};
+        if (!(cache.valid && contains(cache, pos))) {
+            load_cell(pos, cache);
+        }
+
+        // Interpolate along x, then y, then z.
+        std::array<scalar, 3> f;
+        for (unsigned int i = 0; i < 3; ++i) {
+            f[i] = (pos[i] - cache.lower[i]) * m_inv_step[i];
+        }
+        std::array<scalar, 3> result;
+        for (unsigned int c = 0; c < 3; ++c) {
+            std::array<scalar, 4> yz;
+            for (unsigned int j = 0; j < 4; ++j) {
+                yz[j] = cache.corners[j][c] +
+                        f[0] * (cache.corners[4 + j][c] - cache.corners[j][c]);
+            }
+            const scalar z0 = yz[0] + f[1] * (yz[2] - yz[0]);
+            const scalar z1 = yz[1] + f[1] * (yz[3] - yz[1]);
+            result[c] = z0 + f[2] * (z1 - z0);
+        }
+        return {result[0], result[1], result[2]};
+    }
+
+    /// @return The field at a given position, without re-using a cell
+    TRACCC_HOST_DEVICE
+    vector3 at(scalar x, scalar y, scalar z) const {
+        cache_type cache;
+        return at(x, y, z, cache);
+    }
+
+    private:
+    /// @return The coordinate clamped into the grid along one axis
+    TRACCC_HOST_DEVICE
+    scalar clamp(scalar value, unsigned int axis) const {
+        return value < m_min[axis]
+                   ? m_min[axis]
+                   : (value > m_max[axis] ? m_max[axis] : value);
+    }
+
+    /// @return Whether a (clamped) position is inside the cached cell
+    TRACCC_HOST_DEVICE
+    static bool contains(const cache_type& cache,
+                         const std::array<scalar, 3>& pos) {
+        for (unsigned int i = 0; i < 3; ++i) {
+            if (pos[i] < cache.lower[i] || pos[i] > cache.upper[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Load the cell holding a (clamped) position into the cache
+    TRACCC_HOST_DEVICE
+    void load_cell(const std::array<scalar, 3>& pos, cache_type& cache) const {
+
+        std::array<unsigned int, 3> idx;
+        for (unsigned int i = 0; i < 3; ++i) {
+            const unsigned int last = m_n_points[i] - 2;
+            const unsigned int bin = static_cast<unsigned int>(
+                (pos[i] - m_min[i]) * m_inv_step[i]);
+            idx[i] = bin > last ? last : bin;
+            cache.lower[i] = m_min[i] + static_cast<scalar>(idx[i]) * m_step[i];
+            cache.upper[i] = cache.lower[i] + m_step[i];
+        }
+        for (unsigned int c = 0; c < 8; ++c) {
+            const std::size_t gx = idx[0] + ((c >> 2) & 1u);
+            const std::size_t gy = idx[1] + ((c >> 1) & 1u);
+            const std::size_t gz = idx[2] + (c & 1u);
+            cache.corners[c] =
+                m_values[(gx * m_n_points[1] + gy) * m_n_points[2] + gz];
+        }
+        cache.valid = true;
+    }
+
+    /// The position of the first grid point along x, y and z
+    std::array<scalar, 3> m_min{};
+    /// The position of the last grid point along x, y and z
+    std::array<scalar, 3> m_max{};
+    /// The distance between the grid points along x, y and z
+    std::array<scalar, 3> m_step{};
+    /// The inverse of the distance between the grid points
+    std::array<scalar, 3> m_inv_step{};
+    /// The number of grid points along x, y and z
+    std::array<unsigned int, 3> m_n_points{};
+    /// The field values on the grid
+    const value_type* m_values = nullptr;
+
+};  // class field_map_view
+
+/// Field map view carrying its own interpolation cell
+///
+/// Meant to be used as the magnetic field of a stepper. Every propagation
+/// state holds its own copy of the field, so each track (and thread) gets a
+/// separate cache while the lookups keep the usual const interface.
+///
+class cached_field_map {
+
+    public:
+    /// Constructor from the view of a field map
+    TRACCC_HOST_DEVICE
+    cached_field_map(const field_map_view& view) : m_view(view) {}
+
+    /// @return The field at a given position
+    TRACCC_HOST_DEVICE
+    vector3 at(scalar x, scalar y, scalar z) const {
+        return m_view.at(x, y, z, m_cache);
+    }
+
+    private:
+    /// The field map
+    field_map_view m_view;
+    /// The last cell used for the interpolation
+    mutable field_map_cache m_cache;
+
+};  // class cached_field_map
+
+/// Magnetic field map owning its values in host memory
+class field_map {
+
+    public:
+    /// Type of one field value
+    using value_type = field_map_view::value_type;
+
+    /// Constructor from the grid description and the field values
+    ///
+    /// @param min The position of the first grid point along x, y and z
+    /// @param max The position of the last grid point along x, y and z
+    /// @param n_points The number of grid points along x, y and z
+    /// @param values The field values, with the z index running fastest
+    ///
+    field_map(const std::array<scalar, 3>& min,
+              const std::array<scalar, 3>& max,
+              const std::array<unsigned int, 3>& n_points,
+              std::vector<value_type> values)
+        : m_min(min),
+          m_max(max),
+          m_n_points(n_points),
+          m_values(std::move(values)) {
+
+        std::size_t size = 1;
+        for (unsigned int i = 0; i < 3; ++i) {
+            if (m_n_points[i] < 2 || !(m_min[i] < m_max[i])) {
+                throw std::invalid_argument(
+                    "Field map needs at least two grid points, with "
+                    "increasing positions, along every axis");
+            }
+            size *= m_n_points[i];
+        }
+        if (m_values.size() != size) {
+            throw std::invalid_argument(
+                "Field map values do not match its grid");
+        }
+    }
+
+    /// @return A view of the field map
+    field_map_view view() const {
+        return {m_min, m_max, m_n_points, m_values.data()};
+    }
+
+    private:
+    /// The position of the first grid point along x, y and z
+    std::array<scalar, 3> m_min;
+    /// The position of the last grid point along x, y and z
+    std::array<scalar, 3> m_max;
+    /// The number of grid points along x, y and z
+    std::array<unsigned int, 3> m_n_points;
+    /// The field values on the grid
+    std::vector<value_type> m_values;
+
+};  // class field_map
+
+}  // namespace traccc
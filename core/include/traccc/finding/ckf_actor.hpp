@@ -0,0 +1,212 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/track_state.hpp"
+#include "traccc/finding/finding_config.hpp"
+#include "traccc/finding/measurement_table.hpp"
+#include "traccc/finding/predicted_chi2.hpp"
+#include "traccc/fitting/kalman_filter/gain_matrix_updater.hpp"
+
+// detray include(s).
+#include "detray/propagator/base_actor.hpp"
+#include "detray/tracks/bound_track_parameters.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace traccc {
+
+/// One branch of the combinatorial Kalman filter
+///
+/// A branch is described by the track parameters it starts from, and the
+/// measurements that were picked up before that point.
+template <typename algebra_t>
+struct ckf_branch {
+
+    using scalar_type = typename algebra_t::scalar_type;
+
+    /// Track parameters to start the propagation from
+    detray::bound_track_parameters<algebra_t> params;
+    /// Surface that @c params are bound to, if its measurement was already
+    /// applied (invalid for the initial seed)
+    std::size_t start_surface = std::numeric_limits<std::size_t>::max();
+    /// Measurements picked up by the branch so far
+    vecmem::vector<track_candidate> candidates;
+    /// Number of consecutive sensitive surfaces without a measurement
+    unsigned int n_holes = 0;
+    /// Sum of the (predicted) chi squares of the measurements
+    scalar_type chi2 = 0;
+};
+
+/// Detray actor for the combinatorial Kalman filter
+///
+/// On every sensitive surface the actor compares all measurements of the
+/// surface to the predicted track parameters, and continues the propagation
+/// with the Kalman update of the most compatible one.
+/// The next best compatible measurements are recorded as new branches, to be
+/// followed by separate propagations.
+template <typename algebra_t>
+struct ckf_actor : detray::actor {
+
+    // Type declarations
+    using track_state_type = track_state<algebra_t>;
+    using branch_type = ckf_branch<algebra_t>;
+    using scalar_type = typename algebra_t::scalar_type;
+
+    // Actor state
+    struct state {
+
+        /// Constructor with the measurements and the branch to extend
+        ///
+        /// @param table the measurements of the event
+        /// @param cfg the track finding configuration
+        /// @param branch the branch to extend
+        /// @param max_new_branches the number of new branches that may still
+        ///                         be created for the seed of @c branch
+        state(const measurement_table& table, const finding_config& cfg,
+              branch_type&& branch,
+              std::size_t max_new_branches =
+                  std::numeric_limits<std::size_t>::max())
+            : m_table(table),
+              m_cfg(cfg),
+              m_branch(std::move(branch)),
+              m_max_new_branches(max_new_branches) {}
+
+        /// Measurements of the event
+        const measurement_table& m_table;
+        /// Track finding configuration
+        const finding_config& m_cfg;
+        /// The branch being extended by the propagation
+        branch_type m_branch;
+        /// New branches found during the propagation
+        std::vector<branch_type> m_new_branches;
+        /// Maximal number of new branches to create during the propagation
+        std::size_t m_max_new_branches;
+    };
+
+    /// Actor operation to perform the measurement selection
+    ///
+    /// @param actor_state the actor state
+    /// @param propagation the propagator state
+    template <typename propagator_state_t>
+    void operator()(state& actor_state, propagator_state_t& propagation) const {
+
+        auto& stepping = propagation._stepping;
+        auto& navigation = propagation._navigation;
+
+        // triggered only for sensitive surfaces
+        if (!navigation.is_on_sensitive()) {
+            return;
+        }
+
+        branch_type& branch = actor_state.m_branch;
+        const finding_config& cfg = actor_state.m_cfg;
+        const std::size_t surface_link = navigation.current_object();
+
+        // Skip the surface that the branch starts from, its measurement was
+        // already used
+        if (surface_link == branch.start_surface) {
+            branch.start_surface = std::numeric_limits<std::size_t>::max();
+            return;
+        }
+
+        auto det = navigation.detector();
+        const auto& mask_store = det->mask_store();
+        const auto& surface = det->surface_by_index(surface_link);
+
+        // The predicted parameters on the surface, which the updater
+        // overwrites for every measurement that it is run on
+        const auto predicted = stepping._bound_params;
+
+        // Select the compatible measurements of the surface by the chi square
+        // of their residuals with respect to the predicted parameters
+        std::vector<std::pair<scalar_type, const measurement*>> compatible;
+        for (const measurement& meas : actor_state.m_table.find(surface_link)) {
+
+            const track_state_type trk_state(
+                {static_cast<geometry_id>(surface_link), meas});
+            const scalar_type chi2 =
+                mask_store.template call<predicted_chi2<algebra_t>>(
+                    surface.mask(), trk_state, predicted);
+
+            if (chi2 < cfg.chi2_max) {
+                compatible.emplace_back(chi2, &meas);
+            }
+        }
+
+        // Handle surfaces without a compatible measurement
+        if (compatible.empty()) {
+            if (++branch.n_holes > cfg.max_num_skipping_per_cand) {
+                propagation._heartbeat &= navigation.abort();
+            }
+            return;
+        }
+
+        // Order the compatible measurements by their chi square
+        std::sort(compatible.begin(), compatible.end(),
+                  [](const auto& lhs, const auto& rhs) {
+                      return lhs.first < rhs.first;
+                  });
+        const std::size_t n_branches =
+            std::min(compatible.size(), cfg.max_num_branches_per_surface);
+
+        // Run the Kalman update with one of the selected measurements
+        const auto update = [&](const measurement& meas) {
+            track_state_type trk_state(
+                {static_cast<geometry_id>(surface_link), meas});
+            trk_state.jacobian() = stepping._full_jacobian;
+            stepping._bound_params = predicted;
+            mask_store.template call<gain_matrix_updater<algebra_t>>(
+                surface.mask(), trk_state, propagation);
+            return trk_state;
+        };
+
+        // Record the next best measurements as new branches, as long as the
+        // seed may still have more of them
+        for (std::size_t i = 1;
+             (i < n_branches) && (actor_state.m_new_branches.size() <
+                                  actor_state.m_max_new_branches);
+             ++i) {
+            const track_state_type trk_state = update(*compatible[i].second);
+            branch_type new_branch;
+            new_branch.params = trk_state.filtered();
+            new_branch.start_surface = surface_link;
+            new_branch.candidates = branch.candidates;
+            new_branch.candidates.push_back(
+                {static_cast<geometry_id>(surface_link),
+                 trk_state.get_measurement()});
+            new_branch.n_holes = 0;
+            new_branch.chi2 = branch.chi2 + compatible[i].first;
+            actor_state.m_new_branches.push_back(std::move(new_branch));
+        }
+
+        // Continue with the best measurement. The updater leaves its
+        // filtered parameters in the stepper.
+        const track_state_type best = update(*compatible.front().second);
+        branch.candidates.push_back({static_cast<geometry_id>(surface_link),
+                                     best.get_measurement()});
+        branch.n_holes = 0;
+        branch.chi2 += compatible.front().first;
+
+        if (branch.candidates.size() >= cfg.max_track_candidates_per_track) {
+            propagation._heartbeat &= navigation.abort();
+        }
+    }
+};
+
+}  // namespace traccc
@@ -0,0 +1,232 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/finding/ckf_actor.hpp"
+#include "traccc/finding/finding_config.hpp"
+#include "traccc/finding/measurement_table.hpp"
+#include "traccc/utils/algorithm.hpp"
+
+// detray include(s).
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/actors/aborters.hpp"
+#include "detray/propagator/actors/parameter_resetter.hpp"
+#include "detray/propagator/actors/parameter_transporter.hpp"
+#include "detray/propagator/actors/pointwise_material_interactor.hpp"
+#include "detray/propagator/propagator.hpp"
+
+// TBB include(s).
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace traccc {
+
+/// Combinatorial Kalman filter track finding
+///
+/// Every seed is propagated through the detector, with the measurements of
+/// each sensitive surface along the way looked up from a
+/// @c traccc::measurement_table. The measurement most compatible with the
+/// predicted track parameters extends the current track candidate, while the
+/// next best ones start new branches, up to a configured number of branches
+/// per seed. The seeds are processed in parallel with TBB.
+///
+/// @tparam stepper_t The stepper type used for the propagation
+/// @tparam navigator_t The navigator type used for the propagation
+///
+template <typename stepper_t, typename navigator_t>
+class finding_algorithm
+    : public algorithm<track_candidate_container_types::host(
+          const typename navigator_t::detector_type&,
+          const measurement_container_types::host&,
+          const bound_track_parameters_collection_types::host&)> {
+
+    public:
+    // transform3 type
+    using transform3_type = typename stepper_t::transform3_type;
+
+    // Detector type
+    using detector_type = typename navigator_t::detector_type;
+
+    // Actor types
+    using aborter = detray::pathlimit_aborter;
+    using transporter = detray::parameter_transporter<transform3_type>;
+    using interactor = detray::pointwise_material_interactor<transform3_type>;
+    using ckf_actor_type = traccc::ckf_actor<transform3_type>;
+    using resetter = detray::parameter_resetter<transform3_type>;
+
+    using actor_chain_type =
+        detray::actor_chain<std::tuple, aborter, transporter, interactor,
+                            ckf_actor_type, resetter>;
+
+    // Propagator type
+    using propagator_type =
+        detray::propagator<stepper_t, navigator_t, actor_chain_type>;
+
+    // Branch type
+    using branch_type = typename ckf_actor_type::branch_type;
+
+    /// Constructor with a configuration, for measurements whose module
+    /// identifiers are the surface indices of the detector
+    ///
+    /// @param cfg the track finding configuration
+    finding_algorithm(const finding_config& cfg = {}) : m_cfg(cfg) {}
+
+    /// Constructor with a configuration and the detector surfaces of the
+    /// modules
+    ///
+    /// @param cfg the track finding configuration
+    /// @param surfaces the detector surface index of every module, which
+    ///                 needs to outlive the algorithm
+    finding_algorithm(const finding_config& cfg,
+                      const measurement_table::surface_map& surfaces)
+        : m_cfg(cfg), m_surfaces(&surfaces) {}
+
+    /// Run the algorithm
+    ///
+    /// @param det the detector to find the tracks in
+    /// @param measurements the measurements of the event, grouped by module
+    /// @param seeds the track parameters of the seeds
+    /// @return the found track candidates, ordered by seed, and for each seed
+    ///         from the most to the least complete candidate
+    track_candidate_container_types::host operator()(
+        const detector_type& det,
+        const measurement_container_types::host& measurements,
+        const bound_track_parameters_collection_types::host& seeds)
+        const override {
+
+        // Index the measurements by surface
+        const measurement_table table =
+            (m_surfaces == nullptr)
+                ? measurement_table(measurements)
+                : measurement_table(measurements, *m_surfaces);
+
+        // Find the track candidates of all seeds
+        const std::size_t n_seeds = seeds.size();
+        std::vector<std::vector<branch_type>> tracks(n_seeds);
+        tbb::parallel_for(
+            tbb::blocked_range<std::size_t>(0, n_seeds),
+            [&](const tbb::blocked_range<std::size_t>& range) {
+                for (std::size_t i = range.begin(); i != range.end(); ++i) {
+                    tracks[i] = find_tracks(det, table, seeds[i]);
+                }
+            });
+
+        // Collect the results
+        track_candidate_container_types::host output_candidates;
+        for (std::size_t i = 0; i < n_seeds; ++i) {
+            for (branch_type& track : tracks[i]) {
+                output_candidates.push_back(bound_track_parameters(seeds[i]),
+                                            std::move(track.candidates));
+            }
+        }
+
+        return output_candidates;
+    }
+
+    private:
+    /// Find the track candidates belonging to a single seed
+    ///
+    /// @param det the detector to find the tracks in
+    /// @param table the measurements of the event, indexed by surface
+    /// @param seed the track parameters of the seed
+    /// @return the finished branches, with the best candidate first
+    std::vector<branch_type> find_tracks(
+        const detector_type& det, const measurement_table& table,
+        const bound_track_parameters& seed) const {
+
+        std::vector<branch_type> result;
+
+        // Branches still to be followed
+        std::vector<branch_type> pending;
+        branch_type seed_branch;
+        seed_branch.params = seed;
+        pending.push_back(std::move(seed_branch));
+
+        // Branches created for the seed so far, including the first one
+        std::size_t n_created = 1;
+        while (!pending.empty()) {
+
+            branch_type branch = std::move(pending.back());
+            pending.pop_back();
+
+            // Create propagator
+            propagator_type propagator({}, {});
+
+            // Set up the actor states
+            typename aborter::state aborter_state{};
+            aborter_state.set_path_limit(m_cfg.pathlimit);
+            typename transporter::state transporter_state{};
+            typename interactor::state interactor_state{};
+            typename ckf_actor_type::state ckf_state(
+                table, m_cfg, std::move(branch),
+                m_cfg.max_num_branches_per_seed -
+                    std::min(n_created, m_cfg.max_num_branches_per_seed));
+            typename resetter::state resetter_state{};
+            typename actor_chain_type::state actor_states =
+                std::tie(aborter_state, transporter_state, interactor_state,
+                         ckf_state, resetter_state);
+
+            // Create propagator state
+            typename propagator_type::state propagation(
+                ckf_state.m_branch.params, det.get_bfield(), det);
+
+            // Set overstep tolerance and stepper constraint
+            propagation._stepping().set_overstep_tolerance(
+                m_cfg.overstep_tolerance);
+            propagation._stepping
+                .template set_constraint<detray::step::constraint::e_accuracy>(
+                    m_cfg.step_constraint);
+
+            // Run the propagation with the measurement selection
+            propagator.propagate(propagation, actor_states);
+
+            // Follow the new branches, the best ones first
+            n_created += ckf_state.m_new_branches.size();
+            for (auto it = ckf_state.m_new_branches.rbegin();
+                 it != ckf_state.m_new_branches.rend(); ++it) {
+                pending.push_back(std::move(*it));
+            }
+
+            // Keep the finished branch if it picked up enough measurements
+            if (ckf_state.m_branch.candidates.size() >=
+                m_cfg.min_track_candidates_per_track) {
+                result.push_back(std::move(ckf_state.m_branch));
+            }
+        }
+
+        // Order the candidates by the number of measurements, and then by
+        // their chi square
+        std::stable_sort(result.begin(), result.end(),
+                         [](const branch_type& lhs, const branch_type& rhs) {
+                             if (lhs.candidates.size() !=
+                                 rhs.candidates.size()) {
+                                 return lhs.candidates.size() >
+                                        rhs.candidates.size();
+                             }
+                             return lhs.chi2 < rhs.chi2;
+                         });
+
+        return result;
+    }
+
+    /// Configuration object
+    finding_config m_cfg;
+    /// The detector surface index of every module, if not the same
+    const measurement_table::surface_map* m_surfaces = nullptr;
+};
+
+}  // namespace traccc
@@ -0,0 +1,49 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+
+// detray include(s).
+#include "detray/definitions/units.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <limits>
+
+namespace traccc {
+
+/// Configuration struct for the combinatorial Kalman filter track finding
+struct finding_config {
+
+    /// Maximum number of track candidates (branches) created per seed,
+    /// including the one starting from the seed itself
+    std::size_t max_num_branches_per_seed = 10;
+    /// Maximum number of measurements to branch on per surface
+    std::size_t max_num_branches_per_surface = 3;
+    /// Maximum chi square of a measurement, with respect to the predicted
+    /// track parameters, to be considered compatible
+    scalar chi2_max = 30.f;
+    /// Minimum number of measurements for a track candidate to be kept
+    std::size_t min_track_candidates_per_track = 3;
+    /// Maximum number of measurements on a track candidate
+    std::size_t max_track_candidates_per_track = 100;
+    /// Maximum number of consecutive sensitive surfaces without a
+    /// compatible measurement before a branch is dropped
+    unsigned int max_num_skipping_per_cand = 3;
+
+    /// Propagation path limit
+    scalar pathlimit = std::numeric_limits<scalar>::max();
+    /// Propagation overstep tolerance
+    scalar overstep_tolerance = -10 * detray::unit<scalar>::um;
+    /// Propagation step constraint
+    scalar step_constraint = 5. * detray::unit<scalar>::mm;
+};
+
+}  // namespace traccc
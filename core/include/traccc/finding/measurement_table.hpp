@@ -0,0 +1,102 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/measurement.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <map>
+#include <vector>
+
+namespace traccc {
+
+/// Measurements of an event, indexed by the detector surface that they are on
+///
+/// The table stores all measurements in one contiguous array, sorted by
+/// surface, with an offset table over the sorted surface indices. This
+/// makes looking up the measurements on a given surface during track finding
+/// a single binary search.
+///
+/// The modules of the measurement container are mapped to the surface
+/// indices of the detector used in the track finding, unless the module
+/// identifiers are the surface indices themselves.
+///
+class measurement_table {
+
+    public:
+    /// Detector surface index of every module (geometry) identifier
+    using surface_map = std::map<geometry_id, std::size_t>;
+
+    /// Range of measurements belonging to one surface
+    struct range {
+        const measurement* m_begin = nullptr;
+        const measurement* m_end = nullptr;
+
+        const measurement* begin() const { return m_begin; }
+        const measurement* end() const { return m_end; }
+        std::size_t size() const {
+            return static_cast<std::size_t>(m_end - m_begin);
+        }
+        bool empty() const { return m_begin == m_end; }
+    };
+
+    /// Construct the table from a measurement container, with the module
+    /// identifiers used as the surface indices
+    ///
+    /// @param measurements The measurements of the event, grouped by module
+    ///
+    explicit measurement_table(
+        const measurement_container_types::host& measurements);
+
+    /// Construct the table from a measurement container, mapping the modules
+    /// to detector surfaces
+    ///
+    /// An exception is thrown for modules with measurements that are missing
+    /// from the map.
+    ///
+    /// @param measurements The measurements of the event, grouped by module
+    /// @param surfaces The detector surface index of every module
+    ///
+    measurement_table(const measurement_container_types::host& measurements,
+                      const surface_map& surfaces);
+
+    /// Get the measurements on a given detector surface
+    ///
+    /// @param surface The index of the surface in the detector
+    /// @return The (possibly empty) range of measurements on the surface
+    ///
+    range find(std::size_t surface) const;
+
+    /// Get the number of surfaces with measurements
+    std::size_t n_surfaces() const { return m_surfaces.size(); }
+
+    /// Get the total number of measurements
+    std::size_t n_measurements() const { return m_measurements.size(); }
+
+    private:
+    /// Fill the table, with a surface index given for every module
+    ///
+    /// @param measurements The measurements of the event, grouped by module
+    /// @param surfaces The surface index of every module of @c measurements
+    ///
+    void fill(const measurement_container_types::host& measurements,
+              const std::vector<std::size_t>& surfaces);
+
+    /// Sorted, unique indices of the surfaces with measurements
+    std::vector<std::size_t> m_surfaces;
+    /// Offsets of the measurements of each surface (one more than surfaces)
+    std::vector<std::size_t> m_offsets;
+    /// All measurements, sorted by surface
+    std::vector<measurement> m_measurements;
+
+};  // class measurement_table
+
+}  // namespace traccc
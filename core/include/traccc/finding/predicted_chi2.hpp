@@ -0,0 +1,94 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/definitions/track_parametrization.hpp"
+#include "traccc/edm/track_state.hpp"
+#include "traccc/utils/matrix_cast.hpp"
+
+// detray include(s).
+#include "detray/tracks/bound_track_parameters.hpp"
+
+namespace traccc {
+
+/// Chi square of a measurement with respect to the predicted track
+/// parameters on its surface
+///
+/// Used to select the measurements compatible with a track, before running
+/// the Kalman update with any of them.
+///
+/// @tparam algebra_t The algebra type of the track states
+/// @tparam fit_algebra_t The algebra type used in the calculations
+///
+template <typename algebra_t, typename fit_algebra_t = fitting_transform3>
+struct predicted_chi2 {
+
+    // Type declarations
+    using output_type = typename algebra_t::scalar_type;
+    using fit_matrix_operator = typename fit_algebra_t::matrix_actor;
+    using size_type = typename fit_matrix_operator::size_ty;
+    template <size_type ROWS, size_type COLS>
+    using fit_matrix_type =
+        typename fit_matrix_operator::template matrix_type<ROWS, COLS>;
+
+    /// Calculate the chi square of the predicted residual
+    ///
+    /// @param mask_group mask group that contains the mask of surface
+    /// @param index mask index of surface
+    /// @param trk_state track state holding the measurement
+    /// @param predicted predicted track parameters on the surface
+    ///
+    /// @return the chi square of the residual between the measurement and
+    ///         the (projected) predicted parameters
+    template <typename mask_group_t, typename index_t>
+    TRACCC_HOST_DEVICE inline output_type operator()(
+        const mask_group_t& mask_group, const index_t& index,
+        const track_state<algebra_t>& trk_state,
+        const detray::bound_track_parameters<algebra_t>& predicted) const {
+
+        // projection matrix
+        const fit_matrix_type<2, 6> H =
+            matrix_cast<fit_algebra_t, algebra_t, 2, 6>(
+                mask_group[index].template projection_matrix<e_bound_size>());
+
+        // Measurement data on surface
+        const fit_matrix_type<2, 1> meas_local =
+            matrix_cast<fit_algebra_t, algebra_t, 2, 1>(
+                trk_state.measurement_local());
+
+        // Predicted vector and covariance of bound track parameters
+        const fit_matrix_type<6, 1> predicted_vec =
+            matrix_cast<fit_algebra_t, algebra_t, 6, 1>(predicted.vector());
+        const fit_matrix_type<6, 6> predicted_cov =
+            matrix_cast<fit_algebra_t, algebra_t, 6, 6>(
+                predicted.covariance());
+
+        // Spatial resolution (Measurement covariance)
+        const fit_matrix_type<2, 2> V =
+            matrix_cast<fit_algebra_t, algebra_t, 2, 2>(
+                trk_state.measurement_covariance());
+
+        // Residual and its covariance
+        const fit_matrix_type<2, 1> residual =
+            meas_local - H * predicted_vec;
+        const fit_matrix_type<2, 2> R =
+            H * predicted_cov * fit_matrix_operator().transpose(H) + V;
+
+        // Calculate the chi square
+        const fit_matrix_type<1, 1> chi2 =
+            fit_matrix_operator().transpose(residual) *
+            fit_matrix_operator().inverse(R) * residual;
+
+        return static_cast<output_type>(
+            fit_matrix_operator().element(chi2, 0, 0));
+    }
+};
+
+}  // namespace traccc
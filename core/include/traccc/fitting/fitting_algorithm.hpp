@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2023 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -12,36 +12,74 @@
 #include "traccc/edm/track_candidate.hpp"
 #include "traccc/edm/track_state.hpp"
 #include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
+#include "traccc/fitting/fitting_output.hpp"
 #include "traccc/utils/algorithm.hpp"
 
+// System include(s).
+#include <type_traits>
+
 namespace traccc {
 
 /// Fitting algorithm for a set of tracks
-template <typename fitter_t>
+///
+/// @tparam fitter_t The type of the track fitter
+/// @tparam output How much of the fitted tracks to return
+///
+/// The @c output setting only trims the output. Every track is fitted with a
+/// full @c traccc::track_state per measurement, whatever is returned in the
+/// end, as the filter and the smoother need them. With a trimmed output the
+/// memory of these states is re-used from one track to the next.
+///
+template <typename fitter_t, fitting_output output = fitting_output::full>
 class fitting_algorithm
-    : public algorithm<track_state_container_types::host(
+    : public algorithm<typename fitting_output_types<output>::type::host(
           const typename fitter_t::detector_type&,
           const typename track_candidate_container_types::host&)> {
 
     public:
     using transform3_type = typename fitter_t::transform3_type;
 
+    /// Type of the output of the algorithm
+    using output_type = typename fitting_output_types<output>::type::host;
+
+    /// Type of the magnetic field of the fitter
+    using field_type = typename fitter_t::field_type;
+
+    /// Constructor fitting the tracks in the field of the detector
+    ///
+    /// Only available if the field of the fitter can be made from the field
+    /// of the detector. Other fields, like @c traccc::cached_field_map, need
+    /// to be given explicitly.
+    ///
+    template <bool enable = fitter_t::uses_detector_field,
+              std::enable_if_t<enable, bool> = true>
+    fitting_algorithm() {}
+
+    /// Constructor fitting the tracks in a separate magnetic field
+    ///
+    /// @param field the magnetic field, which needs to outlive the algorithm
+    explicit fitting_algorithm(const field_type& field) : m_field(&field) {}
+
     /// Run the algorithm
     ///
     /// @param track_candidates the candidate measurements from track finding
     /// @return the container of the fitted track parameters
-    track_state_container_types::host operator()(
+    output_type operator()(
         const typename fitter_t::detector_type& det,
         const typename track_candidate_container_types::host& track_candidates)
         const override {
 
-        fitter_t fitter(det);
+        fitter_t fitter = make_fitter(det);
 
-        track_state_container_types::host output_states;
+        output_type output_states;
 
         // The number of tracks
         std::size_t n_tracks = track_candidates.size();
 
+        // Track states of the track being fitted. Unless they are all kept,
+        // the same memory is re-used for every track.
+        vecmem::vector<track_state<transform3_type>> input_states;
+
         // Iterate over tracks
         for (std::size_t i = 0; i < n_tracks; i++) {
 
@@ -50,7 +88,8 @@ class fitting_algorithm
 
             // Make a vector of track state
             auto& cands = track_candidates[i].items;
-            vecmem::vector<track_state<transform3_type>> input_states;
+            input_states.clear();
+            input_states.reserve(cands.size());
             for (auto& cand : cands) {
                 input_states.emplace_back(cand);
             }
@@ -61,13 +100,39 @@ class fitting_algorithm
             // Run fitter
             fitter.fit(seed_param, fitter_state);
 
-            output_states.push_back(
-                std::move(fitter_state.m_fit_info),
-                std::move(fitter_state.m_fit_actor_state.m_track_states));
+            auto& track_states = fitter_state.m_fit_actor_state.m_track_states;
+            if constexpr (output == fitting_output::full) {
+                output_states.push_back(std::move(fitter_state.m_fit_info),
+                                        std::move(track_states));
+            } else {
+                vecmem::vector<typename output_type::item_type> fitted_states;
+                if constexpr (output == fitting_output::smoothed) {
+                    fitted_states.assign(track_states.begin(),
+                                         track_states.end());
+                }
+                output_states.push_back(std::move(fitter_state.m_fit_info),
+                                        std::move(fitted_states));
+                // Take back the memory of the track states.
+                input_states = std::move(track_states);
+            }
         }
 
         return output_states;
     }
+
+    private:
+    /// @return the fitter for a given detector
+    fitter_t make_fitter(const typename fitter_t::detector_type& det) const {
+        if constexpr (fitter_t::uses_detector_field) {
+            if (m_field == nullptr) {
+                return fitter_t(det);
+            }
+        }
+        return fitter_t(det, *m_field);
+    }
+
+    /// The magnetic field to fit the tracks in, if not the detector's
+    const field_type* m_field = nullptr;
 };
 
-}  // namespace traccc
\ No newline at end of file
+}  // namespace traccc
@@ -0,0 +1,42 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/track_state.hpp"
+
+namespace traccc {
+
+/// How much of the fitted tracks the fitting algorithm returns
+///
+/// This only trims the output of the fitting. The fitter itself always
+/// works with the full track states of the track that it is fitting, so the
+/// working memory of a fit does not depend on this setting.
+///
+enum class fitting_output : int {
+    /// The predicted, filtered and smoothed parameters of every measurement
+    full = 0,
+    /// Only the smoothed parameters of every measurement
+    smoothed = 1,
+    /// Only the fitted track summary, without any per-measurement result
+    summary = 2
+};
+
+/// Container types of the trimmed fitting output
+template <fitting_output output>
+struct fitting_output_types {
+    using type = fitted_track_state_container_types;
+};
+
+/// Container types of the fitting output with all of the track states
+template <>
+struct fitting_output_types<fitting_output::full> {
+    using type = track_state_container_types;
+};
+
+}  // namespace traccc
@@ -10,6 +10,7 @@
 // Project include(s).
 #include "traccc/definitions/qualifiers.hpp"
 #include "traccc/edm/track_parameters.hpp"
+#include "traccc/utils/matrix_cast.hpp"
 
 // detray include(s).
 #include "detray/propagator/navigator.hpp"
@@ -18,7 +19,11 @@ namespace traccc {
 
 /// Type unrolling functor to smooth the track parameters after the Kalman
 /// filtering
-template <typename algebra_t>
+///
+/// @tparam algebra_t The algebra type of the track states
+/// @tparam fit_algebra_t The algebra type used in the calculations
+///
+template <typename algebra_t, typename fit_algebra_t = fitting_transform3>
 struct gain_matrix_smoother {
 
     // Type declarations
@@ -28,12 +33,19 @@ struct gain_matrix_smoother {
     template <size_type ROWS, size_type COLS>
     using matrix_type =
         typename matrix_operator::template matrix_type<ROWS, COLS>;
+    using fit_matrix_operator = typename fit_algebra_t::matrix_actor;
+    template <size_type ROWS, size_type COLS>
+    using fit_matrix_type =
+        typename fit_matrix_operator::template matrix_type<ROWS, COLS>;
 
     /// Gain matrix smoother operation
     ///
     /// @brief Based on "Application of Kalman filtering to track and vertex
     /// fitting", R.Frühwirth, NIM A
     ///
+    /// The inputs are converted to the precision of @c fit_algebra_t, and
+    /// the results back to the precision of @c algebra_t.
+    ///
     /// @param mask_group mask group that contains the mask of the current
     /// surface
     /// @param index mask index of the current surface
@@ -52,56 +64,77 @@ struct gain_matrix_smoother {
         const auto& cur_filtered = cur_state.filtered();
 
         // Next track state parameters
-        const matrix_type<6, 6>& next_jacobian = next_state.jacobian();
-        const matrix_type<6, 1>& next_smoothed_vec = next_smoothed.vector();
-        const matrix_type<6, 6>& next_smoothed_cov = next_smoothed.covariance();
-        const matrix_type<6, 1>& next_predicted_vec = next_predicted.vector();
-        const matrix_type<6, 6>& next_predicted_cov =
-            next_predicted.covariance();
+        const fit_matrix_type<6, 6> next_jacobian =
+            matrix_cast<fit_algebra_t, algebra_t, 6, 6>(next_state.jacobian());
+        const fit_matrix_type<6, 1> next_smoothed_vec =
+            matrix_cast<fit_algebra_t, algebra_t, 6, 1>(next_smoothed.vector());
+        const fit_matrix_type<6, 6> next_smoothed_cov =
+            matrix_cast<fit_algebra_t, algebra_t, 6, 6>(
+                next_smoothed.covariance());
+        const fit_matrix_type<6, 1> next_predicted_vec =
+            matrix_cast<fit_algebra_t, algebra_t, 6, 1>(
+                next_predicted.vector());
+        const fit_matrix_type<6, 6> next_predicted_cov =
+            matrix_cast<fit_algebra_t, algebra_t, 6, 6>(
+                next_predicted.covariance());
 
         // Current track state parameters
-        const matrix_type<6, 1>& cur_filtered_vec = cur_filtered.vector();
-        const matrix_type<6, 6>& cur_filtered_cov = cur_filtered.covariance();
+        const fit_matrix_type<6, 1> cur_filtered_vec =
+            matrix_cast<fit_algebra_t, algebra_t, 6, 1>(cur_filtered.vector());
+        const fit_matrix_type<6, 6> cur_filtered_cov =
+            matrix_cast<fit_algebra_t, algebra_t, 6, 6>(
+                cur_filtered.covariance());
 
         // Regularization matrix for numerical stability
-        static constexpr scalar epsilon = 1e-13;
-        const matrix_type<6, 6> regularization =
-            matrix_operator().template identity<e_bound_size, e_bound_size>() *
+        static constexpr typename fit_algebra_t::scalar_type epsilon = 1e-13;
+        const fit_matrix_type<6, 6> regularization =
+            fit_matrix_operator()
+                .template identity<e_bound_size, e_bound_size>() *
             epsilon;
-        const matrix_type<6, 6> regularized_predicted_cov =
+        const fit_matrix_type<6, 6> regularized_predicted_cov =
             next_predicted_cov + regularization;
 
         // Calculate smoothed parameter for current state
-        const matrix_type<6, 6> A =
-            cur_filtered_cov * matrix_operator().transpose(next_jacobian) *
-            matrix_operator().inverse(regularized_predicted_cov);
+        const fit_matrix_type<6, 6> A =
+            cur_filtered_cov * fit_matrix_operator().transpose(next_jacobian) *
+            fit_matrix_operator().inverse(regularized_predicted_cov);
 
-        const matrix_type<6, 1> smt_vec =
+        const fit_matrix_type<6, 1> smt_vec =
             cur_filtered_vec + A * (next_smoothed_vec - next_predicted_vec);
-        const matrix_type<6, 6> smt_cov =
+        const fit_matrix_type<6, 6> smt_cov =
             cur_filtered_cov + A * (next_smoothed_cov - next_predicted_cov) *
-                                   matrix_operator().transpose(A);
+                                   fit_matrix_operator().transpose(A);
 
-        cur_state.smoothed().set_vector(smt_vec);
-        cur_state.smoothed().set_covariance(smt_cov);
+        cur_state.smoothed().set_vector(
+            matrix_cast<algebra_t, fit_algebra_t, 6, 1>(smt_vec));
+        cur_state.smoothed().set_covariance(
+            matrix_cast<algebra_t, fit_algebra_t, 6, 6>(smt_cov));
 
         // projection matrix
-        const matrix_type<2, 6> H =
-            mask_group[index].template projection_matrix<e_bound_size>();
+        const fit_matrix_type<2, 6> H =
+            matrix_cast<fit_algebra_t, algebra_t, 2, 6>(
+                mask_group[index].template projection_matrix<e_bound_size>());
 
         // Calculate smoothed chi square
-        const matrix_type<2, 1>& meas_local = cur_state.measurement_local();
-        const matrix_type<2, 2>& V = cur_state.measurement_covariance();
-        const matrix_type<2, 1> residual = meas_local - H * smt_vec;
-        const matrix_type<2, 2> R =
-            V - H * smt_cov * matrix_operator().transpose(H);
-        const matrix_type<1, 1> chi2 = matrix_operator().transpose(residual) *
-                                       matrix_operator().inverse(R) * residual;
-
-        cur_state.smoothed_chi2() = matrix_operator().element(chi2, 0, 0);
+        const fit_matrix_type<2, 1> meas_local =
+            matrix_cast<fit_algebra_t, algebra_t, 2, 1>(
+                cur_state.measurement_local());
+        const fit_matrix_type<2, 2> V =
+            matrix_cast<fit_algebra_t, algebra_t, 2, 2>(
+                cur_state.measurement_covariance());
+        const fit_matrix_type<2, 1> residual = meas_local - H * smt_vec;
+        const fit_matrix_type<2, 2> R =
+            V - H * smt_cov * fit_matrix_operator().transpose(H);
+        const fit_matrix_type<1, 1> chi2 =
+            fit_matrix_operator().transpose(residual) *
+            fit_matrix_operator().inverse(R) * residual;
+
+        cur_state.smoothed_chi2() =
+            static_cast<typename algebra_t::scalar_type>(
+                fit_matrix_operator().element(chi2, 0, 0));
 
         return true;
     }
 };
 
-}  // namespace traccc
\ No newline at end of file
+}  // namespace traccc
@@ -10,11 +10,16 @@
 // Project include(s).
 #include "traccc/definitions/qualifiers.hpp"
 #include "traccc/definitions/track_parametrization.hpp"
+#include "traccc/utils/matrix_cast.hpp"
 
 namespace traccc {
 
 /// Type unrolling functor for Kalman updating
-template <typename algebra_t>
+///
+/// @tparam algebra_t The algebra type of the track states and parameters
+/// @tparam fit_algebra_t The algebra type used in the calculations
+///
+template <typename algebra_t, typename fit_algebra_t = fitting_transform3>
 struct gain_matrix_updater {
 
     // Type declarations
@@ -24,12 +29,19 @@ struct gain_matrix_updater {
     template <size_type ROWS, size_type COLS>
     using matrix_type =
         typename matrix_operator::template matrix_type<ROWS, COLS>;
+    using fit_matrix_operator = typename fit_algebra_t::matrix_actor;
+    template <size_type ROWS, size_type COLS>
+    using fit_matrix_type =
+        typename fit_matrix_operator::template matrix_type<ROWS, COLS>;
 
     /// Gain matrix updater operation
     ///
     /// @brief Based on "Application of Kalman filtering to track and vertex
     /// fitting", R.Frühwirth, NIM A
     ///
+    /// The inputs are converted to the precision of @c fit_algebra_t, and
+    /// the results back to the precision of @c algebra_t.
+    ///
     /// @param mask_group mask group that contains the mask of surface
     /// @param index mask index of surface
     /// @param trk_state track state of the surface
@@ -47,62 +59,81 @@ struct gain_matrix_updater {
 
         // Some identity matrices
         // @Note: Make constexpr work
-        const matrix_type<6, 6> I66 =
-            matrix_operator().template identity<e_bound_size, e_bound_size>();
-        const matrix_type<2, 2> I22 =
-            matrix_operator().template identity<2, 2>();
+        const fit_matrix_type<6, 6> I66 =
+            fit_matrix_operator()
+                .template identity<e_bound_size, e_bound_size>();
+        const fit_matrix_type<2, 2> I22 =
+            fit_matrix_operator().template identity<2, 2>();
 
         // projection matrix
-        const matrix_type<2, 6> H =
-            mask_group[index].template projection_matrix<e_bound_size>();
+        const fit_matrix_type<2, 6> H =
+            matrix_cast<fit_algebra_t, algebra_t, 2, 6>(
+                mask_group[index].template projection_matrix<e_bound_size>());
 
         // Measurement data on surface
-        const matrix_type<2, 1>& meas_local = trk_state.measurement_local();
+        const fit_matrix_type<2, 1> meas_local =
+            matrix_cast<fit_algebra_t, algebra_t, 2, 1>(
+                trk_state.measurement_local());
+
+        // Set track state parameters
+        trk_state.predicted().set_vector(stepping._bound_params.vector());
+        trk_state.predicted().set_covariance(
+            stepping._bound_params.covariance());
 
         // Predicted vector of bound track parameters
-        const matrix_type<6, 1>& predicted_vec =
-            stepping._bound_params.vector();
+        const fit_matrix_type<6, 1> predicted_vec =
+            matrix_cast<fit_algebra_t, algebra_t, 6, 1>(
+                stepping._bound_params.vector());
 
         // Predicted covaraince of bound track parameters
-        const matrix_type<6, 6>& predicted_cov =
-            stepping._bound_params.covariance();
-
-        // Set track state parameters
-        trk_state.predicted().set_vector(predicted_vec);
-        trk_state.predicted().set_covariance(predicted_cov);
+        const fit_matrix_type<6, 6> predicted_cov =
+            matrix_cast<fit_algebra_t, algebra_t, 6, 6>(
+                stepping._bound_params.covariance());
 
         // Spatial resolution (Measurement covariance)
-        const matrix_type<2, 2> V = trk_state.measurement_covariance();
+        const fit_matrix_type<2, 2> V =
+            matrix_cast<fit_algebra_t, algebra_t, 2, 2>(
+                trk_state.measurement_covariance());
 
-        const matrix_type<2, 2> M =
-            H * predicted_cov * matrix_operator().transpose(H) + V;
+        const fit_matrix_type<2, 2> M =
+            H * predicted_cov * fit_matrix_operator().transpose(H) + V;
 
         // Kalman gain matrix
-        const matrix_type<6, 2> K = predicted_cov *
-                                    matrix_operator().transpose(H) *
-                                    matrix_operator().inverse(M);
+        const fit_matrix_type<6, 2> K = predicted_cov *
+                                        fit_matrix_operator().transpose(H) *
+                                        fit_matrix_operator().inverse(M);
 
         // Calculate the filtered track parameters
-        const matrix_type<6, 1> filtered_vec =
+        const fit_matrix_type<6, 1> filtered_vec =
             predicted_vec + K * (meas_local - H * predicted_vec);
-        const matrix_type<6, 6> filtered_cov = (I66 - K * H) * predicted_cov;
+        const fit_matrix_type<6, 6> filtered_cov =
+            (I66 - K * H) * predicted_cov;
 
         // Residual between measurement and (projected) filtered vector
-        const matrix_type<2, 1> residual = meas_local - H * filtered_vec;
+        const fit_matrix_type<2, 1> residual = meas_local - H * filtered_vec;
 
         // Calculate the chi square
-        const matrix_type<2, 2> R = (I22 - H * K) * V;
-        const matrix_type<1, 1> chi2 = matrix_operator().transpose(residual) *
-                                       matrix_operator().inverse(R) * residual;
+        const fit_matrix_type<2, 2> R = (I22 - H * K) * V;
+        const fit_matrix_type<1, 1> chi2 =
+            fit_matrix_operator().transpose(residual) *
+            fit_matrix_operator().inverse(R) * residual;
+
+        // Convert the results to the precision of the track states
+        const matrix_type<6, 1> filtered_vec_out =
+            matrix_cast<algebra_t, fit_algebra_t, 6, 1>(filtered_vec);
+        const matrix_type<6, 6> filtered_cov_out =
+            matrix_cast<algebra_t, fit_algebra_t, 6, 6>(filtered_cov);
 
         // Set the stepper parameter
-        stepping._bound_params.set_vector(filtered_vec);
-        stepping._bound_params.set_covariance(filtered_cov);
+        stepping._bound_params.set_vector(filtered_vec_out);
+        stepping._bound_params.set_covariance(filtered_cov_out);
 
         // Set the track state parameters
-        trk_state.filtered().set_vector(filtered_vec);
-        trk_state.filtered().set_covariance(filtered_cov);
-        trk_state.filtered_chi2() = matrix_operator().element(chi2, 0, 0);
+        trk_state.filtered().set_vector(filtered_vec_out);
+        trk_state.filtered().set_covariance(filtered_cov_out);
+        trk_state.filtered_chi2() =
+            static_cast<typename algebra_t::scalar_type>(
+                fit_matrix_operator().element(chi2, 0, 0));
 
         return true;
     }
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2023 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -13,6 +13,7 @@
 #include "traccc/edm/track_parameters.hpp"
 #include "traccc/edm/track_state.hpp"
 #include "traccc/fitting/kalman_filter/kalman_actor.hpp"
+#include "traccc/fitting/kalman_filter/statistics_updater.hpp"
 
 // detray include(s).
 #include "detray/propagator/actor_chain.hpp"
@@ -22,6 +23,10 @@
 #include "detray/propagator/actors/pointwise_material_interactor.hpp"
 #include "detray/propagator/propagator.hpp"
 
+// System include(s).
+#include <type_traits>
+#include <utility>
+
 namespace traccc {
 
 /// Kalman fitter algorithm to fit a single track
@@ -53,6 +58,17 @@ class kalman_fitter {
     // Detector type
     using detector_type = typename navigator_t::detector_type;
 
+    // Magnetic field type
+    using field_type = typename stepper_t::magnetic_field_type;
+
+    // Magnetic field type of the detector
+    using detector_field_type =
+        decltype(std::declval<const detector_type&>().get_bfield());
+
+    /// Whether the field of the fitter can be made from the detector's
+    static constexpr bool uses_detector_field =
+        std::is_constructible_v<field_type, detector_field_type>;
+
     // Actor types
     using aborter = detray::pathlimit_aborter;
     using transporter = detray::parameter_transporter<transform3_type>;
@@ -70,9 +86,26 @@ class kalman_fitter {
 
     /// Constructor with a detector
     ///
+    /// The tracks are propagated through the magnetic field of the detector.
+    /// Only available if @c field_type can be constructed from that field.
+    ///
     /// @param det the detector object
+    template <bool enable = uses_detector_field,
+              std::enable_if_t<enable, bool> = true>
+    TRACCC_HOST_DEVICE kalman_fitter(const detector_type& det)
+        : m_detector(det) {}
+
+    /// Constructor with a detector and a separate magnetic field
+    ///
+    /// Every propagation copies the field into its own state, so a field
+    /// with a lookup cache (like @c traccc::cached_field_map) starts afresh
+    /// on every track.
+    ///
+    /// @param det the detector object
+    /// @param field the magnetic field to propagate the tracks through
     TRACCC_HOST_DEVICE
-    kalman_fitter(const detector_type& det) : m_detector(det) {}
+    kalman_fitter(const detector_type& det, const field_type& field)
+        : m_detector(det), m_field(&field) {}
 
     /// Kalman fitter state
     struct state {
@@ -121,6 +154,8 @@ class kalman_fitter {
         const seed_parameters_t& seed_params, state& fitter_state,
         vector_type<intersection_type>&& nav_candidates = {}) {
 
+        fitter_state.m_fit_info.seed_params = seed_params;
+
         // Run the kalman filtering for a given number of iterations
         for (std::size_t i = 0; i < m_cfg.n_iterations; i++) {
 
@@ -161,7 +196,7 @@ class kalman_fitter {
 
         // Create propagator state
         typename propagator_type::state propagation(
-            seed_params, m_detector.get_bfield(), m_detector,
+            seed_params, get_field(), m_detector,
             std::move(nav_candidates));
 
         // Set overstep tolerance and stepper constraint
@@ -177,7 +212,9 @@ class kalman_fitter {
         // Run smoothing
         smooth(fitter_state);
 
-        //@todo: Write track info
+        // Write track info
+        update_fitter_info(fitter_state.m_fit_actor_state.m_track_states,
+                           fitter_state.m_fit_info);
     }
 
     /// Run smoothing after kalman filtering
@@ -200,6 +237,7 @@ class kalman_fitter {
         auto& last = track_states.back();
         last.smoothed().set_vector(last.filtered().vector());
         last.smoothed().set_covariance(last.filtered().covariance());
+        last.smoothed_chi2() = last.filtered_chi2();
 
         const auto& mask_store = m_detector.mask_store();
 
@@ -219,8 +257,22 @@ class kalman_fitter {
     }
 
     private:
+    /// @return the magnetic field to propagate the next track through
+    TRACCC_HOST_DEVICE
+    field_type get_field() const {
+        if constexpr (uses_detector_field) {
+            if (m_field == nullptr) {
+                return field_type(m_detector.get_bfield());
+            }
+        }
+        // Fields not held by the detector are always given to the fitter.
+        return *m_field;
+    }
+
     // Detector object
     const detector_type& m_detector;
+    // Magnetic field, if not the one of the detector
+    const field_type* m_field = nullptr;
     // Configuration object
     config m_cfg;
 };
@@ -0,0 +1,95 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/track_state.hpp"
+
+// System include(s).
+#include <cmath>
+
+namespace traccc {
+
+/// Probability of a chi square at least as large as @c chi2, for a given
+/// number of degrees of freedom
+///
+/// Uses the closed forms of the chi square survival function for integer
+/// degrees of freedom. Returns 1 for fits without any degree of freedom.
+///
+/// @param chi2 The chi square of the fit
+/// @param ndf The number of degrees of freedom of the fit
+///
+template <typename scalar_t>
+TRACCC_HOST_DEVICE inline scalar_t chi2_probability(scalar_t chi2,
+                                                    int ndf) {
+
+    if (ndf <= 0) {
+        return 1;
+    }
+    if (chi2 <= 0) {
+        return 1;
+    }
+
+    const scalar_t half_chi2 = chi2 / 2;
+    if (ndf % 2 == 0) {
+        // exp(-x/2) * sum_{i < ndf/2} (x/2)^i / i!
+        scalar_t term = 1;
+        scalar_t sum = 1;
+        for (int i = 1; i < ndf / 2; ++i) {
+            term *= half_chi2 / static_cast<scalar_t>(i);
+            sum += term;
+        }
+        return std::exp(-half_chi2) * sum;
+    }
+
+    // erfc(sqrt(x/2)) +
+    // sqrt(2/pi) * exp(-x/2) * sum_{j <= (ndf-1)/2} x^(j-1/2) / (2j-1)!!
+    const scalar_t sqrt_chi2 = std::sqrt(chi2);
+    scalar_t term = sqrt_chi2 * std::sqrt(static_cast<scalar_t>(2 / M_PI));
+    scalar_t sum = 0;
+    for (int j = 1; j <= (ndf - 1) / 2; ++j) {
+        sum += term;
+        term *= chi2 / static_cast<scalar_t>(2 * j + 1);
+    }
+    return std::erfc(sqrt_chi2 / std::sqrt(static_cast<scalar_t>(2))) +
+           std::exp(-half_chi2) * sum;
+}
+
+/// Fill the summary of a fitted track from its (smoothed) track states
+///
+/// The number of degrees of freedom is the number of measured local
+/// coordinates, minus the five fitted parameters (the time is not
+/// constrained by the measurements). The chi square is the sum of the
+/// filtered chi squares of the track states.
+///
+/// @param track_states The track states after the smoothing
+/// @param info The summary to fill, with its seed parameters already set
+///
+template <typename algebra_t, typename track_state_vector_t>
+TRACCC_HOST_DEVICE inline void update_fitter_info(
+    const track_state_vector_t& track_states, fitter_info<algebra_t>& info) {
+
+    using scalar_type = typename algebra_t::scalar_type;
+
+    scalar_type chi2 = 0;
+    int ndf = -5;
+    for (const track_state<algebra_t>& state : track_states) {
+        chi2 += state.filtered_chi2();
+        ndf += 2;
+    }
+
+    if (track_states.size() > 0) {
+        info.fit_params = track_states[0].smoothed();
+    }
+    info.ndf = static_cast<scalar_type>(ndf);
+    info.chi2 = chi2;
+    info.p_val = chi2_probability(chi2, ndf);
+}
+
+}  // namespace traccc
@@ -7,6 +7,9 @@
 
 #pragma once
 
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+
 // Acts include(s).
 #include <Acts/Geometry/GeometryHierarchyMap.hpp>
 #include <Acts/Utilities/BinUtility.hpp>
@@ -15,7 +18,10 @@ namespace traccc {
 
 /// Type describing the digitization configuration of a detector module
 struct module_digitization_config {
+    /// The pixel segmentation of the module
     Acts::BinUtility segmentation;
+    /// The activation threshold of the cells of the module
+    scalar threshold = 0;
 };
 
 /// Type describing the digitization configuration for the whole detector
@@ -0,0 +1,119 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+namespace traccc {
+
+/// Per-event work budget for the seed finding
+///
+/// The seed finding first counts the doublets and the triplet candidates
+/// (middle-bottom times middle-top doublet combinations) of every middle
+/// spacepoint. If the counts are above the budget, @c deltaRMax and
+/// @c impactMax are tightened step by step. If that is still not enough,
+/// the number of doublets considered per middle spacepoint is capped,
+/// keeping the doublets that point closest to the beam line. If the event
+/// is over budget even then, the seed finding reports it, or throws if no
+/// report was asked for.
+///
+/// A limit of zero means "no limit".
+///
+struct seeding_budget {
+
+    // maximum number of middle-bottom plus middle-top doublets per event
+    std::size_t max_doublets = 0;
+    // maximum number of triplet candidates per event
+    std::size_t max_triplet_candidates = 0;
+    // factor deltaRMax and impactMax are multiplied with in each step
+    scalar tightening_factor = 0.8;
+    // maximum number of tightening steps
+    unsigned int max_tightening_steps = 3;
+    // maximum number of middle-bottom and middle-top doublets (each) per
+    // middle spacepoint, applied if tightening was not enough
+    unsigned int max_doublets_per_spM = 50;
+
+    /// Check whether any limit is set
+    TRACCC_HOST_DEVICE
+    bool enabled() const {
+        return (max_doublets > 0) || (max_triplet_candidates > 0);
+    }
+
+    /// Check whether a doublet count is above the budget
+    TRACCC_HOST_DEVICE
+    bool doublets_exceeded(std::size_t n_doublets) const {
+        return (max_doublets > 0) && (n_doublets > max_doublets);
+    }
+
+    /// Check whether a triplet candidate count is above the budget
+    TRACCC_HOST_DEVICE
+    bool triplets_exceeded(std::size_t n_triplet_candidates) const {
+        return (max_triplet_candidates > 0) &&
+               (n_triplet_candidates > max_triplet_candidates);
+    }
+
+    /// Tighten a seed finder configuration by one step
+    seedfinder_config tighten(const seedfinder_config& config) const {
+        seedfinder_config result = config;
+        result.deltaRMax *= tightening_factor;
+        result.impactMax *= tightening_factor;
+        return result;
+    }
+};
+
+/// Summary of what the seed finding did to stay within its budget
+struct seeding_budget_report {
+
+    // number of doublets counted with the original configuration
+    std::size_t initial_doublets = 0;
+    // number of triplet candidates counted with the original configuration
+    std::size_t initial_triplet_candidates = 0;
+    // number of doublets counted with the final configuration (and cap)
+    std::size_t final_doublets = 0;
+    // number of triplet candidates counted with the final configuration (and
+    // cap)
+    std::size_t final_triplet_candidates = 0;
+    // number of tightening steps applied
+    unsigned int tightening_steps = 0;
+    // deltaRMax used in the end (internal units)
+    scalar deltaRMax = 0;
+    // impactMax used in the end (internal units)
+    scalar impactMax = 0;
+    // number of middle spacepoints that had their doublets capped (only
+    // filled by the host algorithm)
+    std::size_t capped_spMs = 0;
+    // whether the budget was still exceeded after tightening and capping
+    bool exceeded = false;
+};
+
+/// Throw if the seed finding stayed over its budget
+///
+/// Used by the seed finding overloads that do not hand a report to their
+/// caller, so that an event over budget does not go unnoticed.
+///
+/// @param report The report filled by the seed finding
+///
+inline void check_budget(const seeding_budget_report& report) {
+    if (report.exceeded) {
+        throw std::runtime_error(
+            "Seed finding stayed over its work budget, with " +
+            std::to_string(report.final_doublets) + " doublets and " +
+            std::to_string(report.final_triplet_candidates) +
+            " triplet candidates");
+    }
+}
+
+}  // namespace traccc
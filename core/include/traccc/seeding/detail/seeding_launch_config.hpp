@@ -0,0 +1,30 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+namespace traccc {
+
+/// Kernel launch sizes of the device seeding algorithms
+///
+/// The best values depend on the device that the seeding runs on, so they
+/// are meant to be tuned per device, for instance with the autotuning mode
+/// of the throughput applications.
+///
+struct seeding_launch_config {
+
+    /// Number of threads per block in the spacepoint binning kernels
+    unsigned int binning_block_size = 256;
+    /// Number of threads per block in the seed finding kernels
+    ///
+    /// The weight updating and seed selecting kernels use shared memory
+    /// proportional to this number, which limits how large it can be.
+    ///
+    unsigned int finding_block_size = 64;
+};
+
+}  // namespace traccc
@@ -0,0 +1,87 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/container.hpp"
+#include "traccc/edm/internal_spacepoint.hpp"
+#include "traccc/edm/spacepoint.hpp"
+
+// System include(s).
+#include <cmath>
+
+namespace traccc {
+
+/// Region of interest for restricted (trigger-style) seeding
+///
+/// A seed is considered to be inside of the region if its middle spacepoint
+/// is. The coordinates are the ones of the internal spacepoints, i.e. they
+/// are understood relative to the beam position in the transverse plane.
+///
+/// If @c phi_min is larger than @c phi_max, the region is taken to wrap
+/// around the +/-pi boundary.
+///
+struct seeding_roi {
+
+    scalar eta_min = -10.;
+    scalar eta_max = 10.;
+    scalar phi_min = -M_PI;
+    scalar phi_max = M_PI;
+    scalar z_min = -1e5;
+    scalar z_max = 1e5;
+
+    /// Check whether a (middle) spacepoint is inside of the region
+    TRACCC_HOST_DEVICE
+    bool contains(const internal_spacepoint<spacepoint>& sp) const {
+
+        // Check the Z coordinate.
+        if ((sp.z() < z_min) || (sp.z() > z_max)) {
+            return false;
+        }
+        // Check the Phi coordinate, taking wrap-around into account.
+        const scalar phi = sp.phi();
+        if (phi_min <= phi_max) {
+            if ((phi < phi_min) || (phi > phi_max)) {
+                return false;
+            }
+        } else if ((phi < phi_min) && (phi > phi_max)) {
+            return false;
+        }
+        // Check the pseudorapidity, without computing it explicitly. Since
+        // z = r * sinh(eta), this is a monotonic comparison.
+        const scalar r = sp.radius();
+        return ((sp.z() >= r * std::sinh(eta_min)) &&
+                (sp.z() <= r * std::sinh(eta_max)));
+    }
+
+};  // struct seeding_roi
+
+/// Declare all seeding RoI collection types
+using seeding_roi_collection_types = collection_types<seeding_roi>;
+
+/// Check whether a spacepoint is inside of any of a list of regions
+///
+/// @param rois The regions of interest (host or device collection)
+/// @param sp The (middle) spacepoint to check
+/// @return @c true if the spacepoint is inside of at least one region
+///
+template <typename roi_collection_t>
+TRACCC_HOST_DEVICE inline bool is_in_any_roi(
+    const roi_collection_t& rois, const internal_spacepoint<spacepoint>& sp) {
+
+    for (unsigned int i = 0; i < rois.size(); ++i) {
+        if (rois[i].contains(sp)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace traccc
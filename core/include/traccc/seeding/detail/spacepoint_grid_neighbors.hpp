@@ -0,0 +1,178 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/container.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+
+namespace traccc {
+
+/// Collection types used by the neighbour bin tables of spacepoint grids
+using sp_grid_neighbor_collection_types = collection_types<unsigned int>;
+
+/// Precomputed neighbourhoods of all bins of a Phi-Z spacepoint grid
+///
+/// For every (global) bin of the grid, the table holds the global indices of
+/// all the bins that the doublet finding has to look at for the middle
+/// spacepoints in that bin, including the wrap-around of the Phi axis. The
+/// neighbourhoods are stored in a single flat array, with the neighbours of
+/// bin @c i at the positions <tt>[offsets[i], offsets[i + 1])</tt>.
+///
+/// The neighbours of each bin are ordered in the same way in which the
+/// doublet finding visited them with @c detray::axis::circular::zone and
+/// @c detray::axis::regular::zone. So the doublets are found in the same
+/// order as without the table.
+///
+/// A single table serves both the middle-bottom and the middle-top doublet
+/// finding. Both of them look at the same neighbourhood, set by
+/// @c traccc::seedfinder_config::neighbor_scope, and decide only per
+/// spacepoint (with @c traccc::doublet_finding_helper::isCompatible) whether
+/// it is a bottom or a top candidate. Separate bottom and top tables would
+/// hold identical bins, unless the two searches got their own scopes.
+///
+struct sp_grid_neighbors {
+    /// Offsets of the neighbourhoods of the bins in @c bins (n_bins + 1)
+    sp_grid_neighbor_collection_types::host offsets;
+    /// The global indices of the neighbour bins of all grid bins
+    sp_grid_neighbor_collection_types::host bins;
+};
+
+/// View of a neighbour bin table
+struct sp_grid_neighbors_view {
+    /// Offsets of the neighbourhoods of the bins in @c bins
+    sp_grid_neighbor_collection_types::const_view offsets;
+    /// The global indices of the neighbour bins of all grid bins
+    sp_grid_neighbor_collection_types::const_view bins;
+};
+
+/// Buffer holding a neighbour bin table (in device memory)
+struct sp_grid_neighbors_buffer {
+    /// Offsets of the neighbourhoods of the bins in @c bins
+    sp_grid_neighbor_collection_types::buffer offsets;
+    /// The global indices of the neighbour bins of all grid bins
+    sp_grid_neighbor_collection_types::buffer bins;
+
+    /// Get a view of the buffer
+    operator sp_grid_neighbors_view() const { return {offsets, bins}; }
+};
+
+/// Get a view of a host neighbour bin table
+inline sp_grid_neighbors_view get_data(const sp_grid_neighbors& table) {
+    return {vecmem::get_data(table.offsets), vecmem::get_data(table.bins)};
+}
+
+/// Accessor for the neighbourhoods stored in a neighbour bin table
+///
+/// It can be used both in host and in device code.
+///
+class sp_grid_neighbors_device {
+
+    public:
+    /// Construct the accessor from a view of the table
+    TRACCC_HOST_DEVICE
+    explicit sp_grid_neighbors_device(const sp_grid_neighbors_view& view)
+        : m_offsets(view.offsets), m_bins(view.bins) {}
+
+    /// Get the number of neighbour bins of a grid bin
+    ///
+    /// @param bin The global index of the grid bin
+    ///
+    TRACCC_HOST_DEVICE
+    unsigned int size(unsigned int bin) const {
+        assert(bin + 1 < m_offsets.size());
+        return m_offsets[bin + 1] - m_offsets[bin];
+    }
+
+    /// Get the global index of one of the neighbour bins of a grid bin
+    ///
+    /// @param bin The global index of the grid bin
+    /// @param i The index of the neighbour bin, smaller than @c size(bin)
+    ///
+    TRACCC_HOST_DEVICE
+    unsigned int neighbor(unsigned int bin, unsigned int i) const {
+        assert(i < size(bin));
+        return m_bins[m_offsets[bin] + i];
+    }
+
+    private:
+    /// Offsets of the neighbourhoods of the bins
+    sp_grid_neighbor_collection_types::const_device m_offsets;
+    /// The global indices of the neighbour bins
+    sp_grid_neighbor_collection_types::const_device m_bins;
+
+};  // class sp_grid_neighbors_device
+
+/// Build the neighbour bin table for a Phi-Z spacepoint grid
+///
+/// The neighbourhood of a bin is @c scope[0] bins below and @c scope[1]
+/// bins above it along both axes. The Phi axis wraps around, while the
+/// Z axis is cut at its edges.
+///
+/// @param n_phi The number of bins on the (circular) Phi axis
+/// @param n_z The number of bins on the (regular) Z axis
+/// @param scope The neighbourhood to use along both axes
+/// @param mr The memory resource to create the table with (the default one
+///           if @c nullptr)
+/// @return The neighbour bin table of the grid
+///
+inline sp_grid_neighbors make_sp_grid_neighbors(
+    unsigned int n_phi, unsigned int n_z,
+    const darray<unsigned long, 2>& scope,
+    vecmem::memory_resource* mr = nullptr) {
+
+    const int n_phi_int = static_cast<int>(n_phi);
+    const int scope_low = static_cast<int>(scope[0]);
+    const int scope_high = static_cast<int>(scope[1]);
+    // Never visit the same Phi bin twice, even for very wide neighbourhoods.
+    const int phi_width = std::min(scope_low + scope_high + 1, n_phi_int);
+
+    sp_grid_neighbors result =
+        (mr != nullptr)
+            ? sp_grid_neighbors{sp_grid_neighbor_collection_types::host{mr},
+                                sp_grid_neighbor_collection_types::host{mr}}
+            : sp_grid_neighbors{};
+    result.offsets.reserve(n_phi * n_z + 1);
+    result.bins.reserve(n_phi * n_z * phi_width * (scope_low + scope_high + 1));
+    result.offsets.push_back(0u);
+
+    // Bins are visited in the order of their global index, which is
+    // phi_bin + z_bin * n_phi.
+    for (unsigned int z_bin = 0; z_bin < n_z; ++z_bin) {
+        const int z_first = std::max(static_cast<int>(z_bin) - scope_low, 0);
+        const int z_last = std::min(static_cast<int>(z_bin) + scope_high,
+                                    static_cast<int>(n_z) - 1);
+        for (unsigned int phi_bin = 0; phi_bin < n_phi; ++phi_bin) {
+            const int phi_first =
+                ((static_cast<int>(phi_bin) - scope_low) % n_phi_int +
+                 n_phi_int) %
+                n_phi_int;
+            for (int dphi = 0; dphi < phi_width; ++dphi) {
+                const int phi_nb = (phi_first + dphi) % n_phi_int;
+                for (int z_nb = z_first; z_nb <= z_last; ++z_nb) {
+                    result.bins.push_back(
+                        static_cast<unsigned int>(phi_nb + z_nb * n_phi_int));
+                }
+            }
+            result.offsets.push_back(
+                static_cast<unsigned int>(result.bins.size()));
+        }
+    }
+
+    return result;
+}
+
+}  // namespace traccc
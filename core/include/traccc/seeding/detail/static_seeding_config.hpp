@@ -0,0 +1,224 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+
+// Acts include(s).
+#include <Acts/Definitions/Units.hpp>
+
+// System include(s).
+#include <cmath>
+#include <cstddef>
+
+namespace traccc {
+namespace details {
+
+/// Square root that can be evaluated at compile time
+constexpr double constexpr_sqrt(double x) {
+
+    if (x <= 0.) {
+        return 0.;
+    }
+    double result = (x > 1.) ? x : 1.;
+    for (int i = 0; i < 100; ++i) {
+        const double next = 0.5 * (result + x / result);
+        if (next == result) {
+            break;
+        }
+        result = next;
+    }
+    return result;
+}
+
+/// Natural logarithm that can be evaluated at compile time (for x > 0)
+constexpr double constexpr_log(double x) {
+
+    // Bring x into [0.5, 1], and then use ln(x) = 2 * atanh((x-1)/(x+1)).
+    constexpr double ln2 = 0.693147180559945309417;
+    int exponent = 0;
+    while (x > 1.) {
+        x /= 2.;
+        ++exponent;
+    }
+    while (x < 0.5) {
+        x *= 2.;
+        --exponent;
+    }
+    const double z = (x - 1.) / (x + 1.);
+    const double z2 = z * z;
+    double term = z;
+    double sum = 0.;
+    for (int n = 1; n < 100; n += 2) {
+        sum += term / n;
+        term *= z2;
+    }
+    return 2. * sum + exponent * ln2;
+}
+
+}  // namespace details
+
+/// The default seed finder parameters, usable at compile time
+///
+/// The values are the defaults of @c traccc::seedfinder_config, in the
+/// internal units that the seed finding algorithms use (see
+/// @c traccc::seedfinder_config::toInternalUnits): millimetres, MeV and
+/// kilotesla. To describe a different detector setup, derive from this type
+/// and override the members that need to change.
+///
+struct default_seedfinder_parameters {
+
+    static constexpr scalar zMin = -1186.;
+    static constexpr scalar zMax = 1186.;
+    static constexpr scalar rMax = 200.;
+    static constexpr scalar rMin = 33.;
+
+    static constexpr scalar collisionRegionMin = -250.;
+    static constexpr scalar collisionRegionMax = +250.;
+    static constexpr scalar phiMin = -M_PI;
+    static constexpr scalar phiMax = M_PI;
+
+    static constexpr scalar minPt = 500.;
+    static constexpr scalar cotThetaMax = 7.40627;
+    static constexpr scalar deltaRMin = 1.;
+    static constexpr scalar deltaRMax = 60.;
+
+    static constexpr scalar impactMax = 10.;
+    static constexpr scalar sigmaScattering = 1.0;
+    static constexpr scalar maxPtScattering = 10000.;
+
+    static constexpr int maxSeedsPerSpM = 20;
+
+    static constexpr scalar bFieldInZ = 1.99724 / 1000.;
+
+    static constexpr scalar radLengthPerSeed = 0.05;
+    static constexpr scalar zAlign = 0.;
+    static constexpr scalar rAlign = 0.;
+    static constexpr scalar sigmaError = 5;
+
+    static constexpr int phiBinDeflectionCoverage = 1;
+
+    static constexpr darray<unsigned long, 2> neighbor_scope{1, 1};
+};
+
+/// Seed finder configuration known at compile time
+///
+/// Can be used in place of a (internal unit) @c traccc::seedfinder_config
+/// with the seeding helper functions, and the algorithms built on top of
+/// them. Since all members are compile time constants, the compiler can fold
+/// them into the compatibility checks, instead of reloading them from memory
+/// in every iteration.
+///
+/// The derived values are calculated the same way as the seeding algorithms
+/// calculate them for a runtime configuration.
+///
+/// @tparam parameters_t Type providing the parameters of the seed finder as
+///                      static constexpr members, like
+///                      @c traccc::default_seedfinder_parameters
+///
+template <typename parameters_t = default_seedfinder_parameters>
+struct static_seedfinder_config : public parameters_t {
+
+    // derived values
+    static constexpr scalar highland = static_cast<scalar>(
+        13.6 * details::constexpr_sqrt(parameters_t::radLengthPerSeed) *
+        (1 + 0.038 * details::constexpr_log(parameters_t::radLengthPerSeed)));
+    static constexpr scalar maxScatteringAngle2 =
+        (highland / parameters_t::minPt) * (highland / parameters_t::minPt);
+    static constexpr scalar pTPerHelixRadius = 300. * parameters_t::bFieldInZ;
+    static constexpr scalar minHelixDiameter2 =
+        (parameters_t::minPt * 2 / pTPerHelixRadius) *
+        (parameters_t::minPt * 2 / pTPerHelixRadius);
+    static constexpr scalar pT2perRadius =
+        (highland / pTPerHelixRadius) * (highland / pTPerHelixRadius);
+
+    TRACCC_HOST_DEVICE
+    static constexpr unsigned int get_max_neighbor_bins() {
+        return (parameters_t::neighbor_scope[0] +
+                parameters_t::neighbor_scope[1] + 1) *
+               (parameters_t::neighbor_scope[0] +
+                parameters_t::neighbor_scope[1] + 1);
+    }
+
+    /// Create the equivalent runtime configuration
+    ///
+    /// The result is in the units of the user-facing
+    /// @c traccc::seedfinder_config, so it can be given to the seeding
+    /// algorithms like any other configuration.
+    ///
+    static seedfinder_config runtime_config() {
+
+        using namespace Acts::UnitLiterals;
+        seedfinder_config config;
+        config.zMin = parameters_t::zMin * 1_mm;
+        config.zMax = parameters_t::zMax * 1_mm;
+        config.rMax = parameters_t::rMax * 1_mm;
+        config.rMin = parameters_t::rMin * 1_mm;
+        config.collisionRegionMin = parameters_t::collisionRegionMin * 1_mm;
+        config.collisionRegionMax = parameters_t::collisionRegionMax * 1_mm;
+        config.phiMin = parameters_t::phiMin;
+        config.phiMax = parameters_t::phiMax;
+        config.minPt = parameters_t::minPt * 1_MeV;
+        config.cotThetaMax = parameters_t::cotThetaMax;
+        config.deltaRMin = parameters_t::deltaRMin * 1_mm;
+        config.deltaRMax = parameters_t::deltaRMax * 1_mm;
+        config.impactMax = parameters_t::impactMax * 1_mm;
+        config.sigmaScattering = parameters_t::sigmaScattering;
+        config.maxPtScattering = parameters_t::maxPtScattering * 1_MeV;
+        config.maxSeedsPerSpM = parameters_t::maxSeedsPerSpM;
+        config.bFieldInZ = parameters_t::bFieldInZ * 1000. * 1_T;
+        config.radLengthPerSeed = parameters_t::radLengthPerSeed;
+        config.zAlign = parameters_t::zAlign * 1_mm;
+        config.rAlign = parameters_t::rAlign * 1_mm;
+        config.sigmaError = parameters_t::sigmaError;
+        config.phiBinDeflectionCoverage =
+            parameters_t::phiBinDeflectionCoverage;
+        config.neighbor_scope = parameters_t::neighbor_scope;
+
+        config.highland = highland;
+        config.maxScatteringAngle2 = maxScatteringAngle2;
+        config.pTPerHelixRadius = pTPerHelixRadius;
+        config.minHelixDiameter2 = minHelixDiameter2;
+        config.pT2perRadius = pT2perRadius;
+        return config;
+    }
+};
+
+/// Seed filter configuration known at compile time
+///
+/// Holds the defaults of @c traccc::seedfilter_config, in internal units
+/// (see @c traccc::seedfilter_config::toInternalUnits). To describe a
+/// different setup, derive from this type and override the members that
+/// need to change.
+///
+struct static_seedfilter_config {
+
+    static constexpr scalar deltaInvHelixDiameter = 0.00003;
+    static constexpr scalar impactWeightFactor = 1.;
+    static constexpr scalar compatSeedWeight = 200.;
+    static constexpr scalar deltaRMin = 5.;
+    static constexpr unsigned int maxSeedsPerSpM = 20;
+    static constexpr std::size_t compatSeedLimit = 2;
+
+    static constexpr std::size_t max_triplets_per_spM = 5;
+
+    static constexpr scalar good_spB_min_radius = 150.;
+    static constexpr scalar good_spB_weight_increase = 400.;
+    static constexpr scalar good_spT_max_radius = 150.;
+    static constexpr scalar good_spT_weight_increase = 200.;
+
+    static constexpr scalar good_spB_min_weight = 380;
+
+    static constexpr scalar seed_min_weight = 200;
+    static constexpr scalar spB_min_radius = 43.;
+};
+
+}  // namespace traccc
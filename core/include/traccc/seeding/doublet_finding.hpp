@@ -11,6 +11,7 @@
 #include "traccc/seeding/detail/doublet.hpp"
 #include "traccc/seeding/detail/singlet.hpp"
 #include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_grid_neighbors.hpp"
 #include "traccc/seeding/detail/spacepoint_type.hpp"
 #include "traccc/seeding/doublet_finding_helper.hpp"
 #include "traccc/utils/algorithm.hpp"
@@ -19,7 +20,9 @@ namespace traccc {
 
 /// Doublet finding to search the combinations of two compatible spacepoints
 /// @tparam otherSpType is whether it is for middle-bottom or middle-top doublet
-template <details::spacepoint_type otherSpType>
+/// @tparam config_t is the (runtime or compile time) seed finder configuration
+template <details::spacepoint_type otherSpType,
+          typename config_t = seedfinder_config>
 struct doublet_finding
     : public algorithm<std::pair<doublet_collection_types::host,
                                  lin_circle_collection_types::host>(
@@ -32,7 +35,7 @@ struct doublet_finding
     ///
     /// @param seedfinder_config is the configuration parameters
     /// @param isp_container is the internal spacepoint container
-    doublet_finding(const seedfinder_config& config) : m_config(config) {}
+    doublet_finding(const config_t& config) : m_config(config) {}
 
     /// Callable operator for doublet finding per middle spacepoint
     ///
@@ -97,8 +100,48 @@ struct doublet_finding
         }
     }
 
+    /// Callable operator for doublet finding of a middle spacepoint, using
+    /// precomputed bin neighbourhoods
+    ///
+    /// @param g2 is the spacepoint grid
+    /// @param neighbors are the neighbour bins of all bins of @c g2
+    /// @param l is the location of the current middle spacepoint in the grid
+    /// @param o are the doublets and transformed coordinates to fill
+    ///
+    void operator()(const sp_grid& g2,
+                    const sp_grid_neighbors_device& neighbors,
+                    const sp_location& l, output_type& o) const {
+        // output
+        auto& doublets = o.first;
+        auto& lin_circles = o.second;
+
+        // middle spacepoint
+        const auto& spM = g2.bin(l.bin_idx)[l.sp_idx];
+
+        // iterator over neighbor bins
+        const unsigned int n_neighbors = neighbors.size(l.bin_idx);
+        for (unsigned int i = 0; i < n_neighbors; ++i) {
+            const unsigned int bin_idx = neighbors.neighbor(l.bin_idx, i);
+
+            const auto& sps = g2.bin(bin_idx);
+            for (unsigned int sp_idx = 0; sp_idx < sps.size(); sp_idx++) {
+                const auto& sp_nb = sps[sp_idx];
+
+                if (!doublet_finding_helper::isCompatible<otherSpType>(
+                        spM, sp_nb, m_config)) {
+                    continue;
+                }
+
+                lin_circle lin = doublet_finding_helper::transform_coordinates<
+                    otherSpType>(spM, sp_nb);
+                doublets.push_back(doublet({l, {bin_idx, sp_idx}}));
+                lin_circles.push_back(std::move(lin));
+            }
+        }
+    }
+
     private:
-    seedfinder_config m_config;
+    config_t m_config;
 };
 
 }  // namespace traccc
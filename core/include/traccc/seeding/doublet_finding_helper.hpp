@@ -24,13 +24,14 @@ struct doublet_finding_helper {
     /// @param config is configuration parameter
     /// @tparam otherSpType is whether it is for middle-bottom or middle-top
     /// doublet
+    /// @tparam config_t is @c traccc::seedfinder_config or
+    /// @c traccc::static_seedfinder_config
     ///
     /// @return boolean value for compatibility
-    template <details::spacepoint_type otherSpType>
+    template <details::spacepoint_type otherSpType, typename config_t>
     static inline TRACCC_HOST_DEVICE bool isCompatible(
         const internal_spacepoint<spacepoint>& sp1,
-        const internal_spacepoint<spacepoint>& sp2,
-        const seedfinder_config& config);
+        const internal_spacepoint<spacepoint>& sp2, const config_t& config);
 
     /// Do the conformal transformation on doublet's coordinate
     ///
@@ -46,11 +47,10 @@ struct doublet_finding_helper {
                           const internal_spacepoint<spacepoint>& sp2);
 };
 
-template <details::spacepoint_type otherSpType>
+template <details::spacepoint_type otherSpType, typename config_t>
 bool doublet_finding_helper::isCompatible(
     const internal_spacepoint<spacepoint>& sp1,
-    const internal_spacepoint<spacepoint>& sp2,
-    const seedfinder_config& config) {
+    const internal_spacepoint<spacepoint>& sp2, const config_t& config) {
 
     static_assert(otherSpType == details::spacepoint_type::bottom ||
                   otherSpType == details::spacepoint_type::top);
@@ -10,16 +10,30 @@
 // Project include(s).
 #include "traccc/edm/seed.hpp"
 #include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/seeding_budget.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/seeding/detail/seeding_roi.hpp"
 #include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_grid_neighbors.hpp"
 #include "traccc/seeding/doublet_finding.hpp"
 #include "traccc/seeding/seed_filtering.hpp"
 #include "traccc/seeding/triplet_finding.hpp"
 #include "traccc/utils/algorithm.hpp"
 
+// System include(s).
+#include <array>
+#include <memory>
+#include <mutex>
+#include <utility>
+
 namespace traccc {
 
 /// Seed finding
+///
+/// For a fixed detector setup, @c traccc::static_seed_finding can run the
+/// same seed finding with a compile time configuration, without the
+/// per-event work budget.
+///
 class seed_finding
     : public algorithm<seed_collection_types::host(
           const spacepoint_container_types::host&, const sp_grid&)> {
@@ -29,12 +43,20 @@ class seed_finding
     ///
     /// @param find_config is seed finder configuration parameters
     /// @param filter_config is the seed filter configuration
+    /// @param budget is the per-event work budget (unlimited by default)
     ///
     seed_finding(const seedfinder_config& find_config,
-                 const seedfilter_config& filter_config);
+                 const seedfilter_config& filter_config,
+                 const seeding_budget& budget = {});
 
     /// Callable operator for the seed finding
     ///
+    /// If a work budget was given to the algorithm, it is applied the same
+    /// way as in the overload taking a @c traccc::seeding_budget_report.
+    /// Since the caller has no other way to learn about it, an event that
+    /// stays over budget even after tightening and capping results in a
+    /// @c std::runtime_error.
+    ///
     /// @param sp_container All spacepoints in the event
     /// @param g2 The same spacepoints arranged in a 2D Phi-Z grid
     /// @return seed_collection is the vector of seeds per event
@@ -42,16 +64,127 @@ class seed_finding
     output_type operator()(const spacepoint_container_types::host& sp_container,
                            const sp_grid& g2) const override;
 
+    /// Callable operator for the seed finding within the work budget
+    ///
+    /// The doublets and triplet candidates of all middle spacepoints are
+    /// counted first. While the counts are above the budget, @c deltaRMax and
+    /// @c impactMax are tightened and the counting is repeated. If the
+    /// maximal number of tightening steps did not help, the number of
+    /// doublets per middle spacepoint is capped in the seed finding, keeping
+    /// the doublets that point closest to the beam line. Whether the event
+    /// stayed over budget even then is recorded in the report.
+    ///
+    /// @param sp_container All spacepoints in the event
+    /// @param g2 The same spacepoints arranged in a 2D Phi-Z grid
+    /// @param report Summary of what was done to stay within the budget
+    /// @return seed_collection is the vector of seeds per event
+    ///
+    output_type operator()(const spacepoint_container_types::host& sp_container,
+                           const sp_grid& g2,
+                           seeding_budget_report& report) const;
+
+    /// Callable operator for the seed finding in regions of interest
+    ///
+    /// Only middle spacepoints inside of at least one of the regions are
+    /// considered. The result is identical to filtering the output of the
+    /// full seed finding on the middle spacepoints of the seeds, as long as
+    /// the grid holds all spacepoints in the neighbourhood of the regions.
+    ///
+    /// @param sp_container All spacepoints in the event
+    /// @param g2 The same spacepoints arranged in a 2D Phi-Z grid
+    /// @param rois The regions of interest to find seeds in
+    /// @return seed_collection is the vector of seeds per event
+    ///
+    output_type operator()(const spacepoint_container_types::host& sp_container,
+                           const sp_grid& g2,
+                           const seeding_roi_collection_types::host& rois) const;
+
     private:
+    /// Find the seeds belonging to one middle spacepoint
+    ///
+    /// @param sp_container All spacepoints in the event
+    /// @param g2 The same spacepoints arranged in a 2D Phi-Z grid
+    /// @param neighbors The neighbour bins of all bins of @c g2
+    /// @param spM_location The location of the middle spacepoint in the grid
+    /// @param seeds The collection to add the found seeds to
+    ///
+    void find_seeds(const spacepoint_container_types::host& sp_container,
+                    const sp_grid& g2,
+                    const sp_grid_neighbors_device& neighbors,
+                    const sp_location& spM_location, output_type& seeds) const;
+
+    /// Find the seeds belonging to one middle spacepoint, with explicitly
+    /// provided sub-algorithms
+    ///
+    /// @param midBot_finding The mid bottom doublet finding to use
+    /// @param midTop_finding The mid top doublet finding to use
+    /// @param triplet_finder The triplet finding to use
+    /// @param max_doublets The maximal number of middle-bottom and
+    ///                     middle-top doublets to use (0 means no limit),
+    ///                     keeping the ones pointing closest to the beam line
+    /// @param sp_container All spacepoints in the event
+    /// @param g2 The same spacepoints arranged in a 2D Phi-Z grid
+    /// @param neighbors The neighbour bins of all bins of @c g2
+    /// @param spM_location The location of the middle spacepoint in the grid
+    /// @param seeds The collection to add the found seeds to
+    /// @return @c true if the doublets of the spacepoint had to be capped
+    ///
+    bool find_seeds(
+        const doublet_finding<details::spacepoint_type::bottom>& midBot_finding,
+        const doublet_finding<details::spacepoint_type::top>& midTop_finding,
+        const triplet_finding<>& triplet_finder, unsigned int max_doublets,
+        const spacepoint_container_types::host& sp_container, const sp_grid& g2,
+        const sp_grid_neighbors_device& neighbors,
+        const sp_location& spM_location, output_type& seeds) const;
+
+    /// Count the doublets and triplet candidates of all middle spacepoints
+    ///
+    /// Only middle spacepoints with both middle-bottom and middle-top
+    /// doublets are counted, as the others do not lead to any further work.
+    ///
+    /// @param config The seed finder configuration to use
+    /// @param g2 The spacepoints arranged in a 2D Phi-Z grid
+    /// @param neighbors The neighbour bins of all bins of @c g2
+    /// @param max_doublets The cap on the middle-bottom and middle-top
+    ///                     doublets of each middle spacepoint (0 means none)
+    /// @return The number of doublets and the number of triplet candidates
+    ///
+    static std::pair<std::size_t, std::size_t> count_candidates(
+        const seedfinder_config& config, const sp_grid& g2,
+        const sp_grid_neighbors_device& neighbors,
+        unsigned int max_doublets = 0u);
+
+    /// Get the neighbour bin table for the shape of a spacepoint grid
+    ///
+    /// The table is only built on the first call, and again if the shape of
+    /// the grid changes.
+    ///
+    /// @param g2 The spacepoint grid to get the table for
+    /// @return The neighbour bin table of the grid
+    ///
+    std::shared_ptr<const sp_grid_neighbors> get_neighbors(
+        const sp_grid& g2) const;
+
+    /// Seed finder configuration, in internal units
+    seedfinder_config m_config;
+    /// Per-event work budget
+    seeding_budget m_budget;
     /// Algorithm performing the mid bottom doublet finding
     doublet_finding<details::spacepoint_type::bottom> m_midBot_finding;
     /// Algorithm performing the mid top doublet finding
     doublet_finding<details::spacepoint_type::top> m_midTop_finding;
     /// Algorithm performing the triplet finding
-    triplet_finding m_triplet_finding;
+    triplet_finding<> m_triplet_finding;
     /// Algorithm performing the seed selection
     seed_filtering m_seed_filtering;
 
+    /// Mutex protecting the neighbour bin table
+    mutable std::mutex m_neighbors_mutex;
+    /// The (Phi, Z) shape of the grid that the neighbour bin table is for
+    mutable std::array<unsigned int, 2> m_neighbors_shape{0u, 0u};
+    /// Neighbour bin table of the grids seen by the algorithm
+    mutable std::shared_ptr<const sp_grid_neighbors> m_neighbors;
+
 };  // class seed_finding
 
 }  // namespace traccc
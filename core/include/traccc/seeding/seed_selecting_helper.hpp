@@ -23,8 +23,9 @@ struct seed_selecting_helper {
     /// @param spB is bottom (internal) spacepoint
     /// @param spT is top (internal) spacepoint
     /// @param triplet_weight is the weight of triplet to be updated
+    template <typename filter_config_t>
     static TRACCC_HOST_DEVICE void seed_weight(
-        const seedfilter_config& filter_config,
+        const filter_config_t& filter_config,
         const internal_spacepoint<spacepoint>&,
         const internal_spacepoint<spacepoint>& spB,
         const internal_spacepoint<spacepoint>& spT, scalar& triplet_weight) {
@@ -50,8 +51,9 @@ struct seed_selecting_helper {
     /// @param triplet_weight is the weight of triplet
     ///
     /// @return boolean value
+    template <typename filter_config_t>
     static TRACCC_HOST_DEVICE bool single_seed_cut(
-        const seedfilter_config& filter_config,
+        const filter_config_t& filter_config,
         const internal_spacepoint<spacepoint>&,
         const internal_spacepoint<spacepoint>& spB,
         const internal_spacepoint<spacepoint>&, const scalar& triplet_weight) {
@@ -67,9 +69,9 @@ struct seed_selecting_helper {
     /// @param triplet_weight is the weight of triplet
     ///
     /// @return boolean value
-    template <typename spacepoint_container_t>
+    template <typename filter_config_t, typename spacepoint_container_t>
     static TRACCC_HOST_DEVICE bool cut_per_middle_sp(
-        const seedfilter_config& filter_config,
+        const filter_config_t& filter_config,
         const spacepoint_container_t& sp_container, const seed& seed,
         const scalar& triplet_weight) {
 
@@ -87,9 +89,9 @@ struct seed_selecting_helper {
     /// @param triplet_weight   triplets' weight
     ///
     /// @return boolean value
-    template <typename spacepoint_collection_t>
+    template <typename filter_config_t, typename spacepoint_collection_t>
     static TRACCC_HOST_DEVICE bool cut_per_middle_sp(
-        const seedfilter_config& filter_config,
+        const filter_config_t& filter_config,
         const spacepoint_collection_t& sp_collection, const alt_seed& seed,
         const scalar& triplet_weight) {
 
@@ -38,6 +38,15 @@ class seeding_algorithm : public algorithm<seed_collection_types::host(
     output_type operator()(
         const spacepoint_container_types::host& spacepoints) const override;
 
+    /// Operator executing the algorithm in regions of interest only
+    ///
+    /// @param spacepoint All spacepoints in the event
+    /// @param rois The regions of interest to find seeds in
+    /// @return The track seeds with a middle spacepoint in one of the regions
+    ///
+    output_type operator()(const spacepoint_container_types::host& spacepoints,
+                           const seeding_roi_collection_types::host& rois) const;
+
     private:
     /// Sub-algorithm performing the spacepoint binning
     spacepoint_binning m_spacepoint_binning;
@@ -0,0 +1,133 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/seeding/detail/seeding_roi.hpp"
+#include "traccc/seeding/detail/spacepoint_grid.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace traccc {
+
+/// Helper functions used for region-of-interest restricted seeding
+struct seeding_roi_helper {
+
+    /// Find the grid bins that may hold middle spacepoints of a set of RoIs
+    ///
+    /// @param config is the seed finder configuration (in internal units)
+    /// @param phi_axis is the Phi axis of the spacepoint grid
+    /// @param z_axis is the Z axis of the spacepoint grid
+    /// @param rois are the regions of interest
+    ///
+    /// @return a flag for every (global) grid bin, set for the bins that
+    ///         overlap with at least one of the regions
+    template <typename phi_axis_t, typename z_axis_t,
+              typename roi_collection_t>
+    static std::vector<char> middle_bins(const seedfinder_config& config,
+                                         const phi_axis_t& phi_axis,
+                                         const z_axis_t& z_axis,
+                                         const roi_collection_t& rois) {
+
+        const unsigned int n_phi = phi_axis.bins();
+        std::vector<char> result(n_phi * z_axis.bins(), 0);
+
+        for (const seeding_roi& roi : rois) {
+
+            // The Z range covered by the pseudorapidity range of the region,
+            // for radii between 0 and rMax.
+            const scalar eta_z_min =
+                std::min<scalar>(0., config.rMax * std::sinh(roi.eta_min));
+            const scalar eta_z_max =
+                std::max<scalar>(0., config.rMax * std::sinh(roi.eta_max));
+            const scalar z_min = std::max(roi.z_min, eta_z_min);
+            const scalar z_max = std::min(roi.z_max, eta_z_max);
+            if (z_min > z_max) {
+                continue;
+            }
+            const unsigned int z_first = z_axis.bin(z_min);
+            const unsigned int z_last = z_axis.bin(z_max);
+
+            // The Phi bins of the region, which may wrap around. Whether it
+            // does has to be decided on the region itself, as both of its
+            // ends may fall into the same bin.
+            const unsigned int phi_first = phi_axis.bin(roi.phi_min);
+            const unsigned int phi_last = phi_axis.bin(roi.phi_max);
+            const bool wraps = roi.phi_min > roi.phi_max;
+            const unsigned int phi_count =
+                (phi_last + (wraps ? n_phi : 0)) - phi_first + 1;
+
+            for (unsigned int i = 0; i < std::min(phi_count, n_phi); ++i) {
+                const unsigned int phi_bin = (phi_first + i) % n_phi;
+                for (unsigned int z_bin = z_first; z_bin <= z_last; ++z_bin) {
+                    result[phi_bin + z_bin * n_phi] = 1;
+                }
+            }
+        }
+        return result;
+    }
+
+    /// Find the grid bins that need to be populated for a set of RoIs
+    ///
+    /// These are the bins holding middle spacepoints, plus all the bins
+    /// that the doublet finding would look at for them.
+    ///
+    /// @param config is the seed finder configuration (in internal units)
+    /// @param phi_axis is the Phi axis of the spacepoint grid
+    /// @param z_axis is the Z axis of the spacepoint grid
+    /// @param rois are the regions of interest
+    ///
+    /// @return a flag for every (global) grid bin, set for the bins that
+    ///         need to be populated
+    template <typename phi_axis_t, typename z_axis_t,
+              typename roi_collection_t>
+    static std::vector<char> needed_bins(const seedfinder_config& config,
+                                         const phi_axis_t& phi_axis,
+                                         const z_axis_t& z_axis,
+                                         const roi_collection_t& rois) {
+
+        const unsigned int n_phi = phi_axis.bins();
+        const unsigned int n_z = z_axis.bins();
+        const std::vector<char> middle =
+            middle_bins(config, phi_axis, z_axis, rois);
+        std::vector<char> result(middle.size(), 0);
+
+        // The neighbourhood used by the doublet finding is the same along
+        // both axes.
+        const int scope_low = static_cast<int>(config.neighbor_scope[0]);
+        const int scope_high = static_cast<int>(config.neighbor_scope[1]);
+
+        for (unsigned int z_bin = 0; z_bin < n_z; ++z_bin) {
+            for (unsigned int phi_bin = 0; phi_bin < n_phi; ++phi_bin) {
+                if (!middle[phi_bin + z_bin * n_phi]) {
+                    continue;
+                }
+                for (int dz = -scope_low; dz <= scope_high; ++dz) {
+                    const int z_nb = static_cast<int>(z_bin) + dz;
+                    if ((z_nb < 0) || (z_nb >= static_cast<int>(n_z))) {
+                        continue;
+                    }
+                    for (int dphi = -scope_low; dphi <= scope_high; ++dphi) {
+                        const int phi_nb =
+                            (static_cast<int>(phi_bin) + dphi +
+                             static_cast<int>(n_phi)) %
+                            static_cast<int>(n_phi);
+                        result[phi_nb + z_nb * n_phi] = 1;
+                    }
+                }
+            }
+        }
+        return result;
+    }
+};
+
+}  // namespace traccc
@@ -10,11 +10,13 @@
 // Library include(s).
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/seeding/detail/seeding_roi.hpp"
 #include "traccc/seeding/detail/spacepoint_grid.hpp"
 #include "traccc/utils/algorithm.hpp"
 
 // System include(s).
 #include <functional>
+#include <vector>
 
 namespace traccc {
 
@@ -41,7 +43,30 @@ class spacepoint_binning
     output_type operator()(
         const spacepoint_container_types::host& sp_container) const override;
 
+    /// Operator executing the algorithm for a set of regions of interest
+    ///
+    /// Only the grid bins that seeding in the regions needs to look at are
+    /// populated. All other bins are left empty.
+    ///
+    /// @param sp_container All of the spacepoints of the event
+    /// @param rois The regions of interest to bin the spacepoints for
+    /// @return The spacepoints arranged in a Phi-Z grid
+    ///
+    output_type operator()(
+        const spacepoint_container_types::host& sp_container,
+        const seeding_roi_collection_types::host& rois) const;
+
     private:
+    /// Implementation for the public operators
+    ///
+    /// @param sp_container All of the spacepoints of the event
+    /// @param bin_mask Flags for the grid bins to populate (all if empty)
+    /// @return The spacepoints arranged in a Phi-Z grid
+    ///
+    output_type bin(const spacepoint_container_types::host& sp_container,
+                    const std::vector<char>& bin_mask) const;
+
+
     seedfinder_config m_config;
     spacepoint_grid_config m_grid_config;
     std::pair<output_type::axis_p0_type, output_type::axis_p1_type> m_axes;
@@ -0,0 +1,155 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_grid_neighbors.hpp"
+#include "traccc/seeding/detail/static_seeding_config.hpp"
+#include "traccc/seeding/doublet_finding.hpp"
+#include "traccc/seeding/seed_filtering.hpp"
+#include "traccc/seeding/triplet_finding.hpp"
+#include "traccc/utils/algorithm.hpp"
+
+// System include(s).
+#include <iterator>
+
+namespace traccc {
+
+/// Seed finding with a seed finder configuration known at compile time
+///
+/// Finds the same seeds as @c traccc::seed_finding without a work budget,
+/// when given the equivalent runtime configuration (see
+/// @c traccc::static_seedfinder_config::runtime_config). The doublet and
+/// triplet finding are instantiated with the compile time configuration, so
+/// the compiler can fold its cuts into the compatibility checks.
+///
+/// The cuts of a compile time configuration can not be changed per event,
+/// so this algorithm can not apply a @c traccc::seeding_budget. Detector
+/// setups that need the budget have to use @c traccc::seed_finding, which
+/// remains the default.
+///
+/// @tparam config_t The compile time seed finder configuration, like
+///                  @c traccc::static_seedfinder_config
+///
+template <typename config_t = static_seedfinder_config<>>
+class static_seed_finding
+    : public algorithm<seed_collection_types::host(
+          const spacepoint_container_types::host&, const sp_grid&)> {
+
+    public:
+    /// Constructor for the seed finding
+    ///
+    /// @param filter_config is the seed filter configuration
+    ///
+    static_seed_finding(const seedfilter_config& filter_config)
+        : m_midBot_finding(config_t{}),
+          m_midTop_finding(config_t{}),
+          m_triplet_finding(config_t{}),
+          m_seed_filtering(filter_config.toInternalUnits()) {}
+
+    /// Callable operator for the seed finding
+    ///
+    /// @param sp_container All spacepoints in the event
+    /// @param g2 The same spacepoints arranged in a 2D Phi-Z grid
+    /// @return seed_collection is the vector of seeds per event
+    ///
+    output_type operator()(const spacepoint_container_types::host& sp_container,
+                           const sp_grid& g2) const override {
+
+        // Set up the neighbourhoods of the grid bins
+        const sp_grid_neighbors neighbors_table = make_sp_grid_neighbors(
+            static_cast<unsigned int>(g2.axis_p0().bins()),
+            static_cast<unsigned int>(g2.axis_p1().bins()),
+            config_t::neighbor_scope);
+        const sp_grid_neighbors_device neighbors(get_data(neighbors_table));
+
+        // Run the algorithm
+        output_type seeds;
+
+        for (unsigned int i = 0; i < g2.nbins(); i++) {
+            auto& spM_collection = g2.bin(i);
+
+            for (unsigned int j = 0; j < spM_collection.size(); ++j) {
+                find_seeds(sp_container, g2, neighbors, {i, j}, seeds);
+            }
+        }
+
+        return seeds;
+    }
+
+    private:
+    /// Find the seeds belonging to one middle spacepoint
+    ///
+    /// @param sp_container All spacepoints in the event
+    /// @param g2 The same spacepoints arranged in a 2D Phi-Z grid
+    /// @param neighbors The neighbour bins of all bins of @c g2
+    /// @param spM_location The location of the middle spacepoint in the grid
+    /// @param seeds The collection to add the found seeds to
+    ///
+    void find_seeds(const spacepoint_container_types::host& sp_container,
+                    const sp_grid& g2,
+                    const sp_grid_neighbors_device& neighbors,
+                    const sp_location& spM_location,
+                    output_type& seeds) const {
+
+        // middule-bottom doublet search
+        typename bottom_finding_type::output_type mid_bot;
+        m_midBot_finding(g2, neighbors, spM_location, mid_bot);
+
+        if (mid_bot.first.empty())
+            return;
+
+        // middule-top doublet search
+        typename top_finding_type::output_type mid_top;
+        m_midTop_finding(g2, neighbors, spM_location, mid_top);
+
+        if (mid_top.first.empty())
+            return;
+
+        triplet_collection_types::host triplets_per_spM;
+
+        // triplet search from the combinations of two doublets which
+        // share middle spacepoint
+        for (unsigned int k = 0; k < mid_bot.first.size(); ++k) {
+            auto& doublet_mb = mid_bot.first[k];
+            auto& lb = mid_bot.second[k];
+
+            triplet_collection_types::host triplets = m_triplet_finding(
+                g2, doublet_mb, lb, mid_top.first, mid_top.second);
+
+            triplets_per_spM.insert(std::end(triplets_per_spM),
+                                    triplets.begin(), triplets.end());
+        }
+
+        // seed filtering
+        m_seed_filtering(sp_container, g2, triplets_per_spM, seeds);
+    }
+
+    /// Type of the mid bottom doublet finding
+    using bottom_finding_type =
+        doublet_finding<details::spacepoint_type::bottom, config_t>;
+    /// Type of the mid top doublet finding
+    using top_finding_type =
+        doublet_finding<details::spacepoint_type::top, config_t>;
+
+    /// Algorithm performing the mid bottom doublet finding
+    bottom_finding_type m_midBot_finding;
+    /// Algorithm performing the mid top doublet finding
+    top_finding_type m_midTop_finding;
+    /// Algorithm performing the triplet finding
+    triplet_finding<config_t> m_triplet_finding;
+    /// Algorithm performing the seed selection
+    seed_filtering m_seed_filtering;
+
+};  // class static_seed_finding
+
+}  // namespace traccc
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2023 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -11,6 +11,8 @@
 #include "traccc/edm/seed.hpp"
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/edm/track_parameters.hpp"
+#include "traccc/field/constant_field.hpp"
+#include "traccc/field/field_map.hpp"
 #include "traccc/utils/algorithm.hpp"
 
 // VecMem include(s).
@@ -25,7 +27,18 @@ namespace traccc {
 ///
 /// Transcribed from Acts/Seeding/EstimateTrackParamsFromSeed.hpp.
 ///
-class track_params_estimation
+/// @tparam field_t The type of the magnetic field provider. With a constant
+///                 field the seeds are estimated in vectorized blocks, while
+///                 with a field map the field is looked up at the bottom
+///                 spacepoint of every seed.
+///
+/// The blocks of large events are only processed by multiple threads if
+/// traccc was built with @c TRACCC_USE_OPENMP. That should stay off when
+/// the algorithm is called by threads that already process several events
+/// in parallel, like the TBB workers of the multi-threaded examples.
+///
+template <typename field_t>
+class basic_track_params_estimation
     : public algorithm<bound_track_parameters_collection_types::host(
           const spacepoint_container_types::host&,
           const seed_collection_types::host&)> {
@@ -34,7 +47,9 @@ class track_params_estimation
     /// Constructor for track_params_estimation
     ///
     /// @param mr is the memory resource
-    track_params_estimation(vecmem::memory_resource& mr);
+    /// @param field is the magnetic field to use
+    basic_track_params_estimation(vecmem::memory_resource& mr,
+                                  const field_t& field = {});
 
     /// Callable operator for track_params_esitmation
     ///
@@ -49,7 +64,16 @@ class track_params_estimation
     private:
     /// The memory resource to use in the algorithm
     std::reference_wrapper<vecmem::memory_resource> m_mr;
+    /// The magnetic field
+    field_t m_field;
+
+};  // class basic_track_params_estimation
+
+/// Track parameter estimation with a constant magnetic field
+using track_params_estimation = basic_track_params_estimation<constant_field>;
 
-};  // class track_params_estimation
+/// Track parameter estimation with a magnetic field map
+using field_map_track_params_estimation =
+    basic_track_params_estimation<field_map_view>;
 
 }  // namespace traccc
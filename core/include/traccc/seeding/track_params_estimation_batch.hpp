@@ -0,0 +1,247 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Library include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/definitions/track_parametrization.hpp"
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/edm/track_parameters.hpp"
+
+// System include(s).
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace traccc {
+
+/// Quantities of the track parameter estimation that only depend on the
+/// magnetic field and on the particle hypothesis
+///
+/// They are calculated once, instead of once per seed as in
+/// @c traccc::seed_to_bound_vector.
+///
+template <typename fit_scalar_t = fitting_scalar>
+struct track_params_field_frame {
+
+    /// Constructor from the (constant) magnetic field and the particle mass
+    track_params_field_frame(const vector3& bfield, scalar mass) {
+
+        const fit_scalar_t bx = static_cast<fit_scalar_t>(bfield[0]);
+        const fit_scalar_t by = static_cast<fit_scalar_t>(bfield[1]);
+        const fit_scalar_t bz = static_cast<fit_scalar_t>(bfield[2]);
+        const fit_scalar_t norm = std::sqrt(bx * bx + by * by + bz * bz);
+        z_axis = {bx / norm, by / norm, bz / norm};
+        qop_factor = static_cast<fit_scalar_t>(Acts::UnitConstants::m) /
+                     (static_cast<fit_scalar_t>(0.3) * norm);
+        const fit_scalar_t mass_in_gev =
+            static_cast<fit_scalar_t>(mass) /
+            static_cast<fit_scalar_t>(Acts::UnitConstants::GeV);
+        mass2_in_gev2 = mass_in_gev * mass_in_gev;
+    }
+
+    /// The normalized magnetic field direction
+    std::array<fit_scalar_t, 3> z_axis;
+    /// Factor converting the curvature into q/pt in [GeV/c]^-1
+    fit_scalar_t qop_factor;
+    /// The squared particle mass in [GeV/c^2]^2
+    fit_scalar_t mass2_in_gev2;
+
+};  // struct track_params_field_frame
+
+/// Block of seeds, with their spacepoint coordinates stored as structure of
+/// arrays for the vectorized parameter estimation
+///
+/// @tparam fit_scalar_t is the scalar type to do the calculations in
+/// @tparam N is the (maximal) number of seeds in the block
+///
+template <typename fit_scalar_t, std::size_t N>
+struct seed_batch {
+
+    /// Type of the arrays holding one value for every seed
+    using array_type = std::array<fit_scalar_t, N>;
+
+    /// The global positions of the bottom spacepoints
+    array_type bx, by, bz;
+    /// The global positions of the middle spacepoints
+    array_type mx, my, mz;
+    /// The global positions of the top spacepoints
+    array_type tx, ty, tz;
+    /// The local position of the measurements of the bottom spacepoints
+    std::array<scalar, N> loc0, loc1;
+    /// The number of seeds in the block
+    std::size_t size = 0;
+
+    /// Gather the spacepoints of a range of seeds into the block
+    ///
+    /// @param sp_container All spacepoints of the event
+    /// @param seeds All seeds of the event
+    /// @param first The index of the first seed to gather
+    /// @param count The number of seeds to gather, at most @c N
+    ///
+    template <typename spacepoint_container_t, typename seed_container_t>
+    void gather(const spacepoint_container_t& sp_container,
+                const seed_container_t& seeds, std::size_t first,
+                std::size_t count) {
+
+        size = count;
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto& seed = seeds[first + i];
+            const auto& spB = sp_container.at(seed.spB_link);
+            const auto& spM = sp_container.at(seed.spM_link);
+            const auto& spT = sp_container.at(seed.spT_link);
+            bx[i] = static_cast<fit_scalar_t>(spB.global[0]);
+            by[i] = static_cast<fit_scalar_t>(spB.global[1]);
+            bz[i] = static_cast<fit_scalar_t>(spB.global[2]);
+            mx[i] = static_cast<fit_scalar_t>(spM.global[0]);
+            my[i] = static_cast<fit_scalar_t>(spM.global[1]);
+            mz[i] = static_cast<fit_scalar_t>(spM.global[2]);
+            tx[i] = static_cast<fit_scalar_t>(spT.global[0]);
+            ty[i] = static_cast<fit_scalar_t>(spT.global[1]);
+            tz[i] = static_cast<fit_scalar_t>(spT.global[2]);
+            loc0[i] = spB.meas.local[0];
+            loc1[i] = spB.meas.local[1];
+        }
+    }
+
+};  // struct seed_batch
+
+/// Estimate the bound track parameters of a block of seeds
+///
+/// Does the same calculation as @c traccc::seed_to_bound_vector, written out
+/// in scalar arithmetic so that the loop over the seeds of the block can be
+/// vectorized. The frame of each seed is applied through dot products, not
+/// through an explicit @c transform3 object.
+///
+/// The loop over the seeds holds no branches, and no calls that could not
+/// be vectorized, so the compiler vectorizes it without OpenMP. (The square
+/// roots need the translation unit to be built with @c -fno-math-errno with
+/// GCC and Clang.) The angles and the time, which need @c std::atan2 and a
+/// branch, are calculated in a second, scalar loop.
+///
+/// @param batch The seeds to estimate the parameters of
+/// @param frame The field dependent quantities of the estimation
+/// @param output The parameters of the seeds, @c batch.size of them
+///
+template <typename fit_scalar_t, std::size_t N>
+void estimate_track_params(const seed_batch<fit_scalar_t, N>& batch,
+                           const track_params_field_frame<fit_scalar_t>& frame,
+                           bound_track_parameters* output) {
+
+    // Values calculated for every seed in the vectorized loop.
+    std::array<fit_scalar_t, N> dir_x, dir_y, dir_z, qop, qopt, cot_theta;
+
+    const fit_scalar_t zx = frame.z_axis[0];
+    const fit_scalar_t zy = frame.z_axis[1];
+    const fit_scalar_t zz = frame.z_axis[2];
+    const std::size_t size = batch.size;
+
+    TRACCC_PRAGMA_SIMD
+    for (std::size_t i = 0; i < size; ++i) {
+
+        // The positions of the middle and top spacepoints relative to the
+        // bottom one.
+        const fit_scalar_t d1x = batch.mx[i] - batch.bx[i];
+        const fit_scalar_t d1y = batch.my[i] - batch.by[i];
+        const fit_scalar_t d1z = batch.mz[i] - batch.bz[i];
+        const fit_scalar_t d2x = batch.tx[i] - batch.bx[i];
+        const fit_scalar_t d2y = batch.ty[i] - batch.by[i];
+        const fit_scalar_t d2z = batch.tz[i] - batch.bz[i];
+
+        // The axes of the seed's frame. (Y = normalize(Z x d1), X = Y x Z)
+        fit_scalar_t yx = zy * d1z - zz * d1y;
+        fit_scalar_t yy = zz * d1x - zx * d1z;
+        fit_scalar_t yz = zx * d1y - zy * d1x;
+        const fit_scalar_t inv_ynorm =
+            1 / std::sqrt(yx * yx + yy * yy + yz * yz);
+        yx *= inv_ynorm;
+        yy *= inv_ynorm;
+        yz *= inv_ynorm;
+        const fit_scalar_t xx = yy * zz - yz * zy;
+        const fit_scalar_t xy = yz * zx - yx * zz;
+        const fit_scalar_t xz = yx * zy - yy * zx;
+
+        // The middle and top spacepoints in the seed's frame.
+        const fit_scalar_t l1x = xx * d1x + xy * d1y + xz * d1z;
+        const fit_scalar_t l1y = yx * d1x + yy * d1y + yz * d1z;
+        const fit_scalar_t l2x = xx * d2x + xy * d2y + xz * d2z;
+        const fit_scalar_t l2y = yx * d2x + yy * d2y + yz * d2z;
+        const fit_scalar_t l2z = zx * d2x + zy * d2y + zz * d2z;
+
+        // The conformal map of the two spacepoints.
+        const fit_scalar_t inv_r1 = 1 / (l1x * l1x + l1y * l1y);
+        const fit_scalar_t rn = l2x * l2x + l2y * l2y;
+        const fit_scalar_t inv_r2 = 1 / rn;
+        const fit_scalar_t u1 = l1x * inv_r1, v1 = l1y * inv_r1;
+        const fit_scalar_t u2 = l2x * inv_r2, v2 = l2y * inv_r2;
+
+        // Slope and intercept of the line through them, and the curvature.
+        const fit_scalar_t A = (v2 - v1) / (u2 - u1);
+        const fit_scalar_t B = v2 - A * u2;
+        const fit_scalar_t perp_A = std::sqrt(1 + A * A);
+        const fit_scalar_t rho = -2 * B / perp_A;
+        const fit_scalar_t inv_tan_theta =
+            l2z * std::sqrt(inv_r2) / (1 + rho * rho * rn);
+
+        // The momentum direction, transformed back into the global frame.
+        const fit_scalar_t tan_z = perp_A * inv_tan_theta;
+        const fit_scalar_t inv_tnorm =
+            1 / std::sqrt(1 + A * A + tan_z * tan_z);
+        dir_x[i] = (xx + yx * A + zx * tan_z) * inv_tnorm;
+        dir_y[i] = (xy + yy * A + zy * tan_z) * inv_tnorm;
+        dir_z[i] = (xz + yz * A + zz * tan_z) * inv_tnorm;
+
+        // The estimated q/pt and q/p in [GeV/c]^-1.
+        const fit_scalar_t q_over_pt = rho * frame.qop_factor;
+        const fit_scalar_t q_over_p =
+            q_over_pt / std::sqrt(1 + inv_tan_theta * inv_tan_theta);
+        qop[i] = q_over_p;
+        qopt[i] = q_over_pt;
+        cot_theta[i] = inv_tan_theta;
+    }
+
+    // Fill the parameters, with the angles and the time that do not
+    // vectorize as well.
+    for (std::size_t i = 0; i < size; ++i) {
+
+        // The estimated time, from the velocity along the magnetic field (or
+        // the full velocity if the bottom spacepoint is in the transverse
+        // plane).
+        const fit_scalar_t p = std::abs(1 / qop[i]);
+        const fit_scalar_t pz = cot_theta[i] / std::abs(qopt[i]);
+        const fit_scalar_t energy = std::sqrt(p * p + frame.mass2_in_gev2);
+        const fit_scalar_t pathz =
+            batch.bx[i] * zx + batch.by[i] * zy + batch.bz[i] * zz;
+        const fit_scalar_t time =
+            (pathz != 0)
+                ? (pathz * energy / pz)
+                : (std::sqrt(batch.bx[i] * batch.bx[i] +
+                             batch.by[i] * batch.by[i] +
+                             batch.bz[i] * batch.bz[i]) *
+                   energy / p);
+
+        bound_vector params;
+        getter::element(params, e_bound_loc0, 0) = batch.loc0[i];
+        getter::element(params, e_bound_loc1, 0) = batch.loc1[i];
+        getter::element(params, e_bound_phi, 0) =
+            static_cast<scalar>(std::atan2(dir_y[i], dir_x[i]));
+        getter::element(params, e_bound_theta, 0) = static_cast<scalar>(
+            std::atan2(std::sqrt(dir_x[i] * dir_x[i] + dir_y[i] * dir_y[i]),
+                       dir_z[i]));
+        getter::element(params, e_bound_qoverp, 0) =
+            static_cast<scalar>(qop[i]);
+        getter::element(params, e_bound_time, 0) =
+            static_cast<scalar>(time);
+        output[i].set_vector(params);
+    }
+}
+
+}  // namespace traccc
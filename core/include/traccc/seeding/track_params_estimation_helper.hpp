@@ -22,10 +22,11 @@ namespace traccc {
 /// @param x is the x value
 /// @param y is the y value
 /// @return is the conformal transformation result
-inline TRACCC_HOST_DEVICE vector2 uv_transform(const scalar& x,
-                                               const scalar& y) {
-    vector2 uv;
-    scalar denominator = x * x + y * y;
+template <typename scalar_t>
+inline TRACCC_HOST_DEVICE __plugin::point2<scalar_t> uv_transform(
+    const scalar_t& x, const scalar_t& y) {
+    __plugin::point2<scalar_t> uv;
+    scalar_t denominator = x * x + y * y;
     uv[0] = x / denominator;
     uv[1] = y / denominator;
     return uv;
@@ -34,73 +35,94 @@ inline TRACCC_HOST_DEVICE vector2 uv_transform(const scalar& x,
 /// helper functions (for both cpu and gpu) to calculate bound track parameter
 /// at the bottom spacepoint
 ///
+/// The spacepoint positions are converted to @c fit_scalar_t, and the
+/// parameters are estimated in that precision. Only the resulting parameters
+/// are converted back to @c traccc::scalar.
+///
+/// @tparam fit_scalar_t is the scalar type to do the calculations in
+///
 /// @param seed is the input seed
 /// @param bfield is the magnetic field
 /// @param mass is the mass of particle
-template <typename spacepoint_container_t, typename seed_t>
+template <typename fit_scalar_t = fitting_scalar,
+          typename spacepoint_container_t, typename seed_t>
 inline TRACCC_HOST_DEVICE bound_vector seed_to_bound_vector(
     const spacepoint_container_t& sp_container, const seed_t& seed,
     const vector3& bfield, const scalar mass) {
 
+    using fit_vector2 = __plugin::point2<fit_scalar_t>;
+    using fit_vector3 = __plugin::point3<fit_scalar_t>;
+    using fit_transform3 = __plugin::transform3<fit_scalar_t>;
+
     bound_vector params;
 
     const auto& spB = sp_container.at(seed.spB_link);
     const auto& spM = sp_container.at(seed.spM_link);
     const auto& spT = sp_container.at(seed.spT_link);
 
-    darray<vector3, 3> sp_global_positions;
-    sp_global_positions[0] = spB.global;
-    sp_global_positions[1] = spM.global;
-    sp_global_positions[2] = spT.global;
+    // Helper converting positions into the precision of the calculation
+    const auto convert = [](const vector3& v) {
+        return fit_vector3{static_cast<fit_scalar_t>(v[0]),
+                           static_cast<fit_scalar_t>(v[1]),
+                           static_cast<fit_scalar_t>(v[2])};
+    };
+
+    darray<fit_vector3, 3> sp_global_positions;
+    sp_global_positions[0] = convert(spB.global);
+    sp_global_positions[1] = convert(spM.global);
+    sp_global_positions[2] = convert(spT.global);
+    const fit_vector3 field = convert(bfield);
 
     // Define a new coordinate frame with its origin at the bottom space
     // point, z axis long the magnetic field direction and y axis
     // perpendicular to vector from the bottom to middle space point.
     // Hence, the projection of the middle space point on the tranverse
     // plane will be located at the x axis of the new frame.
-    vector3 relVec = sp_global_positions[1] - sp_global_positions[0];
-    vector3 newZAxis = vector::normalize(bfield);
-    vector3 newYAxis = vector::normalize(vector::cross(newZAxis, relVec));
-    vector3 newXAxis = vector::cross(newYAxis, newZAxis);
+    fit_vector3 relVec = sp_global_positions[1] - sp_global_positions[0];
+    fit_vector3 newZAxis = vector::normalize(field);
+    fit_vector3 newYAxis = vector::normalize(vector::cross(newZAxis, relVec));
+    fit_vector3 newXAxis = vector::cross(newYAxis, newZAxis);
 
     // The center of the new frame is at the bottom space point
-    vector3 translation = sp_global_positions[0];
+    fit_vector3 translation = sp_global_positions[0];
 
-    transform3 trans(translation, newZAxis, newXAxis);
+    fit_transform3 trans(translation, newZAxis, newXAxis);
 
     // The coordinate of the middle and top space point in the new frame
     auto local1 = trans.point_to_local(sp_global_positions[1]);
     auto local2 = trans.point_to_local(sp_global_positions[2]);
 
     // The uv1.y() should be zero
-    vector2 uv1 = uv_transform(local1[0], local1[1]);
-    vector2 uv2 = uv_transform(local2[0], local2[1]);
+    fit_vector2 uv1 = uv_transform<fit_scalar_t>(local1[0], local1[1]);
+    fit_vector2 uv2 = uv_transform<fit_scalar_t>(local2[0], local2[1]);
 
     // A,B are slope and intercept of the straight line in the u,v plane
     // connecting the three points
-    scalar A = (uv2[1] - uv1[1]) / (uv2[0] - uv1[0]);
-    scalar B = uv2[1] - A * uv2[0];
+    fit_scalar_t A = (uv2[1] - uv1[1]) / (uv2[0] - uv1[0]);
+    fit_scalar_t B = uv2[1] - A * uv2[0];
 
     // Curvature (with a sign) estimate
-    scalar rho = -2.0f * B / getter::perp(vector2{1., A});
+    fit_scalar_t rho = -2 * B / getter::perp(fit_vector2{1, A});
     // The projection of the top space point on the transverse plane of
     // the new frame
-    scalar rn = local2[0] * local2[0] + local2[1] * local2[1];
+    fit_scalar_t rn = local2[0] * local2[0] + local2[1] * local2[1];
     // The (1/tanTheta) of momentum in the new frame,
-    scalar invTanTheta =
-        local2[2] * std::sqrt(1.f / rn) / (1.f + rho * rho * rn);
+    fit_scalar_t invTanTheta =
+        local2[2] * std::sqrt(1 / rn) / (1 + rho * rho * rn);
 
     // The momentum direction in the new frame (the center of the circle
     // has the coordinate (-1.*A/(2*B), 1./(2*B)))
-    vector3 transDirection =
-        vector3({1., A, scalar(getter::perp(vector2{1., A})) * invTanTheta});
+    fit_vector3 transDirection = fit_vector3(
+        {1, A, fit_scalar_t(getter::perp(fit_vector2{1, A})) * invTanTheta});
     // Transform it back to the original frame
-    vector3 direction =
-        transform3::rotate(trans._data, vector::normalize(transDirection));
+    fit_vector3 direction =
+        fit_transform3::rotate(trans._data, vector::normalize(transDirection));
 
     // The estimated phi and theta
-    getter::element(params, e_bound_phi, 0) = getter::phi(direction);
-    getter::element(params, e_bound_theta, 0) = getter::theta(direction);
+    getter::element(params, e_bound_phi, 0) =
+        static_cast<scalar>(getter::phi(direction));
+    getter::element(params, e_bound_theta, 0) =
+        static_cast<scalar>(getter::theta(direction));
 
     // The measured loc0 and loc1
     const auto& meas_for_spB = spB.meas;
@@ -109,34 +131,39 @@ inline TRACCC_HOST_DEVICE bound_vector seed_to_bound_vector(
 
     // The estimated q/pt in [GeV/c]^-1 (note that the pt is the
     // projection of momentum on the transverse plane of the new frame)
-    scalar qOverPt = rho * (static_cast<scalar>(Acts::UnitConstants::m)) /
-                     (0.3f * getter::norm(bfield));
+    fit_scalar_t qOverPt =
+        rho * (static_cast<fit_scalar_t>(Acts::UnitConstants::m)) /
+        (static_cast<fit_scalar_t>(0.3) * getter::norm(field));
     // The estimated q/p in [GeV/c]^-1
-    getter::element(params, e_bound_qoverp, 0) =
-        qOverPt / getter::perp(vector2{1., invTanTheta});
+    const fit_scalar_t qOverP =
+        qOverPt / getter::perp(fit_vector2{1, invTanTheta});
+    getter::element(params, e_bound_qoverp, 0) = static_cast<scalar>(qOverP);
 
     // The estimated momentum, and its projection along the magnetic
     // field diretion
-    scalar pInGeV = std::abs(1.0f / getter::element(params, e_bound_qoverp, 0));
-    scalar pzInGeV = 1.0f / std::abs(qOverPt) * invTanTheta;
-    scalar massInGeV = mass / static_cast<scalar>(Acts::UnitConstants::GeV);
+    fit_scalar_t pInGeV = std::abs(1 / qOverP);
+    fit_scalar_t pzInGeV = 1 / std::abs(qOverPt) * invTanTheta;
+    fit_scalar_t massInGeV =
+        static_cast<fit_scalar_t>(mass) /
+        static_cast<fit_scalar_t>(Acts::UnitConstants::GeV);
 
     // The estimated velocity, and its projection along the magnetic
     // field diretion
-    scalar v = pInGeV / getter::perp(vector2{pInGeV, massInGeV});
-    scalar vz = pzInGeV / getter::perp(vector2{pInGeV, massInGeV});
+    fit_scalar_t v = pInGeV / getter::perp(fit_vector2{pInGeV, massInGeV});
+    fit_scalar_t vz = pzInGeV / getter::perp(fit_vector2{pInGeV, massInGeV});
     // The z coordinate of the bottom space point along the magnetic
     // field direction
-    scalar pathz =
-        vector::dot(sp_global_positions[0], bfield) / getter::norm(bfield);
+    fit_scalar_t pathz =
+        vector::dot(sp_global_positions[0], field) / getter::norm(field);
 
     // The estimated time (use path length along magnetic field only if
     // it's not zero)
     if (pathz != 0) {
-        getter::element(params, e_bound_time, 0) = pathz / vz;
+        getter::element(params, e_bound_time, 0) =
+            static_cast<scalar>(pathz / vz);
     } else {
         getter::element(params, e_bound_time, 0) =
-            getter::norm(sp_global_positions[0]) / v;
+            static_cast<scalar>(getter::norm(sp_global_positions[0]) / v);
     }
 
     return params;
@@ -9,6 +9,7 @@
 
 #include "traccc/edm/internal_spacepoint.hpp"
 #include "traccc/seeding/detail/doublet.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
 #include "traccc/seeding/detail/triplet.hpp"
 #include "traccc/seeding/triplet_finding_helper.hpp"
 #include "traccc/utils/algorithm.hpp"
@@ -17,6 +18,11 @@ namespace traccc {
 
 /// Triplet finding to search the compatible combintations of two doublets which
 /// share same middle spacepoint
+/// @tparam config_t is the (runtime or compile time) seed finder configuration
+/// @tparam filter_config_t is the (runtime or compile time) seed filter
+/// configuration
+template <typename config_t = seedfinder_config,
+          typename filter_config_t = seedfilter_config>
 struct triplet_finding : public algorithm<triplet_collection_types::host(
                              const sp_grid&, const doublet&, const lin_circle&,
                              const doublet_collection_types::host&,
@@ -25,7 +31,7 @@ struct triplet_finding : public algorithm<triplet_collection_types::host(
     ///
     /// @param seedfinder_config is the configuration parameters
     /// @param isp_container is the internal spacepoint container
-    triplet_finding(const seedfinder_config& config) : m_config(config) {}
+    triplet_finding(const config_t& config) : m_config(config) {}
 
     /// Callable operator for triplet finding per middle-bottom doublet
     ///
@@ -164,8 +170,8 @@ struct triplet_finding : public algorithm<triplet_collection_types::host(
     }
 
     private:
-    seedfinder_config m_config;
-    seedfilter_config m_filter_config;
+    config_t m_config;
+    filter_config_t m_filter_config;
 };
 
 }  // namespace traccc
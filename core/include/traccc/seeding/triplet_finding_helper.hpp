@@ -27,18 +27,22 @@ struct triplet_finding_helper {
     /// lower pT cut
     /// @param curvature is curvature of triplet
     /// @param impact_parameter is impact parameter of triplet
+    /// @tparam config_t is @c traccc::seedfinder_config or
+    /// @c traccc::static_seedfinder_config
     ///
     /// @return boolean value for compatibility
+    template <typename config_t>
     static inline TRACCC_HOST_DEVICE bool isCompatible(
         const internal_spacepoint<spacepoint>& spM, const lin_circle& lb,
-        const lin_circle& lt, const seedfinder_config& config,
+        const lin_circle& lt, const config_t& config,
         const scalar& iSinTheta2, const scalar& scatteringInRegion2,
         scalar& curvature, scalar& impact_parameter);
 };
 
+template <typename config_t>
 bool triplet_finding_helper::isCompatible(
     const internal_spacepoint<spacepoint>& spM, const lin_circle& lb,
-    const lin_circle& lt, const seedfinder_config& config,
+    const lin_circle& lt, const config_t& config,
     const scalar& iSinTheta2, const scalar& scatteringInRegion2,
     scalar& curvature, scalar& impact_parameter) {
 
@@ -0,0 +1,165 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Library include(s).
+#include "traccc/clusterization/component_connection.hpp"
+#include "traccc/clusterization/measurement_creation.hpp"
+#include "traccc/clusterization/spacepoint_formation.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/alt_cell.hpp"
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/seeding_algorithm.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <vector>
+
+namespace traccc {
+
+/// Configuration of the time slicing of a continuous cell stream
+struct time_slicing_config {
+    /// Length of the core of every time slice
+    scalar slice_length = 100.f;
+    /// Length of the overlap added at both sides of the core of every slice
+    ///
+    /// It has to be longer than the time spread of the cells of a single
+    /// cluster, for the clusters at the edges of the slices to be
+    /// reconstructed in full.
+    ///
+    scalar overlap = 10.f;
+    /// Beginning of the core of the first time slice
+    scalar start_time = 0.f;
+};
+
+/// The products reconstructed in a single time slice
+struct time_slice {
+    /// Index of the slice in the stream
+    std::size_t index = 0;
+    /// Beginning and end of the core of the slice
+    scalar core_begin = 0.f, core_end = 0.f;
+    /// Number of cells in the slice, including its overlaps
+    std::size_t n_cells = 0;
+    /// The measurements in the core of the slice
+    measurement_container_types::host measurements;
+    /// All spacepoints in the slice, including its overlaps
+    spacepoint_container_types::host spacepoints;
+    /// The seeds, made from @c spacepoints, with a middle spacepoint in the
+    /// core of the slice
+    seed_collection_types::host seeds;
+};
+
+/// Reconstruction of a continuous, time ordered stream of cells
+///
+/// The stream is cut into time slices of a fixed length. Every slice is
+/// extended by an overlap at both of its sides, and the cells in it are
+/// processed with the (per-event) clusterization, spacepoint formation and
+/// seeding algorithms. Every product is associated with a time: the earliest
+/// cell time for measurements, and the time of the middle spacepoint for
+/// seeds. Only the products with a time inside of the core of a slice are
+/// kept for that slice. So every product is returned exactly once, even if
+/// it was reconstructed in two neighbouring slices.
+///
+/// Cells are only kept in memory for as long as a slice, that was not
+/// processed yet, may still need them. So the memory use depends on the
+/// slice length and the rate of the cells, but not on the length of the
+/// stream.
+///
+/// Note that the clusterization itself does not look at the cell times. So
+/// neighbouring cells in the same slice are clustered together, even if they
+/// are far apart in time.
+///
+class time_slice_reconstruction {
+
+    public:
+    /// Type of the results produced by the object
+    using output_type = std::vector<time_slice>;
+
+    /// Constructor
+    ///
+    /// @param cfg The configuration of the time slicing
+    /// @param modules The modules that the cells of the stream refer to
+    /// @param mr The memory resource to use for the result objects
+    ///
+    time_slice_reconstruction(const time_slicing_config& cfg,
+                              const cell_module_collection_types::host& modules,
+                              vecmem::memory_resource& mr);
+
+    /// Process the next part of the stream
+    ///
+    /// The cells have to be ordered in time, and must not be earlier than
+    /// the cells given in earlier calls.
+    ///
+    /// @param cells The next cells of the stream
+    /// @return The slices that could be completed with these cells
+    ///
+    output_type operator()(const alt_cell_collection_types::host& cells);
+
+    /// Process all remaining slices, at the end of the stream
+    ///
+    /// @return The slices that were not returned yet
+    ///
+    output_type finish();
+
+    /// Get the number of cells buffered by the object at the moment
+    std::size_t buffered_cells() const { return m_buffer.size(); }
+
+    private:
+    /// @name Slice geometry
+    /// @{
+
+    /// Beginning of the core of a slice
+    scalar core_begin(std::size_t slice) const;
+    /// End of the core of a slice
+    scalar core_end(std::size_t slice) const;
+    /// The first slice with a window that includes a given time
+    std::size_t first_slice(scalar time) const;
+
+    /// @}
+
+    /// Process the next slice, if it has any cells
+    void process_slice(output_type& result);
+    /// Drop the cells not needed anymore, and move to the next slice
+    void next_slice();
+
+    /// The configuration of the time slicing
+    time_slicing_config m_cfg;
+    /// The modules that the cells refer to
+    std::reference_wrapper<const cell_module_collection_types::host>
+        m_modules;
+    /// The memory resource to use for the result objects
+    std::reference_wrapper<vecmem::memory_resource> m_mr;
+
+    /// @name Sub-algorithms used by this algorithm
+    /// @{
+
+    component_connection m_cc;
+    measurement_creation m_mc;
+    spacepoint_formation m_sf;
+    seeding_algorithm m_sa;
+
+    /// @}
+
+    /// Cells that may still be needed by the next slice(s), in time order
+    std::deque<alt_cell> m_buffer;
+    /// The index of the next slice to process
+    std::size_t m_slice = 0;
+    /// Time of the latest cell received
+    scalar m_last_time;
+
+};  // class time_slice_reconstruction
+
+}  // namespace traccc
@@ -0,0 +1,63 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+
+// System include(s).
+#include <type_traits>
+
+namespace traccc {
+
+/// Convert a matrix between the matrix types of two algebras
+///
+/// It is used at the boundaries between code using the scalar type of the
+/// project, and code using a different precision for its calculations. If
+/// the two matrix types are the same, the matrix is returned as it is.
+///
+/// @tparam to_algebra_t The algebra (transform3) type to convert to
+/// @tparam from_algebra_t The algebra (transform3) type to convert from
+/// @tparam ROWS The number of rows of the matrix
+/// @tparam COLS The number of columns of the matrix
+///
+/// @param m The matrix to convert
+/// @return The matrix in the matrix type of @c to_algebra_t
+///
+template <typename to_algebra_t, typename from_algebra_t,
+          typename from_algebra_t::matrix_actor::size_ty ROWS,
+          typename from_algebra_t::matrix_actor::size_ty COLS>
+TRACCC_HOST_DEVICE inline
+    typename to_algebra_t::matrix_actor::template matrix_type<ROWS, COLS>
+    matrix_cast(const typename from_algebra_t::matrix_actor::
+                    template matrix_type<ROWS, COLS>& m) {
+
+    using to_operator = typename to_algebra_t::matrix_actor;
+    using from_operator = typename from_algebra_t::matrix_actor;
+    using to_matrix = typename to_operator::template matrix_type<ROWS, COLS>;
+    using from_matrix =
+        typename from_operator::template matrix_type<ROWS, COLS>;
+
+    if constexpr (std::is_same_v<to_matrix, from_matrix>) {
+        return m;
+    } else {
+        using to_scalar = typename to_algebra_t::scalar_type;
+        using size_type = typename from_operator::size_ty;
+
+        to_matrix result = to_operator().template zero<ROWS, COLS>();
+        for (size_type i = 0; i < ROWS; ++i) {
+            for (size_type j = 0; j < COLS; ++j) {
+                to_operator().element(result, i, j) =
+                    static_cast<to_scalar>(from_operator().element(m, i, j));
+            }
+        }
+        return result;
+    }
+}
+
+}  // namespace traccc
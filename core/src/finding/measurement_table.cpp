@@ -0,0 +1,96 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/finding/measurement_table.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+namespace traccc {
+
+measurement_table::measurement_table(
+    const measurement_container_types::host& measurements) {
+
+    std::vector<std::size_t> surfaces(measurements.size());
+    for (std::size_t i = 0; i < measurements.size(); ++i) {
+        surfaces[i] =
+            static_cast<std::size_t>(measurements.get_headers()[i].module);
+    }
+    fill(measurements, surfaces);
+}
+
+measurement_table::measurement_table(
+    const measurement_container_types::host& measurements,
+    const surface_map& surfaces) {
+
+    std::vector<std::size_t> surface_indices(measurements.size());
+    for (std::size_t i = 0; i < measurements.size(); ++i) {
+        if (measurements.get_items()[i].empty()) {
+            continue;
+        }
+        const geometry_id module = measurements.get_headers()[i].module;
+        const surface_map::const_iterator it = surfaces.find(module);
+        if (it == surfaces.end()) {
+            throw std::runtime_error(
+                "Could not find the detector surface of geometry ID " +
+                std::to_string(module));
+        }
+        surface_indices[i] = it->second;
+    }
+    fill(measurements, surface_indices);
+}
+
+measurement_table::range measurement_table::find(std::size_t surface) const {
+
+    auto it = std::lower_bound(m_surfaces.begin(), m_surfaces.end(), surface);
+    if ((it == m_surfaces.end()) || (*it != surface)) {
+        return {};
+    }
+    const std::size_t index =
+        static_cast<std::size_t>(it - m_surfaces.begin());
+    return {m_measurements.data() + m_offsets[index],
+            m_measurements.data() + m_offsets[index + 1]};
+}
+
+void measurement_table::fill(
+    const measurement_container_types::host& measurements,
+    const std::vector<std::size_t>& surfaces) {
+
+    // Order the modules of the container by their surfaces. The same
+    // surface may in principle appear more than once in the container.
+    const std::size_t n_entries = measurements.size();
+    std::vector<std::size_t> order(n_entries);
+    std::iota(order.begin(), order.end(), 0u);
+    std::stable_sort(order.begin(), order.end(),
+                     [&surfaces](std::size_t lhs, std::size_t rhs) {
+                         return surfaces[lhs] < surfaces[rhs];
+                     });
+
+    // Fill the flat arrays.
+    m_surfaces.reserve(n_entries);
+    m_offsets.reserve(n_entries + 1);
+    m_measurements.reserve(measurements.total_size());
+    for (std::size_t i : order) {
+        const auto& items = measurements.get_items()[i];
+        if (items.empty()) {
+            continue;
+        }
+        if (m_surfaces.empty() || (m_surfaces.back() != surfaces[i])) {
+            m_surfaces.push_back(surfaces[i]);
+            m_offsets.push_back(m_measurements.size());
+        }
+        m_measurements.insert(m_measurements.end(), items.begin(),
+                              items.end());
+    }
+    m_offsets.push_back(m_measurements.size());
+}
+
+}  // namespace traccc
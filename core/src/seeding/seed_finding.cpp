@@ -8,11 +8,65 @@
 // Library include(s).
 #include "traccc/seeding/seed_finding.hpp"
 
+#include "traccc/seeding/doublet_finding_helper.hpp"
+#include "traccc/seeding/seeding_roi_helper.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
 namespace traccc {
 
+namespace {
+
+/// Keep only the doublets of a middle spacepoint that point closest to the
+/// beam line
+///
+/// The kept doublets stay in their original order.
+///
+/// @param doublets The doublets and their transformed coordinates
+/// @param max_doublets The number of doublets to keep
+///
+template <typename doublet_output_t>
+void keep_best_doublets(doublet_output_t& doublets,
+                        unsigned int max_doublets) {
+
+    auto& dbl = doublets.first;
+    auto& lin = doublets.second;
+
+    // Find the doublets to keep, breaking ties on the index to stay
+    // deterministic.
+    std::vector<unsigned int> indices(dbl.size());
+    std::iota(indices.begin(), indices.end(), 0u);
+    std::nth_element(indices.begin(), indices.begin() + max_doublets,
+                     indices.end(), [&lin](unsigned int a, unsigned int b) {
+                         const scalar za = std::abs(lin[a].Zo());
+                         const scalar zb = std::abs(lin[b].Zo());
+                         return (za < zb) || ((za == zb) && (a < b));
+                     });
+    indices.resize(max_doublets);
+    std::sort(indices.begin(), indices.end());
+
+    // Move them to the front. Since the indices are sorted, no doublet is
+    // overwritten before it is moved.
+    for (unsigned int i = 0; i < max_doublets; ++i) {
+        dbl[i] = dbl[indices[i]];
+        lin[i] = lin[indices[i]];
+    }
+    dbl.resize(max_doublets);
+    lin.resize(max_doublets);
+}
+
+}  // namespace
+
 seed_finding::seed_finding(const seedfinder_config& finder_config,
-                           const seedfilter_config& filter_config)
-    : m_midBot_finding(finder_config.toInternalUnits()),
+                           const seedfilter_config& filter_config,
+                           const seeding_budget& budget)
+    : m_config(finder_config.toInternalUnits()),
+      m_budget(budget),
+      m_midBot_finding(finder_config.toInternalUnits()),
       m_midTop_finding(finder_config.toInternalUnits()),
       m_triplet_finding(finder_config.toInternalUnits()),
       m_seed_filtering(filter_config.toInternalUnits()) {}
@@ -21,52 +75,261 @@ seed_finding::output_type seed_finding::operator()(
     const spacepoint_container_types::host& sp_container,
     const sp_grid& g2) const {
 
+    // Apply the work budget if one was set
+    if (m_budget.enabled()) {
+        seeding_budget_report report;
+        output_type seeds = this->operator()(sp_container, g2, report);
+        check_budget(report);
+        return seeds;
+    }
+
     // Run the algorithm
     output_type seeds;
-
-    const bool bottom = true;
-    const bool top = false;
+    const std::shared_ptr<const sp_grid_neighbors> neighbors_table =
+        get_neighbors(g2);
+    const sp_grid_neighbors_device neighbors(get_data(*neighbors_table));
 
     for (unsigned int i = 0; i < g2.nbins(); i++) {
         auto& spM_collection = g2.bin(i);
 
         for (unsigned int j = 0; j < spM_collection.size(); ++j) {
+            find_seeds(sp_container, g2, neighbors, {i, j}, seeds);
+        }
+    }
 
-            sp_location spM_location({i, j});
+    return seeds;
+}
 
-            // middule-bottom doublet search
-            auto mid_bot = m_midBot_finding(g2, spM_location);
+seed_finding::output_type seed_finding::operator()(
+    const spacepoint_container_types::host& sp_container, const sp_grid& g2,
+    const seeding_roi_collection_types::host& rois) const {
 
-            if (mid_bot.first.empty())
-                continue;
+    // Run the algorithm
+    output_type seeds;
+    const std::shared_ptr<const sp_grid_neighbors> neighbors_table =
+        get_neighbors(g2);
+    const sp_grid_neighbors_device neighbors(get_data(*neighbors_table));
 
-            // middule-top doublet search
-            auto mid_top = m_midTop_finding(g2, spM_location);
+    // Only visit the bins that overlap with the regions of interest
+    const std::vector<char> middle_bins = seeding_roi_helper::middle_bins(
+        m_config, g2.axis_p0(), g2.axis_p1(), rois);
 
-            if (mid_top.first.empty())
+    for (unsigned int i = 0; i < g2.nbins(); i++) {
+        if (!middle_bins[i]) {
+            continue;
+        }
+        auto& spM_collection = g2.bin(i);
+
+        for (unsigned int j = 0; j < spM_collection.size(); ++j) {
+            if (!is_in_any_roi(rois, spM_collection[j])) {
                 continue;
+            }
+            find_seeds(sp_container, g2, neighbors, {i, j}, seeds);
+        }
+    }
 
-            triplet_collection_types::host triplets_per_spM;
+    return seeds;
+}
 
-            // triplet search from the combinations of two doublets which
-            // share middle spacepoint
-            for (unsigned int k = 0; k < mid_bot.first.size(); ++k) {
-                auto& doublet_mb = mid_bot.first[k];
-                auto& lb = mid_bot.second[k];
+seed_finding::output_type seed_finding::operator()(
+    const spacepoint_container_types::host& sp_container, const sp_grid& g2,
+    seeding_budget_report& report) const {
 
-                triplet_collection_types::host triplets = m_triplet_finding(
-                    g2, doublet_mb, lb, mid_top.first, mid_top.second);
+    // Helper lambda for checking the counts against the budget
+    auto exceeded = [this](const std::pair<std::size_t, std::size_t>& counts) {
+        return (m_budget.doublets_exceeded(counts.first) ||
+                m_budget.triplets_exceeded(counts.second));
+    };
 
-                triplets_per_spM.insert(std::end(triplets_per_spM),
-                                        triplets.begin(), triplets.end());
-            }
+    // The neighbourhoods of the grid bins do not depend on the cuts that
+    // get tightened
+    const std::shared_ptr<const sp_grid_neighbors> neighbors_table =
+        get_neighbors(g2);
+    const sp_grid_neighbors_device neighbors(get_data(*neighbors_table));
+
+    // Count the doublets and triplet candidates with the original
+    // configuration
+    seedfinder_config config = m_config;
+    std::pair<std::size_t, std::size_t> counts =
+        count_candidates(config, g2, neighbors);
+    report = {};
+    report.initial_doublets = counts.first;
+    report.initial_triplet_candidates = counts.second;
+
+    // Tighten the cuts for as long as the event is over budget
+    while (exceeded(counts) &&
+           (report.tightening_steps < m_budget.max_tightening_steps)) {
+        config = m_budget.tighten(config);
+        counts = count_candidates(config, g2, neighbors);
+        ++report.tightening_steps;
+    }
+
+    // Cap the doublets of the individual middle spacepoints, if tightening
+    // the cuts was not enough
+    const unsigned int max_doublets =
+        (exceeded(counts) ? m_budget.max_doublets_per_spM : 0u);
+    if (max_doublets > 0) {
+        counts = count_candidates(config, g2, neighbors, max_doublets);
+    }
+    report.final_doublets = counts.first;
+    report.final_triplet_candidates = counts.second;
+    report.deltaRMax = config.deltaRMax;
+    report.impactMax = config.impactMax;
+    report.exceeded = exceeded(counts);
+
+    // Set up the sub-algorithms with the final configuration
+    const doublet_finding<details::spacepoint_type::bottom> midBot_finding(
+        config);
+    const doublet_finding<details::spacepoint_type::top> midTop_finding(
+        config);
+    const triplet_finding<> triplet_finder(config);
+
+    // Run the algorithm
+    output_type seeds;
+
+    for (unsigned int i = 0; i < g2.nbins(); i++) {
+        auto& spM_collection = g2.bin(i);
 
-            // seed filtering
-            m_seed_filtering(sp_container, g2, triplets_per_spM, seeds);
+        for (unsigned int j = 0; j < spM_collection.size(); ++j) {
+            if (find_seeds(midBot_finding, midTop_finding, triplet_finder,
+                           max_doublets, sp_container, g2, neighbors, {i, j},
+                           seeds)) {
+                ++report.capped_spMs;
+            }
         }
     }
 
     return seeds;
 }
 
+void seed_finding::find_seeds(
+    const spacepoint_container_types::host& sp_container, const sp_grid& g2,
+    const sp_grid_neighbors_device& neighbors, const sp_location& spM_location,
+    output_type& seeds) const {
+
+    find_seeds(m_midBot_finding, m_midTop_finding, m_triplet_finding, 0u,
+               sp_container, g2, neighbors, spM_location, seeds);
+}
+
+bool seed_finding::find_seeds(
+    const doublet_finding<details::spacepoint_type::bottom>& midBot_finding,
+    const doublet_finding<details::spacepoint_type::top>& midTop_finding,
+    const triplet_finding<>& triplet_finder, unsigned int max_doublets,
+    const spacepoint_container_types::host& sp_container, const sp_grid& g2,
+    const sp_grid_neighbors_device& neighbors, const sp_location& spM_location,
+    output_type& seeds) const {
+
+    // middule-bottom doublet search
+    doublet_finding<details::spacepoint_type::bottom>::output_type mid_bot;
+    midBot_finding(g2, neighbors, spM_location, mid_bot);
+
+    if (mid_bot.first.empty())
+        return false;
+
+    // middule-top doublet search
+    doublet_finding<details::spacepoint_type::top>::output_type mid_top;
+    midTop_finding(g2, neighbors, spM_location, mid_top);
+
+    if (mid_top.first.empty())
+        return false;
+
+    // cap the number of doublets if requested, keeping the most promising
+    // ones
+    bool capped = false;
+    if ((max_doublets > 0) && (mid_bot.first.size() > max_doublets)) {
+        keep_best_doublets(mid_bot, max_doublets);
+        capped = true;
+    }
+    if ((max_doublets > 0) && (mid_top.first.size() > max_doublets)) {
+        keep_best_doublets(mid_top, max_doublets);
+        capped = true;
+    }
+
+    triplet_collection_types::host triplets_per_spM;
+
+    // triplet search from the combinations of two doublets which
+    // share middle spacepoint
+    for (unsigned int k = 0; k < mid_bot.first.size(); ++k) {
+        auto& doublet_mb = mid_bot.first[k];
+        auto& lb = mid_bot.second[k];
+
+        triplet_collection_types::host triplets = triplet_finder(
+            g2, doublet_mb, lb, mid_top.first, mid_top.second);
+
+        triplets_per_spM.insert(std::end(triplets_per_spM), triplets.begin(),
+                                triplets.end());
+    }
+
+    // seed filtering
+    m_seed_filtering(sp_container, g2, triplets_per_spM, seeds);
+
+    return capped;
+}
+
+std::pair<std::size_t, std::size_t> seed_finding::count_candidates(
+    const seedfinder_config& config, const sp_grid& g2,
+    const sp_grid_neighbors_device& neighbors, unsigned int max_doublets) {
+
+    std::size_t n_doublets = 0;
+    std::size_t n_triplet_candidates = 0;
+
+    for (unsigned int i = 0; i < g2.nbins(); i++) {
+        auto& spM_collection = g2.bin(i);
+
+        for (unsigned int j = 0; j < spM_collection.size(); ++j) {
+            const auto& spM = spM_collection[j];
+
+            // Count the compatible spacepoints in the same neighbourhood
+            // that the doublet finding looks at.
+            std::size_t n_bot = 0;
+            std::size_t n_top = 0;
+            const unsigned int n_neighbors = neighbors.size(i);
+            for (unsigned int n = 0; n < n_neighbors; ++n) {
+                const auto& sps = g2.bin(neighbors.neighbor(i, n));
+                for (unsigned int k = 0; k < sps.size(); ++k) {
+                    if (doublet_finding_helper::isCompatible<
+                            details::spacepoint_type::bottom>(spM, sps[k],
+                                                              config)) {
+                        ++n_bot;
+                    }
+                    if (doublet_finding_helper::isCompatible<
+                            details::spacepoint_type::top>(spM, sps[k],
+                                                           config)) {
+                        ++n_top;
+                    }
+                }
+            }
+
+            if ((n_bot == 0) || (n_top == 0)) {
+                continue;
+            }
+            if (max_doublets > 0) {
+                n_bot = std::min<std::size_t>(n_bot, max_doublets);
+                n_top = std::min<std::size_t>(n_top, max_doublets);
+            }
+            n_doublets += n_bot + n_top;
+            n_triplet_candidates += n_bot * n_top;
+        }
+    }
+
+    return {n_doublets, n_triplet_candidates};
+}
+
+std::shared_ptr<const sp_grid_neighbors> seed_finding::get_neighbors(
+    const sp_grid& g2) const {
+
+    const std::array<unsigned int, 2> shape{
+        static_cast<unsigned int>(g2.axis_p0().bins()),
+        static_cast<unsigned int>(g2.axis_p1().bins())};
+
+    std::lock_guard<std::mutex> lock(m_neighbors_mutex);
+    if ((!m_neighbors) || (shape != m_neighbors_shape)) {
+        m_neighbors =
+            std::make_shared<const sp_grid_neighbors>(make_sp_grid_neighbors(
+                shape[0], shape[1], m_config.neighbor_scope));
+        m_neighbors_shape = shape;
+    }
+    return m_neighbors;
+}
+
 }  // namespace traccc
@@ -68,4 +68,12 @@ seeding_algorithm::output_type seeding_algorithm::operator()(
     return m_seed_finding(spacepoints, m_spacepoint_binning(spacepoints));
 }
 
+seeding_algorithm::output_type seeding_algorithm::operator()(
+    const spacepoint_container_types::host& spacepoints,
+    const seeding_roi_collection_types::host& rois) const {
+
+    return m_seed_finding(spacepoints, m_spacepoint_binning(spacepoints, rois),
+                          rois);
+}
+
 }  // namespace traccc
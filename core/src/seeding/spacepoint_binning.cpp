@@ -9,6 +9,7 @@
 #include "traccc/seeding/spacepoint_binning.hpp"
 
 #include "traccc/definitions/primitives.hpp"
+#include "traccc/seeding/seeding_roi_helper.hpp"
 #include "traccc/seeding/spacepoint_binning_helper.hpp"
 
 namespace traccc {
@@ -24,6 +25,22 @@ spacepoint_binning::spacepoint_binning(
 spacepoint_binning::output_type spacepoint_binning::operator()(
     const spacepoint_container_types::host& sp_container) const {
 
+    return bin(sp_container, {});
+}
+
+spacepoint_binning::output_type spacepoint_binning::operator()(
+    const spacepoint_container_types::host& sp_container,
+    const seeding_roi_collection_types::host& rois) const {
+
+    return bin(sp_container,
+               seeding_roi_helper::needed_bins(m_config, m_axes.first,
+                                               m_axes.second, rois));
+}
+
+spacepoint_binning::output_type spacepoint_binning::bin(
+    const spacepoint_container_types::host& sp_container,
+    const std::vector<char>& bin_mask) const {
+
     output_type g2(m_axes.first, m_axes.second, m_mr.get());
 
     djagged_vector<sp_location> rbins(m_config.get_num_rbins());
@@ -45,6 +62,13 @@ spacepoint_binning::output_type spacepoint_binning::operator()(
                 sp_container, {sp_loc.bin_idx, sp_loc.sp_idx},
                 m_config.beamPos);
 
+            // skip the spacepoints of bins that were not asked for
+            if ((!bin_mask.empty()) &&
+                (!bin_mask[g2.axis_p0().bin(isp.phi()) +
+                           g2.axis_p0().bins() * g2.axis_p1().bin(isp.z())])) {
+                continue;
+            }
+
             point2 sp_position = {isp.phi(), isp.z()};
             g2.populate(sp_position, std::move(isp));
         }
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2023 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,32 +8,97 @@
 // Library include(s).
 #include "traccc/seeding/track_params_estimation.hpp"
 
+#include "traccc/seeding/track_params_estimation_batch.hpp"
 #include "traccc/seeding/track_params_estimation_helper.hpp"
 
+// Acts include(s).
+#include <Acts/Definitions/Units.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+
+namespace {
+
+/// Number of seeds estimated together in one vectorized block
+constexpr std::size_t batch_size = 64;
+
+/// Number of seeds from which the blocks are processed by multiple threads
+constexpr std::size_t parallel_threshold = 8 * batch_size;
+
+}  // namespace
+
 namespace traccc {
 
-track_params_estimation::track_params_estimation(vecmem::memory_resource& mr)
-    : m_mr(mr) {}
+template <typename field_t>
+basic_track_params_estimation<field_t>::basic_track_params_estimation(
+    vecmem::memory_resource& mr, const field_t& field)
+    : m_mr(mr), m_field(field) {}
 
-track_params_estimation::output_type track_params_estimation::operator()(
+template <typename field_t>
+typename basic_track_params_estimation<field_t>::output_type
+basic_track_params_estimation<field_t>::operator()(
     const spacepoint_container_types::host& spacepoints,
     const seed_collection_types::host& seeds) const {
 
-    output_type result(&m_mr.get());
+    output_type result(seeds.size(), &m_mr.get());
+
+    // The estimation expects the field in Tesla.
+    const scalar tesla = static_cast<scalar>(Acts::UnitConstants::T);
+
+    // Estimate the parameters in blocks of seeds. Each block is vectorized.
+    // The blocks of large events are only processed in parallel if the
+    // library was built with TRACCC_USE_OPENMP.
+    const std::size_t n_seeds = seeds.size();
+    const std::size_t n_batches = (n_seeds + batch_size - 1) / batch_size;
 
-    // convenient assumption on bfield and mass
-    // TODO: Make use of bfield extenstion in the future
-    vector3 bfield = {0, 0, 2};
+    if constexpr (field_t::is_constant) {
 
-    for (const auto& seed : seeds) {
-        bound_track_parameters track_params;
-        track_params.set_vector(
-            seed_to_bound_vector(spacepoints, seed, bfield, PION_MASS_MEV));
+        // Every seed sees the same field, so its frame is only set up once.
+        const vector3 field = m_field.at(0.f, 0.f, 0.f);
+        const track_params_field_frame<> frame(
+            {field[0] / tesla, field[1] / tesla, field[2] / tesla},
+            PION_MASS_MEV);
 
-        result.push_back(track_params);
+#if defined(_OPENMP)
+#pragma omp parallel for if (n_seeds >= parallel_threshold)
+#endif
+        for (std::size_t b = 0; b < n_batches; ++b) {
+            const std::size_t first = b * batch_size;
+            seed_batch<fitting_scalar, batch_size> batch;
+            batch.gather(spacepoints, seeds, first,
+                         std::min(batch_size, n_seeds - first));
+            estimate_track_params(batch, frame, result.data() + first);
+        }
+    } else {
+
+        // Look up the field at the bottom spacepoint of every seed. Seeds
+        // next to each other are usually close in space, so every block
+        // re-uses the interpolation cell of the previous lookup.
+#if defined(_OPENMP)
+#pragma omp parallel for if (n_seeds >= parallel_threshold)
+#endif
+        for (std::size_t b = 0; b < n_batches; ++b) {
+            typename field_t::cache_type cache{};
+            const std::size_t end = std::min(n_seeds, (b + 1) * batch_size);
+            for (std::size_t i = b * batch_size; i < end; ++i) {
+                const seed& this_seed = seeds[i];
+                const spacepoint& spB = spacepoints.at(this_seed.spB_link);
+                const vector3 field = m_field.at(
+                    spB.global[0], spB.global[1], spB.global[2], cache);
+                result[i].set_vector(seed_to_bound_vector(
+                    spacepoints, this_seed,
+                    {field[0] / tesla, field[1] / tesla, field[2] / tesla},
+                    PION_MASS_MEV));
+            }
+        }
     }
 
     return result;
 }
 
+// Explicit template instantiation(s).
+template class basic_track_params_estimation<constant_field>;
+template class basic_track_params_estimation<field_map_view>;
+
 }  // namespace traccc
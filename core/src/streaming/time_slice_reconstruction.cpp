@@ -0,0 +1,204 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/streaming/time_slice_reconstruction.hpp"
+
+#include "traccc/edm/cluster.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace traccc {
+
+time_slice_reconstruction::time_slice_reconstruction(
+    const time_slicing_config& cfg,
+    const cell_module_collection_types::host& modules,
+    vecmem::memory_resource& mr)
+    : m_cfg(cfg),
+      m_modules(modules),
+      m_mr(mr),
+      m_cc(mr),
+      m_mc(mr),
+      m_sf(mr),
+      m_sa(mr),
+      m_last_time(-std::numeric_limits<scalar>::infinity()) {
+
+    if (!(m_cfg.slice_length > 0.f) || !(m_cfg.overlap >= 0.f)) {
+        throw std::invalid_argument("Invalid time slicing configuration");
+    }
+}
+
+time_slice_reconstruction::output_type time_slice_reconstruction::operator()(
+    const alt_cell_collection_types::host& cells) {
+
+    output_type result;
+
+    for (const alt_cell& c : cells) {
+
+        // Check the ordering of the stream.
+        if (c.c.time < m_last_time) {
+            throw std::invalid_argument("Cell stream is not ordered in time");
+        }
+        m_last_time = c.c.time;
+
+        // Ignore the cells before the first slice.
+        if (c.c.time < core_begin(0) - m_cfg.overlap) {
+            continue;
+        }
+
+        // Skip the slices that would not have any cells.
+        if (m_buffer.empty()) {
+            m_slice = std::max(m_slice, first_slice(c.c.time));
+        }
+
+        // Process all slices that can not receive any more cells.
+        while (c.c.time >= core_end(m_slice) + m_cfg.overlap) {
+            process_slice(result);
+            next_slice();
+        }
+
+        m_buffer.push_back(c);
+    }
+
+    return result;
+}
+
+time_slice_reconstruction::output_type time_slice_reconstruction::finish() {
+
+    output_type result;
+    while (!m_buffer.empty()) {
+        process_slice(result);
+        next_slice();
+    }
+    return result;
+}
+
+scalar time_slice_reconstruction::core_begin(std::size_t slice) const {
+
+    return m_cfg.start_time +
+           static_cast<scalar>(slice) * m_cfg.slice_length;
+}
+
+scalar time_slice_reconstruction::core_end(std::size_t slice) const {
+
+    return core_begin(slice + 1);
+}
+
+std::size_t time_slice_reconstruction::first_slice(scalar time) const {
+
+    const scalar slice = std::floor((time - m_cfg.overlap - m_cfg.start_time) /
+                                    m_cfg.slice_length);
+    return (slice > 0.f) ? static_cast<std::size_t>(slice) : 0u;
+}
+
+void time_slice_reconstruction::process_slice(output_type& result) {
+
+    const scalar begin = core_begin(m_slice);
+    const scalar end = core_end(m_slice);
+    const scalar window_end = end + m_cfg.overlap;
+
+    // Find the cells of the slice. The buffer only holds cells after the
+    // beginning of the slice's window.
+    const auto cells_end =
+        std::find_if(m_buffer.begin(), m_buffer.end(), [&](const alt_cell& c) {
+            return c.c.time >= window_end;
+        });
+    if (cells_end == m_buffer.begin()) {
+        return;
+    }
+
+    // Group the cells by module, with the cells of every module sorted the
+    // way that the clusterization expects them.
+    std::vector<alt_cell> slice_cells(m_buffer.begin(), cells_end);
+    std::sort(slice_cells.begin(), slice_cells.end(),
+              [](const alt_cell& c1, const alt_cell& c2) {
+                  if (c1.module_link != c2.module_link) {
+                      return c1.module_link < c2.module_link;
+                  }
+                  if (c1.c.channel1 != c2.c.channel1) {
+                      return c1.c.channel1 < c2.c.channel1;
+                  }
+                  return c1.c.channel0 < c2.c.channel0;
+              });
+    cell_container_types::host cells(&(m_mr.get()));
+    for (const alt_cell& c : slice_cells) {
+        if ((cells.size() == 0) ||
+            (cells.get_headers().back().module !=
+             m_modules.get().at(c.module_link).module)) {
+            cells.push_back(m_modules.get().at(c.module_link),
+                            cell_collection_types::host(&(m_mr.get())));
+        }
+        cells.get_items().back().push_back(c.c);
+    }
+
+    // Run the reconstruction on the slice.
+    const cluster_container_types::host clusters = m_cc(cells);
+    const measurement_container_types::host measurements =
+        m_mc(cells, clusters);
+    time_slice& slice = result.emplace_back(
+        time_slice{m_slice, begin, end, slice_cells.size(),
+                   measurement_container_types::host(&(m_mr.get())),
+                   m_sf(measurements),
+                   seed_collection_types::host(&(m_mr.get()))});
+    const seed_collection_types::host seeds = m_sa(slice.spacepoints);
+
+    // The time of every measurement is the time of its earliest cell.
+    const auto measurement_time = [&clusters](const measurement& meas) {
+        const auto& cluster_cells = clusters.get_items().at(meas.cluster_link);
+        scalar time = std::numeric_limits<scalar>::infinity();
+        for (const cell& c : cluster_cells) {
+            time = std::min(time, c.time);
+        }
+        return time;
+    };
+    const auto in_core = [begin, end](scalar time) {
+        return (time >= begin) && (time < end);
+    };
+
+    // Keep the measurements in the core of the slice.
+    for (std::size_t i = 0; i < measurements.size(); ++i) {
+        measurement_collection_types::host owned(&(m_mr.get()));
+        for (const measurement& meas : measurements.get_items()[i]) {
+            if (in_core(measurement_time(meas))) {
+                owned.push_back(meas);
+            }
+        }
+        if (!owned.empty()) {
+            slice.measurements.push_back(
+                cell_module(measurements.get_headers()[i]), std::move(owned));
+        }
+    }
+
+    // Keep the seeds with a middle spacepoint in the core of the slice.
+    for (const seed& s : seeds) {
+        if (in_core(measurement_time(slice.spacepoints.at(s.spM_link).meas))) {
+            slice.seeds.push_back(s);
+        }
+    }
+}
+
+void time_slice_reconstruction::next_slice() {
+
+    // Drop the cells before the window of the next slice.
+    ++m_slice;
+    const scalar window_begin = core_begin(m_slice) - m_cfg.overlap;
+    while (!m_buffer.empty() && (m_buffer.front().c.time < window_begin)) {
+        m_buffer.pop_front();
+    }
+
+    // Skip the slices that would not have any cells.
+    if (!m_buffer.empty()) {
+        m_slice = std::max(m_slice, first_slice(m_buffer.front().c.time));
+    }
+}
+
+}  // namespace traccc
@@ -10,6 +10,7 @@
 // Project include(s).
 #include "traccc/definitions/qualifiers.hpp"
 #include "traccc/edm/alt_cell.hpp"
+#include "traccc/edm/alt_cell_soa.hpp"
 #include "traccc/edm/alt_measurement.hpp"
 
 // System include(s).
@@ -20,6 +21,10 @@ namespace traccc::device {
 /// Function which looks for cells which share the same "parent" index and
 /// aggregates them into a cluster.
 ///
+/// @tparam cell_collection_t The (constant) device collection type of the
+///                           cells, either @c alt_cell_collection_types or
+///                           @c alt_cell_soa_types based
+///
 /// @param[in] cells    collection of cells
 /// @param[in] modules  collection of modules to which the cells are linked to
 /// @param[in] f        array of "parent" indices for all cells in this
@@ -28,9 +33,9 @@ namespace traccc::device {
 /// @param[in] end      partition end point this cell belongs to
 /// @param[in] cid      current cell id
 /// @param[out] out     cluster to fill
-TRACCC_HOST_DEVICE
-inline void aggregate_cluster(
-    const alt_cell_collection_types::const_device& cells,
+template <typename cell_collection_t>
+TRACCC_HOST_DEVICE inline void aggregate_cluster(
+    const cell_collection_t& cells,
     const cell_module_collection_types::const_device& modules,
     const vecmem::data::vector_view<unsigned short> f_view,
     const unsigned int start, const unsigned int end, const unsigned short cid,
@@ -14,9 +14,9 @@
 
 namespace traccc::device {
 
-TRACCC_HOST_DEVICE
-inline void aggregate_cluster(
-    const alt_cell_collection_types::const_device& cells,
+template <typename cell_collection_t>
+TRACCC_HOST_DEVICE inline void aggregate_cluster(
+    const cell_collection_t& cells,
     const cell_module_collection_types::const_device& modules,
     const vecmem::data::vector_view<unsigned short> f_view,
     const unsigned int start, const unsigned int end, const unsigned short cid,
@@ -34,7 +34,7 @@ inline void aggregate_cluster(
      */
     scalar totalWeight = 0.;
     point2 mean{0., 0.}, var{0., 0.};
-    const auto module_link = cells[cid + start].module_link;
+    const auto module_link = get_module_link(cells, cid + start);
     const cell_module this_module = modules.at(module_link);
     const unsigned short partition_size = end - start;
 
@@ -49,11 +49,11 @@ inline void aggregate_cluster(
          * Terminate the process earlier if we have reached a cell sufficiently
          * in a different module.
          */
-        if (cells[pos].module_link != module_link) {
+        if (get_module_link(cells, pos) != module_link) {
             break;
         }
 
-        const cell this_cell = cells[pos].c;
+        const cell this_cell = get_cell(cells, pos);
 
         /*
          * If the value of this cell is equal to our, that means it
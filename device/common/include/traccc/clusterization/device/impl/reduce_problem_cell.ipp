@@ -22,19 +22,19 @@ bool is_adjacent(channel_id ac0, channel_id ac1, channel_id bc0,
     return p0 * p0 <= 1 && p1 * p1 <= 1;
 }
 
-TRACCC_HOST_DEVICE
-inline void reduce_problem_cell(
-    const alt_cell_collection_types::const_device& cells,
+template <typename cell_collection_t>
+TRACCC_HOST_DEVICE inline void reduce_problem_cell(
+    const cell_collection_t& cells,
     const unsigned short cid, const unsigned int start, const unsigned int end,
     unsigned char& adjc, unsigned short adjv[8]) {
 
     const unsigned int pos = cid + start;
 
-    // Check if this code can benefit from changing to structs of arrays, as the
-    // recurring accesses to cell data in global memory is slow right now.
-    const channel_id c0 = cells[pos].c.channel0;
-    const channel_id c1 = cells[pos].c.channel1;
-    const unsigned int mod_id = cells[pos].module_link;
+    // With a structure-of-arrays collection, only the channel identifiers
+    // and module links of the cells are read from (global) memory here.
+    const channel_id c0 = get_channel0(cells, pos);
+    const channel_id c1 = get_channel1(cells, pos);
+    const unsigned int mod_id = get_module_link(cells, pos);
 
     /*
      * First, we traverse the cells backwards, starting from the current
@@ -48,7 +48,8 @@ inline void reduce_problem_cell(
          * impossible for that cell to ever be adjacent to this one.
          * This is a small optimisation.
          */
-        if (cells[j].c.channel1 + 1 < c1 || cells[j].module_link != mod_id) {
+        if (get_channel1(cells, j) + 1 < c1 ||
+            get_module_link(cells, j) != mod_id) {
             break;
         }
 
@@ -56,7 +57,8 @@ inline void reduce_problem_cell(
          * If the cell examined is adjacent to the current cell, save it
          * in the current cell's adjacency set.
          */
-        if (is_adjacent(c0, c1, cells[j].c.channel0, cells[j].c.channel1)) {
+        if (is_adjacent(c0, c1, get_channel0(cells, j),
+                        get_channel1(cells, j))) {
             adjv[adjc++] = j - start;
         }
     }
@@ -70,11 +72,13 @@ inline void reduce_problem_cell(
          * Note that this check now looks in the opposite direction! An
          * important difference.
          */
-        if (cells[j].c.channel1 > c1 + 1 || cells[j].module_link != mod_id) {
+        if (get_channel1(cells, j) > c1 + 1 ||
+            get_module_link(cells, j) != mod_id) {
             break;
         }
 
-        if (is_adjacent(c0, c1, cells[j].c.channel0, cells[j].c.channel1)) {
+        if (is_adjacent(c0, c1, get_channel0(cells, j),
+                        get_channel1(cells, j))) {
             adjv[adjc++] = j - start;
         }
     }
@@ -10,6 +10,7 @@
 // Project include(s).
 #include "traccc/definitions/qualifiers.hpp"
 #include "traccc/edm/alt_cell.hpp"
+#include "traccc/edm/alt_cell_soa.hpp"
 
 // System include(s).
 #include <cstddef>
@@ -20,6 +21,10 @@ namespace traccc::device {
 /// max_cells_per_partition and the number of blocks will equal the number of
 /// partitions, hence checking all cells.
 ///
+/// @tparam cell_collection_t The (constant) device collection type of the
+///                           cells, either @c alt_cell_collection_types or
+///                           @c alt_cell_soa_types based
+///
 /// @param[in] cells    Collection of cells
 /// @param[in] cid      Current cell id
 /// @param[in] start    Current partition start point
@@ -27,9 +32,9 @@ namespace traccc::device {
 /// @param[out] ajc     Number of adjacent cells
 /// @param[out] ajv     Indices of adjacent cells
 ///
-TRACCC_HOST_DEVICE
-inline void reduce_problem_cell(
-    const alt_cell_collection_types::const_device& cells,
+template <typename cell_collection_t>
+TRACCC_HOST_DEVICE inline void reduce_problem_cell(
+    const cell_collection_t& cells,
     const unsigned short cid, const unsigned int start, const unsigned int end,
     unsigned char& adjc, unsigned short adjv[8]);
 
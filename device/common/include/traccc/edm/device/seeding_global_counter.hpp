@@ -21,6 +21,10 @@ struct seeding_global_counter {
     /// The total number of triplets
     unsigned int m_nTriplets;
 
+    /// The total number of triplet candidates (middle-bottom times
+    /// middle-top doublets of the middle spacepoints)
+    unsigned long long m_nTripletCandidates;
+
 };  // struct seeding_global_counter
 
 }  // namespace traccc::device
@@ -50,6 +50,9 @@ TRACCC_HOST_DEVICE inline void fit(
     typename fitter_t::state fitter_state(track_states_per_track);
 
     fitter.fit(seed_param, fitter_state, nav_candidates.at(globalIndex));
+
+    // Store the fitting result of the track.
+    track_states[globalIndex].header = fitter_state.m_fit_info;
 }
 
 }  // namespace traccc::device
\ No newline at end of file
@@ -12,7 +12,9 @@
 #include "traccc/device/fill_prefix_sum.hpp"
 #include "traccc/edm/device/doublet_counter.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/seeding/detail/seeding_roi.hpp"
 #include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_grid_neighbors.hpp"
 
 // System include(s).
 #include <cstddef>
@@ -27,6 +29,7 @@ namespace traccc::device {
 /// @param[in] globalIndex   The index of the current thread
 /// @param[in] config        Seedfinder configuration
 /// @param[in] sp_view       The spacepoint grid to count doublets on
+/// @param[in] neighbors_view The neighbour bins of all bins of the grid
 /// @param[in] sp_ps_view    Prefix sum for iterating over the spacepoint grid
 /// @param[out] doublet_view Collection storing the number of doublets for each
 /// spacepoint
@@ -37,10 +40,72 @@ TRACCC_HOST_DEVICE
 inline void count_doublets(
     std::size_t globalIndex, const seedfinder_config& config,
     const sp_grid_const_view& sp_view,
+    const sp_grid_neighbors_view& neighbors_view,
     const vecmem::data::vector_view<const prefix_sum_element_t>& sp_ps_view,
     doublet_counter_collection_types::view doublet_view, unsigned int& nMidBot,
     unsigned int& nMidTop);
 
+/// Function used for calculating the number of spacepoint doublets, for
+/// middle spacepoints inside of a set of regions of interest
+///
+/// Threads belonging to middle spacepoints outside of all of the regions
+/// do not produce any doublet counts.
+///
+/// @param[in] globalIndex   The index of the current thread
+/// @param[in] config        Seedfinder configuration
+/// @param[in] sp_view       The spacepoint grid to count doublets on
+/// @param[in] neighbors_view The neighbour bins of all bins of the grid
+/// @param[in] sp_ps_view    Prefix sum for iterating over the spacepoint grid
+/// @param[in] rois_view     The regions of interest (no restriction if empty)
+/// @param[out] doublet_view Collection storing the number of doublets for each
+/// spacepoint
+/// @param[out] nMidBot      Total number of middle-bottom doublets
+/// @param[out] nMidTop      Total number of middle-top doublets
+///
+TRACCC_HOST_DEVICE
+inline void count_doublets(
+    std::size_t globalIndex, const seedfinder_config& config,
+    const sp_grid_const_view& sp_view,
+    const sp_grid_neighbors_view& neighbors_view,
+    const vecmem::data::vector_view<const prefix_sum_element_t>& sp_ps_view,
+    const seeding_roi_collection_types::const_view& rois_view,
+    doublet_counter_collection_types::view doublet_view, unsigned int& nMidBot,
+    unsigned int& nMidTop);
+
+/// Function used for calculating the number of spacepoint doublets, with a
+/// cap on the doublets of every middle spacepoint
+///
+/// The capped counts are the ones recorded for the middle spacepoints, so
+/// @c traccc::device::find_doublets keeps only the best doublets of the
+/// middle spacepoints above the cap.
+///
+/// @param[in] globalIndex   The index of the current thread
+/// @param[in] config        Seedfinder configuration
+/// @param[in] sp_view       The spacepoint grid to count doublets on
+/// @param[in] neighbors_view The neighbour bins of all bins of the grid
+/// @param[in] sp_ps_view    Prefix sum for iterating over the spacepoint grid
+/// @param[in] rois_view     The regions of interest (no restriction if empty)
+/// @param[in] max_doublets  The maximal number of middle-bottom and
+///                          middle-top doublets (each) per middle spacepoint
+///                          (0 means no limit)
+/// @param[out] doublet_view Collection storing the number of doublets for each
+/// spacepoint
+/// @param[out] nMidBot      Total number of middle-bottom doublets
+/// @param[out] nMidTop      Total number of middle-top doublets
+/// @param[out] nTripletCandidates Total number of triplet candidates (not
+///                                counted if @c nullptr)
+///
+TRACCC_HOST_DEVICE
+inline void count_doublets(
+    std::size_t globalIndex, const seedfinder_config& config,
+    const sp_grid_const_view& sp_view,
+    const sp_grid_neighbors_view& neighbors_view,
+    const vecmem::data::vector_view<const prefix_sum_element_t>& sp_ps_view,
+    const seeding_roi_collection_types::const_view& rois_view,
+    unsigned int max_doublets,
+    doublet_counter_collection_types::view doublet_view, unsigned int& nMidBot,
+    unsigned int& nMidTop, unsigned long long* nTripletCandidates);
+
 }  // namespace traccc::device
 
 // Include the implementation.
@@ -45,6 +45,28 @@ inline void count_grid_capacities(
     const spacepoint_collection_types::const_view& spacepoints,
     vecmem::data::vector_view<unsigned int> grid_capacities);
 
+/// Function used for calculating the capacity for a partially filled
+/// spacepoint grid
+///
+/// Used for region-of-interest restricted seeding. Spacepoints falling into
+/// grid bins without their flag set in @c bin_mask are ignored.
+///
+/// @param[in] globalIndex   The index of the current thread
+/// @param[in] config        Seedfinder configuration
+/// @param[in] phi_axis      The circular &Phi axis describing the geometry
+/// @param[in] z_axis        The linear Z axis describing the geometry
+/// @param[in] spacepoints   All the spacepoints of the event
+/// @param[in] bin_mask      Flags for the grid bins to fill (all if empty)
+/// @param[out] grid_capacities Capacity required for each spacepoint grid bin
+///
+TRACCC_HOST_DEVICE
+inline void count_grid_capacities(
+    const std::size_t globalIndex, const seedfinder_config& config,
+    const sp_grid::axis_p0_type& phi_axis, const sp_grid::axis_p1_type& z_axis,
+    const spacepoint_collection_types::const_view& spacepoints,
+    const vecmem::data::vector_view<const char>& bin_mask,
+    vecmem::data::vector_view<unsigned int> grid_capacities);
+
 }  // namespace traccc::device
 
 // Include the implementation.
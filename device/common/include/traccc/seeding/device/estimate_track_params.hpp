@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2023 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -12,6 +12,7 @@
 #include "traccc/edm/seed.hpp"
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/edm/track_parameters.hpp"
+#include "traccc/field/constant_field.hpp"
 
 namespace traccc::device {
 
@@ -21,13 +22,15 @@ namespace traccc::device {
 /// @param[in] spacepoints_view Collection storing the spacepoints
 /// @param[in] seeds_view       Collection storing the seeds
 /// @param[out] params_view     Collection storing the bound track parameters
+/// @param[in] field            The magnetic field (provider) to use
 ///
-TRACCC_HOST_DEVICE
-inline void estimate_track_params(
+template <typename field_t = constant_field>
+TRACCC_HOST_DEVICE inline void estimate_track_params(
     const std::size_t globalIndex,
     const spacepoint_collection_types::const_view& spacepoints_view,
     const alt_seed_collection_types::const_view& seeds_view,
-    bound_track_parameters_collection_types::view params_view);
+    bound_track_parameters_collection_types::view params_view,
+    const field_t& field = {});
 
 }  // namespace traccc::device
 
@@ -14,6 +14,7 @@
 #include "traccc/edm/device/doublet_counter.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
 #include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_grid_neighbors.hpp"
 
 // System include(s).
 #include <cstddef>
@@ -24,10 +25,13 @@ namespace traccc::device {
 ///
 /// Based on the information collected by @c traccc::device::count_doublets it
 /// can fill collection with the specific doublet pairs that exist in the event.
+/// If the counts of a middle spacepoint were capped, only its doublets that
+/// point closest to the beam line are kept.
 ///
 /// @param[in] globalIndex       The index of the current thread
 /// @param[in] config            Seedfinder configuration
 /// @param[in] sp_view           The spacepoint grid to find doublets on
+/// @param[in] neighbors_view    The neighbour bins of all bins of the grid
 /// @param[in] dc_view           Collection with the number of doublets to find
 /// @param[out] mb_doublets_view Collection of middle-bottom doublets
 /// @param[out] mt_doublets_view Collection of middle-top doublets
@@ -36,6 +40,7 @@ TRACCC_HOST_DEVICE
 inline void find_doublets(
     std::size_t globalIndex, const seedfinder_config& config,
     const sp_grid_const_view& sp_view,
+    const sp_grid_neighbors_view& neighbors_view,
     const doublet_counter_collection_types::const_view& dc_view,
     device_doublet_collection_types::view mb_doublets_view,
     device_doublet_collection_types::view mt_doublets_view);
@@ -22,10 +22,40 @@ TRACCC_HOST_DEVICE
 inline void count_doublets(
     const std::size_t globalIndex, const seedfinder_config& config,
     const sp_grid_const_view& sp_view,
+    const sp_grid_neighbors_view& neighbors_view,
     const vecmem::data::vector_view<const prefix_sum_element_t>& sp_ps_view,
     doublet_counter_collection_types::view doublet_view, unsigned int& nMidBot,
     unsigned int& nMidTop) {
 
+    count_doublets(globalIndex, config, sp_view, neighbors_view, sp_ps_view, {},
+                   doublet_view, nMidBot, nMidTop);
+}
+
+TRACCC_HOST_DEVICE
+inline void count_doublets(
+    const std::size_t globalIndex, const seedfinder_config& config,
+    const sp_grid_const_view& sp_view,
+    const sp_grid_neighbors_view& neighbors_view,
+    const vecmem::data::vector_view<const prefix_sum_element_t>& sp_ps_view,
+    const seeding_roi_collection_types::const_view& rois_view,
+    doublet_counter_collection_types::view doublet_view, unsigned int& nMidBot,
+    unsigned int& nMidTop) {
+
+    count_doublets(globalIndex, config, sp_view, neighbors_view, sp_ps_view,
+                   rois_view, 0u, doublet_view, nMidBot, nMidTop, nullptr);
+}
+
+TRACCC_HOST_DEVICE
+inline void count_doublets(
+    const std::size_t globalIndex, const seedfinder_config& config,
+    const sp_grid_const_view& sp_view,
+    const sp_grid_neighbors_view& neighbors_view,
+    const vecmem::data::vector_view<const prefix_sum_element_t>& sp_ps_view,
+    const seeding_roi_collection_types::const_view& rois_view,
+    const unsigned int max_doublets,
+    doublet_counter_collection_types::view doublet_view, unsigned int& nMidBot,
+    unsigned int& nMidTop, unsigned long long* nTripletCandidates) {
+
     // Check if anything needs to be done.
     vecmem::device_vector<const prefix_sum_element_t> sp_prefix_sum(sp_ps_view);
     if (globalIndex >= sp_prefix_sum.size()) {
@@ -37,6 +67,7 @@ inline void count_doublets(
 
     // Set up the device containers.
     const const_sp_grid_device sp_grid(sp_view);
+    const sp_grid_neighbors_device neighbors(neighbors_view);
     doublet_counter_collection_types::device doublet_counter(doublet_view);
 
     // Get the spacepoint that we're evaluating in this thread, and treat that
@@ -44,13 +75,11 @@ inline void count_doublets(
     const internal_spacepoint<spacepoint> middle_sp =
         sp_grid.bin(middle_sp_idx.first).at(middle_sp_idx.second);
 
-    // The the IDs of the neighbouring bins along the phi and Z axes of the
-    // grid.
-    const detray::dindex_range phi_bins =
-        sp_grid.axis_p0().range(middle_sp.phi(), config.neighbor_scope);
-    const detray::dindex_range z_bins =
-        sp_grid.axis_p1().range(middle_sp.z(), config.neighbor_scope);
-    assert(z_bins[0] <= z_bins[1]);
+    // Skip middle spacepoints outside of the regions of interest.
+    const seeding_roi_collection_types::const_device rois(rois_view);
+    if ((rois.size() > 0) && (!is_in_any_roi(rois, middle_sp))) {
+        return;
+    }
 
     // The number of middle-bottom candidates found for this thread's middle
     // spacepoint.
@@ -59,50 +88,34 @@ inline void count_doublets(
     // spacepoint.
     unsigned int n_mt_cand = 0;
 
-    // Iterate over all of the neighboring phi bins, including the same bin that
-    // the middle spacepoint is in. The loop over the phi bins needs to take
-    // into account that we may iterate over the "wrap around point" of the
+    // Iterate over all of the neighboring bins, including the same bin that
+    // the middle spacepoint is in. The neighbourhood was precomputed for the
+    // bin of the middle spacepoint, including the "wrap around" of the phi
     // axis.
-    for (detray::dindex phi_bin_iterator = phi_bins[0];
-         phi_bin_iterator <=
-         (phi_bins[1] +
-          (phi_bins[0] > phi_bins[1] ? sp_grid.axis_p0().n_bins : 0));
-         ++phi_bin_iterator) {
-
-        // Set up the phi bin index that we are actually meant to use inside of
-        // the loop. We could also use a modulo operation here, but that would
-        // be slightly more expensive in this specific case.
-        const detray::dindex phi_bin =
-            (phi_bin_iterator >= sp_grid.axis_p0().n_bins
-                 ? phi_bin_iterator - sp_grid.axis_p0().n_bins
-                 : phi_bin_iterator);
-
-        // Iterate over all of the neighboring Z bins, including the same bin
-        // that the middle spacepoint is in. This is a much easier iteration, as
-        // the Z axis does not "wrap around".
-        for (detray::dindex z_bin = z_bins[0]; z_bin <= z_bins[1]; ++z_bin) {
-
-            // Ask the grid for all of the spacepoints in this specific bin.
-            typename const_sp_grid_device::serialized_storage::const_reference
-                spacepoints = sp_grid.bin(phi_bin, z_bin);
-
-            // Loop over all of those spacepoints.
-            for (const internal_spacepoint<spacepoint> other_sp : spacepoints) {
-
-                // Check if this spacepoint is a compatible "bottom" spacepoint
-                // to the thread's "middle" spacepoint.
-                if (doublet_finding_helper::isCompatible<
-                        details::spacepoint_type::bottom>(middle_sp, other_sp,
-                                                          config)) {
-                    ++n_mb_cand;
-                }
-                // Check if this spacepoint is a compatible "top" spacepoint to
-                // the thread's "middle" spacepoint.
-                if (doublet_finding_helper::isCompatible<
-                        details::spacepoint_type::top>(middle_sp, other_sp,
-                                                       config)) {
-                    ++n_mt_cand;
-                }
+    const unsigned int n_neighbors = neighbors.size(middle_sp_idx.first);
+    for (unsigned int i = 0; i < n_neighbors; ++i) {
+
+        // Ask the grid for all of the spacepoints in this specific bin.
+        typename const_sp_grid_device::serialized_storage::const_reference
+            spacepoints =
+                sp_grid.bin(neighbors.neighbor(middle_sp_idx.first, i));
+
+        // Loop over all of those spacepoints.
+        for (const internal_spacepoint<spacepoint> other_sp : spacepoints) {
+
+            // Check if this spacepoint is a compatible "bottom" spacepoint
+            // to the thread's "middle" spacepoint.
+            if (doublet_finding_helper::isCompatible<
+                    details::spacepoint_type::bottom>(middle_sp, other_sp,
+                                                      config)) {
+                ++n_mb_cand;
+            }
+            // Check if this spacepoint is a compatible "top" spacepoint to
+            // the thread's "middle" spacepoint.
+            if (doublet_finding_helper::isCompatible<
+                    details::spacepoint_type::top>(middle_sp, other_sp,
+                                                   config)) {
+                ++n_mt_cand;
             }
         }
     }
@@ -111,11 +124,23 @@ inline void count_doublets(
     // the middle spacepoint in question.
     if ((n_mb_cand > 0) && (n_mt_cand > 0)) {
 
+        // Apply the cap on the doublets of the middle spacepoint.
+        if (max_doublets > 0) {
+            n_mb_cand = (n_mb_cand > max_doublets ? max_doublets : n_mb_cand);
+            n_mt_cand = (n_mt_cand > max_doublets ? max_doublets : n_mt_cand);
+        }
+
         // Increment the summary values in the header object.
         vecmem::device_atomic_ref<unsigned int> numMidBot(nMidBot);
         const unsigned int posBot = numMidBot.fetch_add(n_mb_cand);
         vecmem::device_atomic_ref<unsigned int> numMidTop(nMidTop);
         const unsigned int posTop = numMidTop.fetch_add(n_mt_cand);
+        if (nTripletCandidates != nullptr) {
+            vecmem::device_atomic_ref<unsigned long long> numTripletCand(
+                *nTripletCandidates);
+            numTripletCand.fetch_add(
+                static_cast<unsigned long long>(n_mb_cand) * n_mt_cand);
+        }
 
         // Add the number of candidates for the "current bin".
         doublet_counter.push_back(
@@ -22,6 +22,18 @@ inline void count_grid_capacities(
     const spacepoint_collection_types::const_view& spacepoints_view,
     vecmem::data::vector_view<unsigned int> grid_capacities_view) {
 
+    count_grid_capacities(globalIndex, config, phi_axis, z_axis,
+                          spacepoints_view, {}, grid_capacities_view);
+}
+
+TRACCC_HOST_DEVICE
+inline void count_grid_capacities(
+    const std::size_t globalIndex, const seedfinder_config& config,
+    const sp_grid::axis_p0_type& phi_axis, const sp_grid::axis_p1_type& z_axis,
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const vecmem::data::vector_view<const char>& bin_mask_view,
+    vecmem::data::vector_view<unsigned int> grid_capacities_view) {
+
     // Check if anything needs to be done.
     const spacepoint_collection_types::const_device spacepoints(
         spacepoints_view);
@@ -39,6 +51,12 @@ inline void count_grid_capacities(
         const std::size_t bin_index =
             phi_axis.bin(isp.phi()) + phi_axis.bins() * z_axis.bin(isp.z());
 
+        // Skip the spacepoint if its bin was not asked for.
+        const vecmem::device_vector<const char> bin_mask(bin_mask_view);
+        if ((bin_mask.size() > 0) && (!bin_mask[bin_index])) {
+            return;
+        }
+
         // Increase the capacity of the grid bin.
         vecmem::device_vector<unsigned int> grid_capacities(
             grid_capacities_view);
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2023 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -13,12 +13,13 @@
 
 namespace traccc::device {
 
-TRACCC_HOST_DEVICE
-inline void estimate_track_params(
+template <typename field_t>
+TRACCC_HOST_DEVICE inline void estimate_track_params(
     const std::size_t globalIndex,
     const spacepoint_collection_types::const_view& spacepoints_view,
     const alt_seed_collection_types::const_view& seeds_view,
-    bound_track_parameters_collection_types::view params_view) {
+    bound_track_parameters_collection_types::view params_view,
+    const field_t& field) {
 
     // Check if anything needs to be done.
     const alt_seed_collection_types::const_device seeds_device(seeds_view);
@@ -31,11 +32,16 @@ inline void estimate_track_params(
 
     bound_track_parameters_collection_types::device params_device(params_view);
 
-    // convenient assumption on bfield and mass
-    vector3 bfield = {0, 0, 2};
-
     const alt_seed& this_seed = seeds_device.at(globalIndex);
 
+    // Look up the field (in Tesla) at the bottom spacepoint of the seed.
+    const spacepoint& spB = spacepoints_device.at(this_seed.spB_link);
+    const vector3 field_value =
+        field.at(spB.global[0], spB.global[1], spB.global[2]);
+    const scalar tesla = static_cast<scalar>(Acts::UnitConstants::T);
+    const vector3 bfield = {field_value[0] / tesla, field_value[1] / tesla,
+                            field_value[2] / tesla};
+
     // Get bound track parameter
     bound_track_parameters track_params;
     track_params.set_vector(seed_to_bound_vector(spacepoints_device, this_seed,
@@ -15,13 +15,94 @@
 
 // System include(s).
 #include <cassert>
+#include <cmath>
 
 namespace traccc::device {
 
+/// Book-keeping of the doublets recorded for one middle spacepoint
+struct doublet_slots {
+    /// The number of doublets found, including the ones not stored
+    unsigned int n_found = 0;
+    /// The stored doublet farthest from the beam line, once all of the
+    /// slots are taken
+    unsigned int worst_idx = 0;
+    /// The (absolute) z0 of the doublet at @c worst_idx
+    scalar worst_z0 = 0;
+};
+
+/// Find the stored doublet of a middle spacepoint that points farthest away
+/// from the beam line
+///
+template <details::spacepoint_type otherSpType>
+TRACCC_HOST_DEVICE inline void find_worst_doublet(
+    const device_doublet_collection_types::device& doublets,
+    const unsigned int start_idx, const unsigned int n_slots,
+    const const_sp_grid_device& sp_grid,
+    const internal_spacepoint<spacepoint>& middle_sp, doublet_slots& slots) {
+
+    slots.worst_z0 = -1;
+    for (unsigned int i = 0; i < n_slots; ++i) {
+        const sp_location stored = doublets.at(start_idx + i).sp2;
+        const scalar z0 = std::abs(
+            doublet_finding_helper::transform_coordinates<otherSpType>(
+                middle_sp, sp_grid.bin(stored.bin_idx).at(stored.sp_idx))
+                .Zo());
+        if (z0 > slots.worst_z0) {
+            slots.worst_z0 = z0;
+            slots.worst_idx = i;
+        }
+    }
+}
+
+/// Record a doublet of a middle spacepoint
+///
+/// If all of the slots of the middle spacepoint are taken already (because
+/// its doublets were capped), the new doublet replaces the stored one that
+/// points farthest away from the beam line, if it is better than that.
+///
+/// The farthest stored doublet is only looked for again after it was
+/// replaced, so a doublet that is not stored costs a single coordinate
+/// transformation.
+///
+template <details::spacepoint_type otherSpType>
+TRACCC_HOST_DEVICE inline void record_doublet(
+    device_doublet_collection_types::device& doublets,
+    const unsigned int start_idx, const unsigned int n_slots,
+    doublet_slots& slots, const const_sp_grid_device& sp_grid,
+    const internal_spacepoint<spacepoint>& middle_sp,
+    const internal_spacepoint<spacepoint>& other_sp,
+    const device_doublet& doublet) {
+
+    if (slots.n_found < n_slots) {
+        const unsigned int pos = start_idx + slots.n_found++;
+        assert(pos < doublets.size());
+        doublets.at(pos) = doublet;
+        if (slots.n_found == n_slots) {
+            find_worst_doublet<otherSpType>(doublets, start_idx, n_slots,
+                                            sp_grid, middle_sp, slots);
+        }
+        return;
+    }
+    ++slots.n_found;
+
+    // Replace the stored doublet that is the farthest from the beam line,
+    // if it is farther than the new one.
+    const scalar z0 = std::abs(
+        doublet_finding_helper::transform_coordinates<otherSpType>(middle_sp,
+                                                                   other_sp)
+            .Zo());
+    if (z0 < slots.worst_z0) {
+        doublets.at(start_idx + slots.worst_idx) = doublet;
+        find_worst_doublet<otherSpType>(doublets, start_idx, n_slots, sp_grid,
+                                        middle_sp, slots);
+    }
+}
+
 TRACCC_HOST_DEVICE
 inline void find_doublets(
     const std::size_t globalIndex, const seedfinder_config& config,
     const sp_grid_const_view& sp_view,
+    const sp_grid_neighbors_view& neighbors_view,
     const doublet_counter_collection_types::const_view& dc_view,
     device_doublet_collection_types::view mb_doublets_view,
     device_doublet_collection_types::view mt_doublets_view) {
@@ -38,6 +119,7 @@ inline void find_doublets(
 
     // Set up the device containers.
     const const_sp_grid_device sp_grid(sp_view);
+    const sp_grid_neighbors_device neighbors(neighbors_view);
     device_doublet_collection_types::device mb_doublets(mb_doublets_view);
     device_doublet_collection_types::device mt_doublets(mt_doublets_view);
 
@@ -52,83 +134,61 @@ inline void find_doublets(
     const unsigned int mid_bot_start_idx = middle_sp_counter.m_posMidBot;
     const unsigned int mid_top_start_idx = middle_sp_counter.m_posMidTop;
 
-    // The running indices for the middle-bottom and middle-top pairs.
-    unsigned int mid_bot_idx = 0, mid_top_idx = 0;
-
-    // The the IDs of the neighbouring bins along the phi and Z axes of the
-    // grid.
-    const detray::dindex_range phi_bins =
-        sp_grid.axis_p0().range(middle_sp.phi(), config.neighbor_scope);
-    const detray::dindex_range z_bins =
-        sp_grid.axis_p1().range(middle_sp.z(), config.neighbor_scope);
-    assert(z_bins[0] <= z_bins[1]);
+    // The slots taken by the middle-bottom and middle-top pairs.
+    doublet_slots mid_bot_slots, mid_top_slots;
 
-    // Iterate over all of the neighboring phi bins, including the same bin that
-    // the middle spacepoint is in. The loop over the phi bins needs to take
-    // into account that we may iterate over the "wrap around point" of the
+    // Iterate over all of the neighboring bins, including the same bin that
+    // the middle spacepoint is in. The neighbourhood was precomputed for the
+    // bin of the middle spacepoint, including the "wrap around" of the phi
     // axis.
-    for (detray::dindex phi_bin_iterator = phi_bins[0];
-         phi_bin_iterator <=
-         (phi_bins[1] +
-          (phi_bins[0] > phi_bins[1] ? sp_grid.axis_p0().n_bins : 0));
-         ++phi_bin_iterator) {
-
-        // Set up the phi bin index that we are actually meant to use inside of
-        // the loop. We could also use a modulo operation here, but that would
-        // be slightly more expensive in this specific case.
-        const detray::dindex phi_bin =
-            (phi_bin_iterator >= sp_grid.axis_p0().n_bins
-                 ? phi_bin_iterator - sp_grid.axis_p0().n_bins
-                 : phi_bin_iterator);
-
-        // Iterate over all of the neighboring Z bins, including the same bin
-        // that the middle spacepoint is in. This is a much easier iteration, as
-        // the Z axis does not "wrap around".
-        for (detray::dindex z_bin = z_bins[0]; z_bin <= z_bins[1]; ++z_bin) {
-
-            // Ask the grid for all of the spacepoints in this specific bin.
-            typename const_sp_grid_device::serialized_storage::const_reference
-                spacepoints = sp_grid.bin(phi_bin, z_bin);
-
-            // Construct the "single index" that refers to this phi-Z bin.
-            const unsigned int other_bin_idx =
-                phi_bin + z_bin * sp_grid.axis_p0().bins();
-
-            const unsigned int size = spacepoints.size();
-            // Loop over all of those spacepoints.
-            for (unsigned int other_sp_idx = 0; other_sp_idx < size;
-                 ++other_sp_idx) {
-
-                // Access the "other spacepoint".
-                const internal_spacepoint<spacepoint> other_sp =
-                    spacepoints.at(other_sp_idx);
-
-                // Check if this spacepoint is a compatible "bottom" spacepoint
-                // to the thread's "middle" spacepoint.
-                if (doublet_finding_helper::isCompatible<
-                        details::spacepoint_type::bottom>(middle_sp, other_sp,
-                                                          config)) {
-
-                    // Add it as a candidate to the middle-bottom container.
-                    const unsigned int pos = mid_bot_start_idx + mid_bot_idx++;
-                    assert(pos < mb_doublets.size());
-                    mb_doublets.at(pos) = {
-                        {other_bin_idx, other_sp_idx},
-                        static_cast<unsigned int>(globalIndex)};
-                }
-                // Check if this spacepoint is a compatible "top" spacepoint to
-                // the thread's "middle" spacepoint.
-                if (doublet_finding_helper::isCompatible<
-                        details::spacepoint_type::top>(middle_sp, other_sp,
-                                                       config)) {
-
-                    // Add it as a candidate to the middle-top container.
-                    const unsigned int pos = mid_top_start_idx + mid_top_idx++;
-                    assert(pos < mt_doublets.size());
-                    mt_doublets.at(pos) = {
-                        {other_bin_idx, other_sp_idx},
-                        static_cast<unsigned int>(globalIndex)};
-                }
+    const unsigned int middle_bin_idx = middle_sp_counter.m_spM.bin_idx;
+    const unsigned int n_neighbors = neighbors.size(middle_bin_idx);
+    for (unsigned int i = 0; i < n_neighbors; ++i) {
+
+        // The "single index" that refers to the phi-Z bin.
+        const unsigned int other_bin_idx =
+            neighbors.neighbor(middle_bin_idx, i);
+
+        // Ask the grid for all of the spacepoints in this specific bin.
+        typename const_sp_grid_device::serialized_storage::const_reference
+            spacepoints = sp_grid.bin(other_bin_idx);
+
+        const unsigned int size = spacepoints.size();
+        // Loop over all of those spacepoints.
+        for (unsigned int other_sp_idx = 0; other_sp_idx < size;
+             ++other_sp_idx) {
+
+            // Access the "other spacepoint".
+            const internal_spacepoint<spacepoint> other_sp =
+                spacepoints.at(other_sp_idx);
+
+            // Check if this spacepoint is a compatible "bottom" spacepoint
+            // to the thread's "middle" spacepoint.
+            if (doublet_finding_helper::isCompatible<
+                    details::spacepoint_type::bottom>(middle_sp, other_sp,
+                                                      config)) {
+
+                // Add it as a candidate to the middle-bottom container.
+                record_doublet<details::spacepoint_type::bottom>(
+                    mb_doublets, mid_bot_start_idx,
+                    middle_sp_counter.m_nMidBot, mid_bot_slots, sp_grid,
+                    middle_sp, other_sp,
+                    {{other_bin_idx, other_sp_idx},
+                     static_cast<unsigned int>(globalIndex)});
+            }
+            // Check if this spacepoint is a compatible "top" spacepoint to
+            // the thread's "middle" spacepoint.
+            if (doublet_finding_helper::isCompatible<
+                    details::spacepoint_type::top>(middle_sp, other_sp,
+                                                   config)) {
+
+                // Add it as a candidate to the middle-top container.
+                record_doublet<details::spacepoint_type::top>(
+                    mt_doublets, mid_top_start_idx,
+                    middle_sp_counter.m_nMidTop, mid_top_slots, sp_grid,
+                    middle_sp, other_sp,
+                    {{other_bin_idx, other_sp_idx},
+                     static_cast<unsigned int>(globalIndex)});
             }
         }
     }
@@ -18,6 +18,16 @@ inline void populate_grid(
     const spacepoint_collection_types::const_view& spacepoints_view,
     sp_grid_view grid_view) {
 
+    populate_grid(globalIndex, config, spacepoints_view, {}, grid_view);
+}
+
+TRACCC_DEVICE
+inline void populate_grid(
+    unsigned int globalIndex, const seedfinder_config& config,
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const vecmem::data::vector_view<const char>& bin_mask_view,
+    sp_grid_view grid_view) {
+
     // Check if anything needs to be done.
     const spacepoint_collection_types::const_device spacepoints(
         spacepoints_view);
@@ -40,6 +50,12 @@ inline void populate_grid(
         const std::size_t bin_index =
             phi_axis.bin(isp.phi()) + phi_axis.bins() * z_axis.bin(isp.z());
 
+        // Skip the spacepoint if its bin was not asked for.
+        const vecmem::device_vector<const char> bin_mask(bin_mask_view);
+        if ((bin_mask.size() > 0) && (!bin_mask[bin_index])) {
+            return;
+        }
+
         // Add the spacepoint to the grid.
         grid.bin(bin_index).push_back(std::move(isp));
     }
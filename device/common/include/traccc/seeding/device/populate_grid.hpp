@@ -35,6 +35,23 @@ inline void populate_grid(
     const spacepoint_collection_types::const_view& spacepoints,
     sp_grid_view grid);
 
+/// Function populating a part of the spacepoint grid
+///
+/// Used for region-of-interest restricted seeding. Spacepoints falling into
+/// grid bins without their flag set in @c bin_mask are ignored.
+///
+/// @param[in] globalIndex   The index of the current thread
+/// @param[in] config        Seedfinder configuration
+/// @param[in] spacepoints   All the spacepoints of the event
+/// @param[in] bin_mask      Flags for the grid bins to fill (all if empty)
+/// @param[out] grid         The spacepoint grid to populate
+///
+TRACCC_DEVICE
+inline void populate_grid(
+    unsigned int globalIndex, const seedfinder_config& config,
+    const spacepoint_collection_types::const_view& spacepoints,
+    const vecmem::data::vector_view<const char>& bin_mask, sp_grid_view grid);
+
 }  // namespace traccc::device
 
 // Include the implementation.
@@ -11,8 +11,12 @@
 #include "traccc/cuda/utils/stream.hpp"
 #include "traccc/edm/alt_seed.hpp"
 #include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/seeding_budget.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/seeding/detail/seeding_launch_config.hpp"
+#include "traccc/seeding/detail/seeding_roi.hpp"
 #include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_grid_neighbors.hpp"
 #include "traccc/utils/algorithm.hpp"
 #include "traccc/utils/memory_resource.hpp"
 
@@ -20,7 +24,10 @@
 #include <vecmem/utils/copy.hpp>
 
 // System include(s).
+#include <array>
 #include <functional>
+#include <memory>
+#include <mutex>
 
 namespace traccc::cuda {
 
@@ -39,13 +46,21 @@ class seed_finding : public algorithm<alt_seed_collection_types::buffer(
     /// @param copy The copy object to use for copying data between device
     ///             and host memory blocks
     /// @param str The CUDA stream to perform the operations in
+    /// @param budget The per-event work budget (unlimited by default)
+    /// @param launch The kernel launch sizes to use (only the finding block
+    ///               size is used by this algorithm)
     seed_finding(const seedfinder_config& config,
                  const seedfilter_config& filter_config,
                  const traccc::memory_resource& mr, vecmem::copy& copy,
-                 stream& str);
+                 stream& str, const seeding_budget& budget = {},
+                 const seeding_launch_config& launch = {});
 
     /// Callable operator for the seed finding
     ///
+    /// The work budget is applied the same way as in the overload taking a
+    /// @c traccc::seeding_budget_report, and an event staying over budget
+    /// results in a @c std::runtime_error.
+    ///
     /// @param spacepoints_view     is a view of all spacepoints in the event
     /// @param g2_view              is a view of the spacepoint grid
     /// @return                     a vector buffer of seeds
@@ -54,15 +69,78 @@ class seed_finding : public algorithm<alt_seed_collection_types::buffer(
         const spacepoint_collection_types::const_view& spacepoints_view,
         const sp_grid_const_view& g2_view) const override;
 
+    /// Callable operator for the seed finding in regions of interest
+    ///
+    /// @param spacepoints_view     is a view of all spacepoints in the event
+    /// @param g2_view              is a view of the spacepoint grid
+    /// @param rois_view            is a (device) view of the regions of
+    ///                             interest to find seeds in
+    /// @return                     a vector buffer of seeds
+    ///
+    output_type operator()(
+        const spacepoint_collection_types::const_view& spacepoints_view,
+        const sp_grid_const_view& g2_view,
+        const seeding_roi_collection_types::const_view& rois_view) const;
+
+    /// Callable operator for the seed finding within the work budget
+    ///
+    /// The doublets and triplet candidates of all middle spacepoints are
+    /// counted first, and while their number is above the budget,
+    /// @c deltaRMax and @c impactMax are tightened and the counting is
+    /// repeated. If that is not enough, the doublets of every middle
+    /// spacepoint are capped on the device, keeping the ones that point
+    /// closest to the beam line. Whether the event stayed over budget even
+    /// then is recorded in the report.
+    ///
+    /// @param spacepoints_view     is a view of all spacepoints in the event
+    /// @param g2_view              is a view of the spacepoint grid
+    /// @param report               summary of what was done to stay within
+    ///                             the budget
+    /// @return                     a vector buffer of seeds
+    ///
+    output_type operator()(
+        const spacepoint_collection_types::const_view& spacepoints_view,
+        const sp_grid_const_view& g2_view,
+        seeding_budget_report& report) const;
+
     private:
+    /// Implementation for the public operators
+    output_type find_seeds(
+        const spacepoint_collection_types::const_view& spacepoints_view,
+        const sp_grid_const_view& g2_view,
+        const seeding_roi_collection_types::const_view& rois_view,
+        seeding_budget_report& report) const;
+
+    /// Get the (device) neighbour bin table for the shape of a grid
+    ///
+    /// The table is only built and copied to the device on the first call,
+    /// and again if the shape of the grid changes. The caller shares the
+    /// ownership of the table, so a call with a different grid shape can not
+    /// release it while kernels are still reading it.
+    ///
+    /// @param g2_view is a view of the spacepoint grid
+    /// @return the neighbour bin table in device memory
+    ///
+    std::shared_ptr<const sp_grid_neighbors_buffer> get_neighbors(
+        const sp_grid_const_view& g2_view) const;
+
     seedfinder_config m_seedfinder_config;
     seedfilter_config m_seedfilter_config;
+    seeding_budget m_budget;
+    seeding_launch_config m_launch;
     traccc::memory_resource m_mr;
 
     /// The copy object to use
     vecmem::copy& m_copy;
     /// The CUDA stream to use
     stream& m_stream;
+
+    /// Mutex protecting the neighbour bin table
+    mutable std::mutex m_neighbors_mutex;
+    /// The (Phi, Z) shape of the grid that the neighbour bin table is for
+    mutable std::array<unsigned int, 2> m_neighbors_shape{0u, 0u};
+    /// Neighbour bin table of the grids seen by the algorithm
+    mutable std::shared_ptr<const sp_grid_neighbors_buffer> m_neighbors;
 };
 
 }  // namespace traccc::cuda
@@ -15,6 +15,7 @@
 // Project include(s).
 #include "traccc/edm/alt_seed.hpp"
 #include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/seeding_launch_config.hpp"
 #include "traccc/utils/algorithm.hpp"
 
 // VecMem include(s).
@@ -37,9 +38,10 @@ class seeding_algorithm : public algorithm<alt_seed_collection_types::buffer(
     /// @param copy The copy object to use for copying data between device
     ///             and host memory blocks
     /// @param str The CUDA stream to perform the operations in
+    /// @param launch The kernel launch sizes to use
     ///
     seeding_algorithm(const traccc::memory_resource& mr, vecmem::copy& copy,
-                      stream& str);
+                      stream& str, const seeding_launch_config& launch = {});
 
     /// Operator executing the algorithm.
     ///
@@ -49,12 +51,28 @@ class seeding_algorithm : public algorithm<alt_seed_collection_types::buffer(
     output_type operator()(const spacepoint_collection_types::const_view&
                                spacepoints_view) const override;
 
+    /// Operator executing the algorithm in regions of interest only
+    ///
+    /// @param spacepoints_view is a view of all spacepoints in the event
+    /// @param rois are the regions of interest to find seeds in
+    /// @return the buffer of track seeds with a middle spacepoint in one of
+    ///         the regions
+    ///
+    output_type operator()(
+        const spacepoint_collection_types::const_view& spacepoints_view,
+        const seeding_roi_collection_types::host& rois) const;
+
     private:
     /// Sub-algorithm performing the spacepoint binning
     spacepoint_binning m_spacepoint_binning;
     /// Sub-algorithm performing the seed finding
     seed_finding m_seed_finding;
 
+    /// The memory resource(s) to use
+    traccc::memory_resource m_mr;
+    /// The copy object to use
+    vecmem::copy& m_copy;
+
 };  // class seeding_algorithm
 
 }  // namespace traccc::cuda
@@ -11,6 +11,8 @@
 #include "traccc/cuda/utils/stream.hpp"
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/seeding/detail/seeding_launch_config.hpp"
+#include "traccc/seeding/detail/seeding_roi.hpp"
 #include "traccc/seeding/detail/spacepoint_grid.hpp"
 #include "traccc/utils/algorithm.hpp"
 #include "traccc/utils/memory_resource.hpp"
@@ -31,19 +33,37 @@ class spacepoint_binning
 
     public:
     /// Constructor for the algorithm
+    ///
+    /// @param launch The kernel launch sizes to use (only the binning block
+    ///               size is used by this algorithm)
+    ///
     spacepoint_binning(const seedfinder_config& config,
                        const spacepoint_grid_config& grid_config,
                        const traccc::memory_resource& mr, vecmem::copy& copy,
-                       stream& str);
+                       stream& str, const seeding_launch_config& launch = {});
 
     /// Function executing the algorithm with a a view of spacepoints
     sp_grid_buffer operator()(const spacepoint_collection_types::const_view&
                                   spacepoints_view) const override;
 
+    /// Function executing the algorithm for a set of regions of interest
+    ///
+    /// Only the grid bins that seeding in the regions needs to look at are
+    /// populated.
+    sp_grid_buffer operator()(
+        const spacepoint_collection_types::const_view& spacepoints_view,
+        const seeding_roi_collection_types::host& rois) const;
+
     private:
+    /// Implementation for the public operators
+    sp_grid_buffer bin(
+        const spacepoint_collection_types::const_view& spacepoints_view,
+        const vecmem::data::vector_view<const char>& bin_mask_view) const;
+
     /// Member variables
     seedfinder_config m_config;
     std::pair<sp_grid::axis_p0_type, sp_grid::axis_p1_type> m_axes;
+    seeding_launch_config m_launch;
     traccc::memory_resource m_mr;
 
     /// The copy object to use
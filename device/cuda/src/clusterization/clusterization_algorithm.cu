@@ -138,8 +138,15 @@ __device__ void fast_sv_1(index_t* f, index_t* gf,
     } while (__syncthreads_or(gf_changed));
 }
 
+/// Connected component labeling of the cells, and creation of measurements
+/// from the found clusters
+///
+/// @tparam cell_types The collection types of the cells, either
+///                    @c alt_cell_collection_types or @c alt_cell_soa_types
+///
+template <typename cell_types>
 __global__ void ccl_kernel(
-    const alt_cell_collection_types::const_view cells_view,
+    const typename cell_types::const_view cells_view,
     const cell_module_collection_types::const_view modules_view,
     const unsigned short max_cells_per_partition,
     const unsigned short target_cells_per_partition,
@@ -150,7 +157,7 @@ __global__ void ccl_kernel(
     const index_t tid = threadIdx.x;
     const index_t blckDim = blockDim.x;
 
-    const alt_cell_collection_types::const_device cells_device(cells_view);
+    const typename cell_types::const_device cells_device(cells_view);
     const unsigned int num_cells = cells_device.size();
     __shared__ unsigned int start, end;
     /*
@@ -180,10 +187,10 @@ __global__ void ccl_kernel(
          * cells that have been claimed by the previous block (if any).
          */
         while (start != 0 &&
-               cells_device[start - 1].module_link ==
-                   cells_device[start].module_link &&
-               cells_device[start].c.channel1 <=
-                   cells_device[start - 1].c.channel1 + 1) {
+               get_module_link(cells_device, start - 1) ==
+                   get_module_link(cells_device, start) &&
+               get_channel1(cells_device, start) <=
+                   get_channel1(cells_device, start - 1) + 1) {
             ++start;
         }
 
@@ -193,10 +200,10 @@ __global__ void ccl_kernel(
          * that is not a possible boundary!
          */
         while (end < num_cells &&
-               cells_device[end - 1].module_link ==
-                   cells_device[end].module_link &&
-               cells_device[end].c.channel1 <=
-                   cells_device[end - 1].c.channel1 + 1) {
+               get_module_link(cells_device, end - 1) ==
+                   get_module_link(cells_device, end) &&
+               get_channel1(cells_device, end) <=
+                   get_channel1(cells_device, end - 1) + 1) {
             ++end;
         }
     }
@@ -357,13 +364,26 @@ clusterization_algorithm::output_type clusterization_algorithm::operator()(
     const alt_cell_collection_types::const_view& cells,
     const cell_module_collection_types::const_view& modules) const {
 
+    return run<alt_cell_collection_types>(cells, m_copy.get_size(cells),
+                                          modules);
+}
+
+clusterization_algorithm::output_type clusterization_algorithm::operator()(
+    const alt_cell_soa_types::const_view& cells,
+    const cell_module_collection_types::const_view& modules) const {
+
+    return run<alt_cell_soa_types>(cells, m_copy.get_size(cells.channel0),
+                                   modules);
+}
+
+template <typename cell_types>
+clusterization_algorithm::output_type clusterization_algorithm::run(
+    const typename cell_types::const_view& cells, const unsigned int num_cells,
+    const cell_module_collection_types::const_view& modules) const {
+
     // Get a convenience variable for the stream that we'll be using.
     cudaStream_t stream = details::get_stream(m_stream);
 
-    // Number of cells
-    const alt_cell_collection_types::view::size_type num_cells =
-        m_copy.get_size(cells);
-
     // Create result object for the CCL kernel with size overestimation
     alt_measurement_collection_types::buffer measurements_buffer(num_cells,
                                                                  m_mr.main);
@@ -389,9 +409,9 @@ clusterization_algorithm::output_type clusterization_algorithm::operator()(
     vecmem::data::vector_buffer<unsigned int> cell_links(num_cells, m_mr.main);
 
     // Launch ccl kernel. Each thread will handle a single cell.
-    kernels::
-        ccl_kernel<<<num_partitions, threads_per_partition,
-                     2 * max_cells_per_partition * sizeof(index_t), stream>>>(
+    kernels::ccl_kernel<cell_types>
+        <<<num_partitions, threads_per_partition,
+           2 * max_cells_per_partition * sizeof(index_t), stream>>>(
             cells, modules, max_cells_per_partition,
             m_target_cells_per_partition, measurements_buffer,
             *num_measurements_device, cell_links);
@@ -32,6 +32,7 @@
 
 // System include(s).
 #include <algorithm>
+#include <utility>
 #include <vector>
 
 namespace traccc::cuda {
@@ -40,24 +41,30 @@ namespace kernels {
 /// CUDA kernel for running @c traccc::device::count_doublets
 __global__ void count_doublets(
     seedfinder_config config, sp_grid_const_view sp_grid,
+    sp_grid_neighbors_view neighbors,
     vecmem::data::vector_view<const device::prefix_sum_element_t> sp_prefix_sum,
+    seeding_roi_collection_types::const_view rois, unsigned int max_doublets,
     device::doublet_counter_collection_types::view doublet_counter,
-    unsigned int& nMidBot, unsigned int& nMidTop) {
+    unsigned int& nMidBot, unsigned int& nMidTop,
+    unsigned long long* nTripletCandidates) {
 
     device::count_doublets(threadIdx.x + blockIdx.x * blockDim.x, config,
-                           sp_grid, sp_prefix_sum, doublet_counter, nMidBot,
-                           nMidTop);
+                           sp_grid, neighbors, sp_prefix_sum, rois,
+                           max_doublets, doublet_counter, nMidBot, nMidTop,
+                           nTripletCandidates);
 }
 
 /// CUDA kernel for running @c traccc::device::find_doublets
 __global__ void find_doublets(
     seedfinder_config config, sp_grid_const_view sp_grid,
+    sp_grid_neighbors_view neighbors,
     device::doublet_counter_collection_types::const_view doublet_counter,
     device::device_doublet_collection_types::view mb_doublets,
     device::device_doublet_collection_types::view mt_doublets) {
 
     device::find_doublets(threadIdx.x + blockIdx.x * blockDim.x, config,
-                          sp_grid, doublet_counter, mb_doublets, mt_doublets);
+                          sp_grid, neighbors, doublet_counter, mb_doublets,
+                          mt_doublets);
 }
 
 /// CUDA kernel for running @c traccc::device::count_triplets
@@ -143,9 +150,13 @@ __global__ void select_seeds(
 seed_finding::seed_finding(const seedfinder_config& config,
                            const seedfilter_config& filter_config,
                            const traccc::memory_resource& mr,
-                           vecmem::copy& copy, stream& str)
+                           vecmem::copy& copy, stream& str,
+                           const seeding_budget& budget,
+                           const seeding_launch_config& launch)
     : m_seedfinder_config(config.toInternalUnits()),
       m_seedfilter_config(filter_config.toInternalUnits()),
+      m_budget(budget),
+      m_launch(launch),
       m_mr(mr),
       m_copy(copy),
       m_stream(str) {}
@@ -154,12 +165,48 @@ seed_finding::output_type seed_finding::operator()(
     const spacepoint_collection_types::const_view& spacepoints_view,
     const sp_grid_const_view& g2_view) const {
 
+    seeding_budget_report report;
+    output_type seeds = find_seeds(spacepoints_view, g2_view, {}, report);
+    check_budget(report);
+    return seeds;
+}
+
+seed_finding::output_type seed_finding::operator()(
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const sp_grid_const_view& g2_view,
+    const seeding_roi_collection_types::const_view& rois_view) const {
+
+    seeding_budget_report report;
+    output_type seeds =
+        find_seeds(spacepoints_view, g2_view, rois_view, report);
+    check_budget(report);
+    return seeds;
+}
+
+seed_finding::output_type seed_finding::operator()(
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const sp_grid_const_view& g2_view, seeding_budget_report& report) const {
+
+    return find_seeds(spacepoints_view, g2_view, {}, report);
+}
+
+seed_finding::output_type seed_finding::find_seeds(
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const sp_grid_const_view& g2_view,
+    const seeding_roi_collection_types::const_view& rois_view,
+    seeding_budget_report& report) const {
+
     // Get a convenience variable for the stream that we'll be using.
     cudaStream_t stream = details::get_stream(m_stream);
 
     // Get the sizes from the grid view
     auto grid_sizes = m_copy.get_sizes(g2_view._data_view);
 
+    // Get the neighbourhoods of all grid bins
+    const std::shared_ptr<const sp_grid_neighbors_buffer> neighbors_table =
+        get_neighbors(g2_view);
+    const sp_grid_neighbors_view neighbors_view = *neighbors_table;
+
     // Create prefix sum buffer
     vecmem::data::vector_buffer sp_grid_prefix_sum_buff =
         make_prefix_sum_buff(grid_sizes, m_copy, m_mr, m_stream);
@@ -167,11 +214,10 @@ seed_finding::output_type seed_finding::operator()(
     // Set up the doublet counter buffer.
     device::doublet_counter_collection_types::buffer doublet_counter_buffer = {
         m_copy.get_size(sp_grid_prefix_sum_buff), 0, m_mr.main};
-    m_copy.setup(doublet_counter_buffer);
 
     // Calculate the number of threads and thread blocks to run the doublet
     // counting kernel for.
-    const unsigned int nDoubletCountThreads = WARP_SIZE * 2;
+    const unsigned int nDoubletCountThreads = m_launch.finding_block_size;
     const unsigned int nDoubletCountBlocks =
         (m_copy.get_size(sp_grid_prefix_sum_buff) + nDoubletCountThreads - 1) /
         nDoubletCountThreads;
@@ -181,26 +227,73 @@ seed_finding::output_type seed_finding::operator()(
         globalCounter_device =
             vecmem::make_unique_alloc<device::seeding_global_counter>(
                 m_mr.main);
-    CUDA_ERROR_CHECK(cudaMemsetAsync(globalCounter_device.get(), 0,
-                                     sizeof(device::seeding_global_counter),
-                                     stream));
-
-    // Count the number of doublets that we need to produce.
-    kernels::count_doublets<<<nDoubletCountBlocks, nDoubletCountThreads, 0,
-                              stream>>>(
-        m_seedfinder_config, g2_view, sp_grid_prefix_sum_buff,
-        doublet_counter_buffer, (*globalCounter_device).m_nMidBot,
-        (*globalCounter_device).m_nMidTop);
-    CUDA_ERROR_CHECK(cudaGetLastError());
-    m_stream.synchronize();
-
-    // Get the summary values.
     device::seeding_global_counter globalCounter_host;
-    CUDA_ERROR_CHECK(cudaMemcpyAsync(&globalCounter_host,
-                                     globalCounter_device.get(),
-                                     sizeof(device::seeding_global_counter),
-                                     cudaMemcpyDeviceToHost, stream));
-    m_stream.synchronize();
+
+    // The configuration used by the seed finding, which may get tightened to
+    // stay within the work budget
+    seedfinder_config config = m_seedfinder_config;
+
+    // Helper lambda counting the doublets and triplet candidates with the
+    // current configuration, and a cap on the doublets per middle spacepoint
+    auto count_doublets = [&](unsigned int max_doublets) {
+        // Reset the counters.
+        m_copy.setup(doublet_counter_buffer);
+        CUDA_ERROR_CHECK(cudaMemsetAsync(globalCounter_device.get(), 0,
+                                         sizeof(device::seeding_global_counter),
+                                         stream));
+
+        // Count the number of doublets that we need to produce.
+        kernels::count_doublets<<<nDoubletCountBlocks, nDoubletCountThreads, 0,
+                                  stream>>>(
+            config, g2_view, neighbors_view, sp_grid_prefix_sum_buff, rois_view,
+            max_doublets, doublet_counter_buffer,
+            (*globalCounter_device).m_nMidBot,
+            (*globalCounter_device).m_nMidTop,
+            &((*globalCounter_device).m_nTripletCandidates));
+        CUDA_ERROR_CHECK(cudaGetLastError());
+        m_stream.synchronize();
+
+        // Get the summary values.
+        CUDA_ERROR_CHECK(cudaMemcpyAsync(&globalCounter_host,
+                                         globalCounter_device.get(),
+                                         sizeof(device::seeding_global_counter),
+                                         cudaMemcpyDeviceToHost, stream));
+        m_stream.synchronize();
+        return std::make_pair(
+            static_cast<std::size_t>(globalCounter_host.m_nMidBot) +
+                globalCounter_host.m_nMidTop,
+            static_cast<std::size_t>(globalCounter_host.m_nTripletCandidates));
+    };
+
+    // Helper lambda for checking the counts against the budget
+    auto exceeded = [this](const std::pair<std::size_t, std::size_t>& counts) {
+        return (m_budget.doublets_exceeded(counts.first) ||
+                m_budget.triplets_exceeded(counts.second));
+    };
+
+    // Count the doublets and triplet candidates, tightening the cuts for as
+    // long as the event is over budget.
+    report = {};
+    std::pair<std::size_t, std::size_t> counts = count_doublets(0u);
+    report.initial_doublets = counts.first;
+    report.initial_triplet_candidates = counts.second;
+    while (exceeded(counts) &&
+           (report.tightening_steps < m_budget.max_tightening_steps)) {
+        config = m_budget.tighten(config);
+        counts = count_doublets(0u);
+        ++report.tightening_steps;
+    }
+
+    // Cap the doublets of the individual middle spacepoints, if tightening
+    // the cuts was not enough.
+    if (exceeded(counts) && (m_budget.max_doublets_per_spM > 0)) {
+        counts = count_doublets(m_budget.max_doublets_per_spM);
+    }
+    report.final_doublets = counts.first;
+    report.final_triplet_candidates = counts.second;
+    report.deltaRMax = config.deltaRMax;
+    report.impactMax = config.impactMax;
+    report.exceeded = exceeded(counts);
 
     // Set up the doublet counter buffers.
     device::device_doublet_collection_types::buffer doublet_buffer_mb = {
@@ -212,7 +305,7 @@ seed_finding::output_type seed_finding::operator()(
 
     // Calculate the number of threads and thread blocks to run the doublet
     // finding kernel for.
-    const unsigned int nDoubletFindThreads = WARP_SIZE * 2;
+    const unsigned int nDoubletFindThreads = m_launch.finding_block_size;
     const unsigned int doublet_counter_buffer_size =
         m_copy.get_size(doublet_counter_buffer);
     const unsigned int nDoubletFindBlocks =
@@ -222,7 +315,7 @@ seed_finding::output_type seed_finding::operator()(
     // Find all of the spacepoint doublets.
     kernels::
         find_doublets<<<nDoubletFindBlocks, nDoubletFindThreads, 0, stream>>>(
-            m_seedfinder_config, g2_view, doublet_counter_buffer,
+            config, g2_view, neighbors_view, doublet_counter_buffer,
             doublet_buffer_mb, doublet_buffer_mt);
 
     // Set up the triplet counter buffers
@@ -237,7 +330,7 @@ seed_finding::output_type seed_finding::operator()(
 
     // Calculate the number of threads and thread blocks to run the doublet
     // counting kernel for.
-    const unsigned int nTripletCountThreads = WARP_SIZE * 2;
+    const unsigned int nTripletCountThreads = m_launch.finding_block_size;
     const unsigned int nTripletCountBlocks =
         (globalCounter_host.m_nMidBot + nTripletCountThreads - 1) /
         nTripletCountThreads;
@@ -249,13 +342,13 @@ seed_finding::output_type seed_finding::operator()(
     // Count the number of triplets that we need to produce.
     kernels::count_triplets<<<nTripletCountBlocks, nTripletCountThreads, 0,
                               stream>>>(
-        m_seedfinder_config, g2_view, doublet_counter_buffer, doublet_buffer_mb,
+        config, g2_view, doublet_counter_buffer, doublet_buffer_mb,
         doublet_buffer_mt, triplet_counter_spM_buffer,
         triplet_counter_midBot_buffer);
 
     // Calculate the number of threads and thread blocks to run the triplet
     // count reduction kernel for.
-    const unsigned int nTcReductionThreads = WARP_SIZE * 2;
+    const unsigned int nTcReductionThreads = m_launch.finding_block_size;
     const unsigned int nTcReductionBlocks =
         (doublet_counter_buffer_size + nTcReductionThreads - 1) /
         nTcReductionThreads;
@@ -285,7 +378,7 @@ seed_finding::output_type seed_finding::operator()(
 
     // Calculate the number of threads and thread blocks to run the triplet
     // finding kernel for.
-    const unsigned int nTripletFindThreads = WARP_SIZE * 2;
+    const unsigned int nTripletFindThreads = m_launch.finding_block_size;
     const unsigned int nTripletFindBlocks =
         (m_copy.get_size(triplet_counter_midBot_buffer) + nTripletFindThreads -
          1) /
@@ -294,14 +387,14 @@ seed_finding::output_type seed_finding::operator()(
     // Find all of the spacepoint triplets.
     kernels::
         find_triplets<<<nTripletFindBlocks, nTripletFindThreads, 0, stream>>>(
-            m_seedfinder_config, m_seedfilter_config, g2_view,
+            config, m_seedfilter_config, g2_view,
             doublet_counter_buffer, doublet_buffer_mt,
             triplet_counter_spM_buffer, triplet_counter_midBot_buffer,
             triplet_buffer);
 
     // Calculate the number of threads and thread blocks to run the weight
     // updating kernel for.
-    const unsigned int nWeightUpdatingThreads = WARP_SIZE * 2;
+    const unsigned int nWeightUpdatingThreads = m_launch.finding_block_size;
     const unsigned int nWeightUpdatingBlocks =
         (globalCounter_host.m_nTriplets + nWeightUpdatingThreads - 1) /
         nWeightUpdatingThreads;
@@ -325,7 +418,7 @@ seed_finding::output_type seed_finding::operator()(
 
     // Calculate the number of threads and thread blocks to run the seed
     // selecting kernel for.
-    const unsigned int nSeedSelectingThreads = WARP_SIZE * 2;
+    const unsigned int nSeedSelectingThreads = m_launch.finding_block_size;
     const unsigned int nSeedSelectingBlocks =
         (doublet_counter_buffer_size + nSeedSelectingThreads - 1) /
         nSeedSelectingThreads;
@@ -349,4 +442,39 @@ seed_finding::output_type seed_finding::operator()(
     return seed_buffer;
 }
 
+std::shared_ptr<const sp_grid_neighbors_buffer> seed_finding::get_neighbors(
+    const sp_grid_const_view& g2_view) const {
+
+    const std::array<unsigned int, 2> shape{
+        static_cast<unsigned int>(g2_view._axis_p0.n_bins),
+        static_cast<unsigned int>(g2_view._axis_p1.n_bins)};
+
+    std::lock_guard<std::mutex> lock(m_neighbors_mutex);
+    if ((!m_neighbors) || (shape != m_neighbors_shape)) {
+
+        // Build the table on the host.
+        const sp_grid_neighbors neighbors_host = make_sp_grid_neighbors(
+            shape[0], shape[1], m_seedfinder_config.neighbor_scope,
+            m_mr.host ? m_mr.host : &(m_mr.main));
+
+        // Copy it to the device. The previous table stays alive for as long
+        // as earlier calls still hold on to it.
+        auto neighbors = std::make_shared<sp_grid_neighbors_buffer>(
+            sp_grid_neighbors_buffer{
+                {static_cast<unsigned int>(neighbors_host.offsets.size()),
+                 m_mr.main},
+                {static_cast<unsigned int>(neighbors_host.bins.size()),
+                 m_mr.main}});
+        m_copy.setup(neighbors->offsets);
+        m_copy(vecmem::get_data(neighbors_host.offsets), neighbors->offsets);
+        m_copy.setup(neighbors->bins);
+        m_copy(vecmem::get_data(neighbors_host.bins), neighbors->bins);
+        m_stream.synchronize();
+
+        m_neighbors = std::move(neighbors);
+        m_neighbors_shape = shape;
+    }
+    return m_neighbors;
+}
+
 }  // namespace traccc::cuda
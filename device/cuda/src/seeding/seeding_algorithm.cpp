@@ -59,11 +59,15 @@ traccc::spacepoint_grid_config default_spacepoint_grid_config() {
 namespace traccc::cuda {
 
 seeding_algorithm::seeding_algorithm(const traccc::memory_resource& mr,
-                                     vecmem::copy& copy, stream& str)
+                                     vecmem::copy& copy, stream& str,
+                                     const seeding_launch_config& launch)
     : m_spacepoint_binning(default_seedfinder_config(),
-                           default_spacepoint_grid_config(), mr, copy, str),
+                           default_spacepoint_grid_config(), mr, copy, str,
+                           launch),
       m_seed_finding(default_seedfinder_config(), seedfilter_config(), mr, copy,
-                     str) {}
+                     str, {}, launch),
+      m_mr(mr),
+      m_copy(copy) {}
 
 seeding_algorithm::output_type seeding_algorithm::operator()(
     const spacepoint_collection_types::const_view& spacepoints_view) const {
@@ -72,4 +76,21 @@ seeding_algorithm::output_type seeding_algorithm::operator()(
                           m_spacepoint_binning(spacepoints_view));
 }
 
+seeding_algorithm::output_type seeding_algorithm::operator()(
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const seeding_roi_collection_types::host& rois) const {
+
+    // Copy the regions of interest to the device.
+    seeding_roi_collection_types::buffer rois_buffer(
+        static_cast<seeding_roi_collection_types::buffer::size_type>(
+            rois.size()),
+        m_mr.main);
+    m_copy.setup(rois_buffer);
+    m_copy(vecmem::get_data(rois), rois_buffer);
+
+    return m_seed_finding(spacepoints_view,
+                          m_spacepoint_binning(spacepoints_view, rois),
+                          rois_buffer);
+}
+
 }  // namespace traccc::cuda
@@ -13,11 +13,15 @@
 // Project include(s).
 #include "traccc/seeding/device/count_grid_capacities.hpp"
 #include "traccc/seeding/device/populate_grid.hpp"
+#include "traccc/seeding/seeding_roi_helper.hpp"
 
 // VecMem include(s).
 #include <vecmem/utils/copy.hpp>
 #include <vecmem/utils/cuda/copy.hpp>
 
+// System include(s).
+#include <vector>
+
 namespace traccc::cuda {
 namespace kernels {
 
@@ -26,30 +30,34 @@ __global__ void count_grid_capacities(
     seedfinder_config config, sp_grid::axis_p0_type phi_axis,
     sp_grid::axis_p1_type z_axis,
     spacepoint_collection_types::const_view spacepoints,
+    vecmem::data::vector_view<const char> bin_mask,
     vecmem::data::vector_view<unsigned int> grid_capacities) {
 
     device::count_grid_capacities(threadIdx.x + blockIdx.x * blockDim.x, config,
-                                  phi_axis, z_axis, spacepoints,
+                                  phi_axis, z_axis, spacepoints, bin_mask,
                                   grid_capacities);
 }
 
 /// CUDA kernel for running @c traccc::device::populate_grid
 __global__ void populate_grid(
     seedfinder_config config,
-    spacepoint_collection_types::const_view spacepoints, sp_grid_view grid) {
+    spacepoint_collection_types::const_view spacepoints,
+    vecmem::data::vector_view<const char> bin_mask, sp_grid_view grid) {
 
     device::populate_grid(threadIdx.x + blockIdx.x * blockDim.x, config,
-                          spacepoints, grid);
+                          spacepoints, bin_mask, grid);
 }
 
 }  // namespace kernels
 
 spacepoint_binning::spacepoint_binning(
     const seedfinder_config& config, const spacepoint_grid_config& grid_config,
-    const traccc::memory_resource& mr, vecmem::copy& copy, stream& str)
+    const traccc::memory_resource& mr, vecmem::copy& copy, stream& str,
+    const seeding_launch_config& launch)
     : m_config(config.toInternalUnits()),
       m_axes(get_axes(grid_config.toInternalUnits(),
                       (mr.host ? *(mr.host) : mr.main))),
+      m_launch(launch),
       m_mr(mr),
       m_copy(copy),
       m_stream(str) {}
@@ -57,6 +65,32 @@ spacepoint_binning::spacepoint_binning(
 sp_grid_buffer spacepoint_binning::operator()(
     const spacepoint_collection_types::const_view& spacepoints_view) const {
 
+    return bin(spacepoints_view, {});
+}
+
+sp_grid_buffer spacepoint_binning::operator()(
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const seeding_roi_collection_types::host& rois) const {
+
+    // Find the grid bins needed for the regions on the host.
+    const std::vector<char> needed_bins = seeding_roi_helper::needed_bins(
+        m_config, m_axes.first, m_axes.second, rois);
+    vecmem::vector<char> bin_mask_host(needed_bins.begin(), needed_bins.end(),
+                                       m_mr.host ? m_mr.host : &(m_mr.main));
+
+    // Copy the bin mask to the device.
+    vecmem::data::vector_buffer<char> bin_mask_buff(bin_mask_host.size(),
+                                                    m_mr.main);
+    m_copy.setup(bin_mask_buff);
+    m_copy(vecmem::get_data(bin_mask_host), bin_mask_buff);
+
+    return bin(spacepoints_view, bin_mask_buff);
+}
+
+sp_grid_buffer spacepoint_binning::bin(
+    const spacepoint_collection_types::const_view& spacepoints_view,
+    const vecmem::data::vector_view<const char>& bin_mask_view) const {
+
     // Get a convenience variable for the stream that we'll be using.
     cudaStream_t stream = details::get_stream(m_stream);
 
@@ -74,12 +108,12 @@ sp_grid_buffer spacepoint_binning::operator()(
         grid_capacities_buff;
 
     // Calculate the number of threads and thread blocks to run the kernels for.
-    const unsigned int num_threads = WARP_SIZE * 8;
+    const unsigned int num_threads = m_launch.binning_block_size;
     const unsigned int num_blocks = (sp_size + num_threads - 1) / num_threads;
 
     // Fill the grid capacity container.
     kernels::count_grid_capacities<<<num_blocks, num_threads, 0, stream>>>(
-        m_config, m_axes.first, m_axes.second, spacepoints_view,
+        m_config, m_axes.first, m_axes.second, spacepoints_view, bin_mask_view,
         grid_capacities_view);
     CUDA_ERROR_CHECK(cudaGetLastError());
 
@@ -100,7 +134,7 @@ sp_grid_buffer spacepoint_binning::operator()(
 
     // Populate the grid.
     kernels::populate_grid<<<num_blocks, num_threads, 0, stream>>>(
-        m_config, spacepoints_view, grid_view);
+        m_config, spacepoints_view, bin_mask_view, grid_view);
     CUDA_ERROR_CHECK(cudaGetLastError());
     m_stream.synchronize();
 
@@ -21,9 +21,10 @@ namespace traccc::kokkos {
 
 spacepoint_binning::spacepoint_binning(
     const seedfinder_config& config, const spacepoint_grid_config& grid_config,
-    const traccc::memory_resource& mr)
+    const traccc::memory_resource& mr, const seeding_launch_config& launch)
     : m_config(config.toInternalUnits()),
       m_axes(get_axes(grid_config.toInternalUnits(), *(mr.host))),
+      m_launch(launch),
       m_mr(mr) {
     m_copy = std::make_unique<vecmem::copy>();
 }
@@ -45,7 +46,7 @@ spacepoint_binning::output_type spacepoint_binning::operator()(
         grid_capacities_buff;
 
     // Calculate the number of threads and thread blocks to run the kernels for.
-    const unsigned int num_threads = 32 * 8;
+    const unsigned int num_threads = m_launch.binning_block_size;
     const unsigned int num_blocks = (sp_size + num_threads - 1) / num_threads;
 
     Kokkos::parallel_for(
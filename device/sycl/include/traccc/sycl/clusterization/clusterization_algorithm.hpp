@@ -12,6 +12,7 @@
 
 // Project include(s).
 #include "traccc/edm/alt_cell.hpp"
+#include "traccc/edm/alt_cell_soa.hpp"
 #include "traccc/edm/alt_measurement.hpp"
 #include "traccc/edm/cluster.hpp"
 #include "traccc/edm/measurement.hpp"
@@ -47,13 +48,27 @@ class clusterization_algorithm
 
     /// @param cells        a collection of cells
     /// @param modules      a collection of modules
-    /// @return a spacepoint collection (buffer) and a collection (buffer) of
-    /// links from cells to the spacepoints they belong to.
+    /// @return a spacepoint collection (resizable buffer) and a collection
+    /// (buffer) of links from cells to the spacepoints they belong to.
     output_type operator()(
         const alt_cell_collection_types::const_view& cells,
         const cell_module_collection_types::const_view& modules) const override;
 
+    /// @param cells        a collection of cells, as structure of arrays
+    /// @param modules      a collection of modules
+    /// @return a spacepoint collection (resizable buffer) and a collection
+    /// (buffer) of links from cells to the spacepoints they belong to.
+    output_type operator()(
+        const alt_cell_soa_types::const_view& cells,
+        const cell_module_collection_types::const_view& modules) const;
+
     private:
+    /// Run the clusterization on either cell layout
+    template <typename cell_types>
+    output_type run(
+        const typename cell_types::const_view& cells, unsigned int num_cells,
+        const cell_module_collection_types::const_view& modules) const;
+
     /// The average number of cells in each partition
     unsigned short m_target_cells_per_partition;
     /// The maximum number of threads in a work group
@@ -14,7 +14,9 @@
 #include "traccc/edm/alt_seed.hpp"
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/seeding/detail/seeding_launch_config.hpp"
 #include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_grid_neighbors.hpp"
 #include "traccc/utils/algorithm.hpp"
 #include "traccc/utils/memory_resource.hpp"
 
@@ -23,7 +25,10 @@
 #include <vecmem/utils/copy.hpp>
 
 // System include(s).
+#include <array>
 #include <functional>
+#include <memory>
+#include <mutex>
 
 namespace traccc::sycl {
 
@@ -41,9 +46,12 @@ class seed_finding : public algorithm<alt_seed_collection_types::buffer(
     /// host & device)
     /// @param queue    is a wrapper for the sycl queue for kernel
     /// invocation
+    /// @param launch   The kernel launch sizes to use (only the finding
+    /// block size is used by this algorithm)
     seed_finding(const seedfinder_config& config,
                  const seedfilter_config& filter_config,
-                 const traccc::memory_resource& mr, queue_wrapper queue);
+                 const traccc::memory_resource& mr, queue_wrapper queue,
+                 const seeding_launch_config& launch = {});
 
     /// Callable operator for the seed finding
     ///
@@ -56,12 +64,33 @@ class seed_finding : public algorithm<alt_seed_collection_types::buffer(
         const sp_grid_const_view& g2_view) const override;
 
     private:
+    /// Get the (device) neighbour bin table for the shape of a grid
+    ///
+    /// The table is only built and copied to the device on the first call,
+    /// and again if the shape of the grid changes. The caller shares the
+    /// ownership of the table, so a call with a different grid shape can not
+    /// release it while kernels are still reading it.
+    ///
+    /// @param g2_view is a view of the spacepoint grid
+    /// @return the neighbour bin table in device memory
+    ///
+    std::shared_ptr<const sp_grid_neighbors_buffer> get_neighbors(
+        const sp_grid_const_view& g2_view) const;
+
     /// Private member variables
     seedfinder_config m_seedfinder_config;
     seedfilter_config m_seedfilter_config;
+    seeding_launch_config m_launch;
     traccc::memory_resource m_mr;
     mutable queue_wrapper m_queue;
     std::unique_ptr<vecmem::copy> m_copy;
+
+    /// Mutex protecting the neighbour bin table
+    mutable std::mutex m_neighbors_mutex;
+    /// The (Phi, Z) shape of the grid that the neighbour bin table is for
+    mutable std::array<unsigned int, 2> m_neighbors_shape{0u, 0u};
+    /// Neighbour bin table of the grids seen by the algorithm
+    mutable std::shared_ptr<const sp_grid_neighbors_buffer> m_neighbors;
 };
 
 }  // namespace traccc::sycl
@@ -15,6 +15,7 @@
 // Project include(s).
 #include "traccc/edm/alt_seed.hpp"
 #include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/seeding_launch_config.hpp"
 #include "traccc/utils/algorithm.hpp"
 
 // VecMem include(s).
@@ -34,9 +35,11 @@ class seeding_algorithm : public algorithm<alt_seed_collection_types::buffer(
     ///
     /// @param mr is a struct of memory resources (shared or host & device)
     /// @param queue The SYCL queue to work with
+    /// @param launch The kernel launch sizes to use
     ///
     seeding_algorithm(const traccc::memory_resource& mr,
-                      const queue_wrapper& queue);
+                      const queue_wrapper& queue,
+                      const seeding_launch_config& launch = {});
 
     /// Operator executing the algorithm.
     ///
@@ -13,6 +13,7 @@
 // Project include(s).
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/seeding/detail/seeding_launch_config.hpp"
 #include "traccc/seeding/detail/spacepoint_grid.hpp"
 #include "traccc/utils/algorithm.hpp"
 #include "traccc/utils/memory_resource.hpp"
@@ -34,9 +35,14 @@ class spacepoint_binning
 
     public:
     /// Constructor for the algorithm
+    ///
+    /// @param launch The kernel launch sizes to use (only the binning block
+    ///               size is used by this algorithm)
+    ///
     spacepoint_binning(const seedfinder_config& config,
                        const spacepoint_grid_config& grid_config,
-                       const traccc::memory_resource& mr, queue_wrapper queue);
+                       const traccc::memory_resource& mr, queue_wrapper queue,
+                       const seeding_launch_config& launch = {});
 
     /// Function executing the algorithm with a a view of spacepoints
     sp_grid_buffer operator()(const spacepoint_collection_types::const_view&
@@ -46,6 +52,7 @@ class spacepoint_binning
     /// Member variables
     seedfinder_config m_config;
     std::pair<sp_grid::axis_p0_type, sp_grid::axis_p1_type> m_axes;
+    seeding_launch_config m_launch;
     traccc::memory_resource m_mr;
     mutable queue_wrapper m_queue;
     std::unique_ptr<vecmem::copy> m_copy;
@@ -59,11 +59,13 @@ traccc::spacepoint_grid_config default_spacepoint_grid_config() {
 namespace traccc::sycl {
 
 seeding_algorithm::seeding_algorithm(const traccc::memory_resource& mr,
-                                     const queue_wrapper& queue)
+                                     const queue_wrapper& queue,
+                                     const seeding_launch_config& launch)
     : m_spacepoint_binning(default_seedfinder_config(),
-                           default_spacepoint_grid_config(), mr, queue),
+                           default_spacepoint_grid_config(), mr, queue,
+                           launch),
       m_seed_finding(default_seedfinder_config(), seedfilter_config(), mr,
-                     queue) {}
+                     queue, launch) {}
 
 seeding_algorithm::output_type seeding_algorithm::operator()(
     const spacepoint_collection_types::const_view& spacepoints_view) const {
@@ -0,0 +1,37 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// SYCL include(s).
+#include <CL/sycl.hpp>
+
+namespace traccc::sycl::details {
+
+/// Finish the work submitted by an algorithm
+///
+/// The algorithms chain their kernels through event dependencies, and only
+/// need to make sure at their end that the results are ready for whoever
+/// uses them next. On an in-order queue all later submissions, including the
+/// copies made by @c vecmem::sycl::copy, are executed after @c last anyway,
+/// so the function returns right away. Otherwise it waits for @c last.
+///
+/// Asynchronous errors of the work are then reported by whoever waits for
+/// the queue next. (@c traccc::sycl::full_chain_algorithm does that once at
+/// the end of every event.)
+///
+/// It must only be used if @c last does not read or write memory owned by
+/// the algorithm, as that is released when the algorithm returns.
+///
+/// @param queue The queue that the work was submitted to
+/// @param last The event of the last submission of the algorithm
+/// @param host_access Whether the results may be accessed directly by the
+///                    host, without going through the queue
+///
+void finish(::sycl::queue& queue, ::sycl::event& last, bool host_access);
+
+}  // namespace traccc::sycl::details
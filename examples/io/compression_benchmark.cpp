@@ -0,0 +1,162 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/io/cell_compression.hpp"
+#include "traccc/io/read_cells.hpp"
+#include "traccc/io/read_digitization_config.hpp"
+#include "traccc/io/read_geometry.hpp"
+#include "traccc/io/utils.hpp"
+#include "traccc/io/write.hpp"
+#include "traccc/options/common_options.hpp"
+#include "traccc/options/handle_argument_errors.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s).
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace po = boost::program_options;
+
+namespace {
+
+/// Size of the decoded cells of an event in memory
+std::size_t decoded_size(const traccc::cell_container_types::host& cells) {
+    return cells.size() * sizeof(traccc::cell_module) +
+           cells.total_size() * sizeof(traccc::cell);
+}
+
+/// Print the results of one benchmark
+void print_rate(const std::string& name, std::size_t bytes, double seconds) {
+    std::cout << name << bytes / seconds * 1e-9 << " GB/s" << std::endl;
+}
+
+}  // namespace
+
+/// Compare the size and the decoding speed of the raw and the compressed
+/// binary cell formats
+///
+/// Both formats are written for the selected events into the input
+/// directory, next to the CSV files that they are made from, and then read
+/// back multiple times. The files are expected to be in the page cache for
+/// all but the first repetition.
+///
+int main(int argc, char* argv[]) {
+
+    // Set up the program options
+    po::options_description desc("Allowed options");
+    desc.add_options()("help,h", "Give some help with the program's options");
+    desc.add_options()("detector_file", po::value<std::string>()->required(),
+                       "specify detector file");
+    desc.add_options()("digitization_config_file",
+                       po::value<std::string>()->required(),
+                       "specify digitization configuration file");
+    desc.add_options()("activation_bits",
+                       po::value<unsigned int>()->default_value(0),
+                       "number of bits to quantize the activations to (0 for "
+                       "lossless compression)");
+    desc.add_options()("repetitions",
+                       po::value<unsigned int>()->default_value(10),
+                       "number of times to decode all events");
+    traccc::common_options common_opts(desc);
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    traccc::handle_argument_errors(vm, desc);
+    common_opts.read(vm);
+    traccc::io::cell_compression_config compression;
+    compression.activation_bits = vm["activation_bits"].as<unsigned int>();
+    const unsigned int repetitions = vm["repetitions"].as<unsigned int>();
+
+    // Read the detector description.
+    const traccc::geometry surface_transforms = traccc::io::read_geometry(
+        vm["detector_file"].as<std::string>());
+    const traccc::digitization_config digi_cfg =
+        traccc::io::read_digitization_config(
+            vm["digitization_config_file"].as<std::string>());
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Read the input events, and write them in both binary formats.
+    std::vector<std::string> raw_files, compressed_files;
+    std::vector<std::vector<char> > compressed_data;
+    std::size_t raw_bytes = 0, compressed_bytes = 0, cell_bytes = 0;
+    for (unsigned int event = common_opts.skip;
+         event < common_opts.events + common_opts.skip; ++event) {
+
+        const traccc::cell_container_types::host cells =
+            traccc::io::read_cells(event, common_opts.input_directory,
+                                   common_opts.input_data_format,
+                                   &surface_transforms, &digi_cfg, &host_mr);
+        cell_bytes += decoded_size(cells);
+        compressed_data.push_back(
+            traccc::io::compress_cells(traccc::get_data(cells), compression));
+
+        traccc::io::write(event, common_opts.input_directory,
+                          traccc::data_format::binary, traccc::get_data(cells));
+        traccc::io::write(event, common_opts.input_directory,
+                          traccc::data_format::compressed,
+                          traccc::get_data(cells), compression);
+
+        const std::string base = traccc::io::data_directory() +
+                                 common_opts.input_directory +
+                                 traccc::io::get_event_filename(event, "");
+        raw_files.push_back(base + "-cells.dat");
+        compressed_files.push_back(base + "-cells.cdat");
+        raw_bytes += std::filesystem::file_size(raw_files.back());
+        compressed_bytes += std::filesystem::file_size(compressed_files.back());
+    }
+
+    std::cout << "Events             : " << raw_files.size() << "\n"
+              << "Activation bits    : " << compression.activation_bits
+              << "\n"
+              << "Raw size           : " << raw_bytes << " bytes\n"
+              << "Compressed size    : " << compressed_bytes << " bytes\n"
+              << "Compression ratio  : "
+              << static_cast<double>(raw_bytes) / compressed_bytes << "\n"
+              << std::endl;
+
+    // Benchmark the decoding of the files. The rates are given in terms of
+    // the decoded cell data.
+    using clock = std::chrono::steady_clock;
+    const auto benchmark = [&](const auto& func) {
+        const clock::time_point start = clock::now();
+        for (unsigned int r = 0; r < repetitions; ++r) {
+            for (std::size_t i = 0; i < raw_files.size(); ++i) {
+                func(i);
+            }
+        }
+        return std::chrono::duration<double>(clock::now() - start).count();
+    };
+    print_rate("Raw file read      : ", cell_bytes * repetitions,
+               benchmark([&](std::size_t i) {
+                   traccc::io::read_cells(raw_files[i],
+                                          traccc::data_format::binary,
+                                          nullptr, nullptr, &host_mr);
+               }));
+    print_rate("Compressed read    : ", cell_bytes * repetitions,
+               benchmark([&](std::size_t i) {
+                   traccc::io::read_cells(compressed_files[i],
+                                          traccc::data_format::compressed,
+                                          nullptr, nullptr, &host_mr);
+               }));
+    print_rate("In-memory decoding : ", cell_bytes * repetitions,
+               benchmark([&](std::size_t i) {
+                   traccc::io::decompress_cells(compressed_data[i].data(),
+                                                compressed_data[i].size(),
+                                                &host_mr);
+               }));
+
+    return 0;
+}
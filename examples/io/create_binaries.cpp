@@ -6,6 +6,7 @@
  */
 
 // Project include(s).
+#include "traccc/io/event_archive.hpp"
 #include "traccc/io/read_cells.hpp"
 #include "traccc/io/read_digitization_config.hpp"
 #include "traccc/io/read_geometry.hpp"
@@ -18,10 +19,15 @@
 // VecMem include(s).
 #include <vecmem/memory/host_memory_resource.hpp>
 
+// System include(s).
+#include <memory>
+
 namespace po = boost::program_options;
 
 int create_binaries(const std::string& detector_file,
                     const std::string& digi_config_file,
+                    const std::string& archive_file,
+                    const traccc::io::cell_compression_config* compression,
                     const traccc::common_options& common_opts) {
 
     // Read the surface transforms
@@ -33,6 +39,13 @@ int create_binaries(const std::string& detector_file,
     // Memory resource used by the EDM.
     vecmem::host_memory_resource host_mr;
 
+    // Pack all events into a single archive, if requested.
+    std::unique_ptr<traccc::io::event_archive_writer> archive;
+    if (!archive_file.empty()) {
+        archive =
+            std::make_unique<traccc::io::event_archive_writer>(archive_file);
+    }
+
     // Loop over events
     for (unsigned int event = common_opts.skip;
          event < common_opts.events + common_opts.skip; ++event) {
@@ -42,32 +55,44 @@ int create_binaries(const std::string& detector_file,
             event, common_opts.input_directory, common_opts.input_data_format,
             &surface_transforms, &digi_cfg, &host_mr);
 
-        // Write binary file
-        traccc::io::write(event, common_opts.input_directory,
-                          traccc::data_format::binary,
-                          traccc::get_data(cells_csv));
-
         // Read the hits from the relevant event file
         traccc::spacepoint_container_types::host spacepoints_csv =
             traccc::io::read_spacepoints(
                 event, common_opts.input_directory, surface_transforms,
                 common_opts.input_data_format, &host_mr);
 
-        // Write binary file
-        traccc::io::write(event, common_opts.input_directory,
-                          traccc::data_format::binary,
-                          traccc::get_data(spacepoints_csv));
-
         // Read the measurements from the relevant event file
         traccc::measurement_container_types::host measurements_csv =
             traccc::io::read_measurements(event, common_opts.input_directory,
                                           common_opts.input_data_format,
                                           &host_mr);
 
-        // Write binary file
-        traccc::io::write(event, common_opts.input_directory,
-                          traccc::data_format::binary,
-                          traccc::get_data(measurements_csv));
+        // Write the event into the archive, or into per-event binary files
+        if (archive) {
+            archive->add(event, cells_csv, &spacepoints_csv,
+                         &measurements_csv);
+        } else {
+            if (compression != nullptr) {
+                traccc::io::write(event, common_opts.input_directory,
+                                  traccc::data_format::compressed,
+                                  traccc::get_data(cells_csv), *compression);
+            } else {
+                traccc::io::write(event, common_opts.input_directory,
+                                  traccc::data_format::binary,
+                                  traccc::get_data(cells_csv));
+            }
+            traccc::io::write(event, common_opts.input_directory,
+                              traccc::data_format::binary,
+                              traccc::get_data(spacepoints_csv));
+            traccc::io::write(event, common_opts.input_directory,
+                              traccc::data_format::binary,
+                              traccc::get_data(measurements_csv));
+        }
+    }
+
+    // Write the index of the archive.
+    if (archive) {
+        archive->close();
     }
 
     return 0;
@@ -86,6 +111,17 @@ int main(int argc, char* argv[]) {
     desc.add_options()("digitization_config_file",
                        po::value<std::string>()->required(),
                        "specify digitization configuration file");
+    desc.add_options()("archive_file",
+                       po::value<std::string>()->default_value(""),
+                       "pack all events into this single archive file, "
+                       "instead of writing per-event binary files");
+    desc.add_options()("compress_cells",
+                       po::value<bool>()->default_value(false),
+                       "write the cells in the compressed binary format");
+    desc.add_options()("activation_bits",
+                       po::value<unsigned int>()->default_value(0),
+                       "number of bits to quantize the activations of "
+                       "compressed cells to (0 for lossless compression)");
     traccc::common_options common_opts(desc);
 
     po::variables_map vm;
@@ -97,7 +133,13 @@ int main(int argc, char* argv[]) {
     // Read options
     auto detector_file = vm["detector_file"].as<std::string>();
     auto digi_config_file = vm["digitization_config_file"].as<std::string>();
+    auto archive_file = vm["archive_file"].as<std::string>();
+    traccc::io::cell_compression_config compression;
+    compression.activation_bits = vm["activation_bits"].as<unsigned int>();
     common_opts.read(vm);
 
-    return create_binaries(detector_file, digi_config_file, common_opts);
+    return create_binaries(
+        detector_file, digi_config_file, archive_file,
+        vm["compress_cells"].as<bool>() ? &compression : nullptr,
+        common_opts);
 }
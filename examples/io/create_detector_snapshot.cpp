@@ -0,0 +1,77 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/io/detector_snapshot.hpp"
+#include "traccc/io/details/read_surfaces.hpp"
+#include "traccc/io/read_digitization_config.hpp"
+#include "traccc/io/utils.hpp"
+#include "traccc/options/handle_argument_errors.hpp"
+
+// Boost include(s).
+#include <boost/program_options.hpp>
+
+// System include(s).
+#include <iostream>
+#include <string>
+
+namespace po = boost::program_options;
+
+int create_detector_snapshot(const std::string& detector_file,
+                             const std::string& digi_config_file,
+                             const std::string& output_file) {
+
+    // Read the surface transforms
+    const auto surface_transforms = traccc::io::details::read_surfaces(
+        traccc::io::data_directory() + detector_file);
+
+    // Read the digitization configuration file
+    const auto digi_cfg =
+        traccc::io::read_digitization_config(digi_config_file);
+
+    // Write the snapshot file
+    traccc::io::write_detector_snapshot(output_file, surface_transforms,
+                                        digi_cfg);
+
+    // Make sure that the file can be read back.
+    const traccc::io::detector_snapshot snapshot{output_file};
+    std::cout << "Wrote the description of " << snapshot.size()
+              << " modules into: " << output_file << std::endl;
+
+    return 0;
+}
+
+// The main routine
+//
+int main(int argc, char* argv[]) {
+    // Set up the program options
+    po::options_description desc("Allowed options");
+
+    // Add options
+    desc.add_options()("help,h", "Give some help with the program's options");
+    desc.add_options()("detector_file", po::value<std::string>()->required(),
+                       "specify detector file");
+    desc.add_options()("digitization_config_file",
+                       po::value<std::string>()->required(),
+                       "specify digitization configuration file");
+    desc.add_options()("output_file", po::value<std::string>()->required(),
+                       "specify the output detector snapshot file");
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+
+    // Check errors
+    traccc::handle_argument_errors(vm, desc);
+
+    // Read options
+    auto detector_file = vm["detector_file"].as<std::string>();
+    auto digi_config_file = vm["digitization_config_file"].as<std::string>();
+    auto output_file = vm["output_file"].as<std::string>();
+
+    return create_detector_snapshot(detector_file, digi_config_file,
+                                    output_file);
+}
@@ -21,6 +21,9 @@ struct mt_options {
 
     /// The number of threads to use for the data processing
     std::size_t threads = 1;
+    /// Use one task arena per NUMA node, with the input events replicated
+    /// on every node
+    bool numa = false;
 
     /// Constructor on top of a common @c program_options object
     ///
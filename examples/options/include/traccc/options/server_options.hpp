@@ -0,0 +1,49 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Boost include(s).
+#include <boost/program_options.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+
+namespace traccc {
+
+/// Options for the reconstruction server, and its clients
+struct server_options {
+
+    /// The Unix domain socket that the server listens on
+    std::string socket = "/tmp/traccc_server.sock";
+    /// The number of requests sent by every benchmark client connection
+    std::size_t requests = 100;
+    /// The largest number of modules that the server accepts in a request
+    std::size_t max_request_modules = 1000000;
+    /// The largest number of cells that the server accepts in a request
+    std::size_t max_request_cells = 10000000;
+
+    /// Constructor on top of a common @c program_options object
+    ///
+    /// @param desc The program options to add to
+    ///
+    server_options(boost::program_options::options_description& desc);
+
+    /// Read the command line options
+    ///
+    /// @param vm The command line options to interpret/read
+    ///
+    void read(const boost::program_options::variables_map& vm);
+
+};  // struct server_options
+
+/// Printout helper for @c traccc::server_options
+std::ostream& operator<<(std::ostream& out, const server_options& opt);
+
+}  // namespace traccc
@@ -31,6 +31,12 @@ struct throughput_options {
     std::string detector_file;
     /// The file describing the detector digitization configuration
     std::string digitization_config_file;
+    /// Binary detector snapshot to use instead of the geometry and
+    /// digitization configuration files (if not empty)
+    std::string detector_snapshot_file;
+    /// Event archive to read the events from, instead of the per-event files
+    /// in the input directory (if not empty)
+    std::string input_archive;
 
     /// The average number of cells in each partition.
     /// Equal to the number of threads in the clusterization kernels multiplied
@@ -49,6 +55,35 @@ struct throughput_options {
     /// Output log file
     std::string log_file;
 
+    /// Whether to print per-stage host memory allocation profiles
+    bool memory_profile = false;
+    /// Whether to measure the energy used by the host, with the Linux
+    /// powercap (RAPL) energy counters
+    bool energy_profile = false;
+
+    /// Buffer sizing profile to pre-size the memory caches with (if not
+    /// empty)
+    std::string sizing_profile_input;
+    /// File to write the buffer sizing profile of the job into (if not empty)
+    std::string sizing_profile_output;
+
+    /// File to append the reconstructed track parameters to (if not empty)
+    std::string output_file;
+
+    /// Whether to run calibration sweeps over the tunable parameters of the
+    /// job before the measurement, and use the best configuration found
+    bool autotune = false;
+    /// The number of events to process with every configuration during the
+    /// calibration sweeps
+    std::size_t tuning_events = 20;
+    /// File holding the tuned parameters of earlier jobs (if not empty)
+    ///
+    /// The tuned parameters of the current host and application are taken
+    /// from it, if available. With @c autotune, the results of the
+    /// calibration sweeps are written into it.
+    ///
+    std::string tuning_file;
+
     /// Constructor on top of a common @c program_options object
     ///
     /// @param desc The program options to add to
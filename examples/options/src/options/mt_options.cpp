@@ -20,6 +20,9 @@ mt_options::mt_options(boost::program_options::options_description& desc) {
         "threads",
         boost::program_options::value<std::size_t>()->default_value(1),
         "The number of CPU threads to use");
+    desc.add_options()(
+        "numa", boost::program_options::value<bool>()->default_value(false),
+        "Pin the threads, input events and memory caches to NUMA nodes");
 }
 
 void mt_options::read(const boost::program_options::variables_map& vm) {
@@ -28,12 +31,14 @@ void mt_options::read(const boost::program_options::variables_map& vm) {
     if (threads == 0) {
         throw std::invalid_argument{"Must use threads>0"};
     }
+    numa = vm["numa"].as<bool>();
 }
 
 std::ostream& operator<<(std::ostream& out, const mt_options& opt) {
 
     out << ">>> Multi-threading options <<<\n"
-        << "CPU threads: " << opt.threads;
+        << "CPU threads: " << opt.threads << "\n"
+        << "NUMA aware : " << (opt.numa ? "yes" : "no");
     return out;
 }
 
@@ -0,0 +1,54 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/options/server_options.hpp"
+
+// System include(s).
+#include <iostream>
+
+namespace traccc {
+
+namespace po = boost::program_options;
+
+server_options::server_options(po::options_description& desc) {
+
+    desc.add_options()(
+        "socket",
+        po::value<std::string>()->default_value("/tmp/traccc_server.sock"),
+        "The Unix domain socket of the reconstruction server");
+    desc.add_options()(
+        "requests", po::value<std::size_t>()->default_value(100),
+        "The number of requests sent by every benchmark client connection");
+    desc.add_options()(
+        "max_request_modules",
+        po::value<std::size_t>()->default_value(1000000),
+        "The largest number of modules that the server accepts in a request");
+    desc.add_options()(
+        "max_request_cells", po::value<std::size_t>()->default_value(10000000),
+        "The largest number of cells that the server accepts in a request");
+}
+
+void server_options::read(const po::variables_map& vm) {
+
+    socket = vm["socket"].as<std::string>();
+    requests = vm["requests"].as<std::size_t>();
+    max_request_modules = vm["max_request_modules"].as<std::size_t>();
+    max_request_cells = vm["max_request_cells"].as<std::size_t>();
+}
+
+std::ostream& operator<<(std::ostream& out, const server_options& opt) {
+
+    out << ">>> Server options <<<\n"
+        << "Socket          : " << opt.socket << "\n"
+        << "Client requests : " << opt.requests << "\n"
+        << "Max. modules    : " << opt.max_request_modules << "\n"
+        << "Max. cells      : " << opt.max_request_cells;
+    return out;
+}
+
+}  // namespace traccc
@@ -28,6 +28,14 @@ throughput_options::throughput_options(po::options_description& desc) {
     desc.add_options()("digitization_config_file",
                        po::value<std::string>()->required(),
                        "Digitization configuration file");
+    desc.add_options()(
+        "detector_snapshot_file", po::value<std::string>()->default_value(""),
+        "Binary detector snapshot, used instead of the detector geometry and "
+        "digitization configuration files if specified");
+    desc.add_options()(
+        "input_archive", po::value<std::string>()->default_value(""),
+        "Event archive to read the events from, instead of the per-event "
+        "files of the input directory");
     desc.add_options()(
         "target_cells_per_partition",
         po::value<unsigned short>()->default_value(1024),
@@ -47,6 +55,35 @@ throughput_options::throughput_options(po::options_description& desc) {
         "log_file",
         po::value<std::string>()->default_value(
             "\0", "File where result logs will be printed (in append mode)."));
+    desc.add_options()("memory_profile",
+                       po::value<bool>()->default_value(false),
+                       "Print the host memory allocation profile of each "
+                       "algorithm stage");
+    desc.add_options()("energy_profile",
+                       po::value<bool>()->default_value(false),
+                       "Measure the energy used by the host CPUs and memory "
+                       "with the Linux powercap (RAPL) counters");
+    desc.add_options()(
+        "sizing_profile_input", po::value<std::string>()->default_value(""),
+        "Buffer sizing profile to pre-size the memory caches with");
+    desc.add_options()(
+        "sizing_profile_output", po::value<std::string>()->default_value(""),
+        "File to write the buffer sizing profile of the job into");
+    desc.add_options()(
+        "output_file", po::value<std::string>()->default_value(""),
+        "File to append the reconstructed track parameters to, to measure "
+        "the overhead of writing the reconstruction output");
+    desc.add_options()("autotune", po::value<bool>()->default_value(false),
+                       "Run calibration sweeps over the tunable parameters "
+                       "of the job, and use the best configuration found");
+    desc.add_options()("tuning_events",
+                       po::value<std::size_t>()->default_value(20),
+                       "Number of events to process with every configuration "
+                       "during the calibration sweeps");
+    desc.add_options()(
+        "tuning_file", po::value<std::string>()->default_value(""),
+        "File to take the tuned parameters from, and to write the results of "
+        "the calibration sweeps into");
 }
 
 void throughput_options::read(const po::variables_map& vm) {
@@ -59,6 +96,8 @@ void throughput_options::read(const po::variables_map& vm) {
             input_data_format = data_format::csv;
         } else if (input_format_string == "binary") {
             input_data_format = data_format::binary;
+        } else if (input_format_string == "compressed") {
+            input_data_format = data_format::compressed;
         } else {
             throw std::invalid_argument("Invalid input data format specified");
         }
@@ -68,12 +107,25 @@ void throughput_options::read(const po::variables_map& vm) {
     input_directory = vm["input_directory"].as<std::string>();
     detector_file = vm["detector_file"].as<std::string>();
     digitization_config_file = vm["digitization_config_file"].as<std::string>();
+    detector_snapshot_file = vm["detector_snapshot_file"].as<std::string>();
+    input_archive = vm["input_archive"].as<std::string>();
     target_cells_per_partition =
         vm["target_cells_per_partition"].as<unsigned short>();
     loaded_events = vm["loaded_events"].as<std::size_t>();
     processed_events = vm["processed_events"].as<std::size_t>();
     cold_run_events = vm["cold_run_events"].as<std::size_t>();
     log_file = vm["log_file"].as<std::string>();
+    memory_profile = vm["memory_profile"].as<bool>();
+    energy_profile = vm["energy_profile"].as<bool>();
+    sizing_profile_input = vm["sizing_profile_input"].as<std::string>();
+    sizing_profile_output = vm["sizing_profile_output"].as<std::string>();
+    output_file = vm["output_file"].as<std::string>();
+    autotune = vm["autotune"].as<bool>();
+    tuning_events = vm["tuning_events"].as<std::size_t>();
+    if (autotune && (tuning_events == 0)) {
+        throw std::invalid_argument{"Must use tuning_events>0"};
+    }
+    tuning_file = vm["tuning_file"].as<std::string>();
 }
 
 std::ostream& operator<<(std::ostream& out, const throughput_options& opt) {
@@ -84,12 +136,27 @@ std::ostream& operator<<(std::ostream& out, const throughput_options& opt) {
         << "Detector geometry          : " << opt.detector_file << "\n"
         << "Digitization config        : " << opt.digitization_config_file
         << "\n"
+        << "Detector snapshot          : " << opt.detector_snapshot_file
+        << "\n"
+        << "Input archive              : " << opt.input_archive << "\n"
         << "Target cells per partition : " << opt.target_cells_per_partition
         << "\n"
         << "Loaded event(s)            : " << opt.loaded_events << "\n"
         << "Cold run event(s)          : " << opt.cold_run_events << "\n"
         << "Processed event(s)         : " << opt.processed_events << "\n"
-        << "Log_file                   : " << opt.log_file;
+        << "Log_file                   : " << opt.log_file << "\n"
+        << "Memory profile             : "
+        << (opt.memory_profile ? "yes" : "no") << "\n"
+        << "Energy profile             : "
+        << (opt.energy_profile ? "yes" : "no") << "\n"
+        << "Sizing profile input       : " << opt.sizing_profile_input << "\n"
+        << "Sizing profile output      : " << opt.sizing_profile_output
+        << "\n"
+        << "Output file                : " << opt.output_file << "\n"
+        << "Autotuning                 : " << (opt.autotune ? "yes" : "no")
+        << "\n"
+        << "Tuning event(s)            : " << opt.tuning_events << "\n"
+        << "Tuning file                : " << opt.tuning_file;
     return out;
 }
 
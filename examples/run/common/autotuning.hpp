@@ -0,0 +1,126 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Command line option include(s).
+#include "traccc/options/throughput_options.hpp"
+
+// Performance measurement include(s).
+#include "traccc/performance/tuning_profile.hpp"
+
+// Project include(s).
+#include "traccc/seeding/detail/seeding_launch_config.hpp"
+
+// System include(s).
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+namespace traccc {
+
+/// Decide the values of the tunable parameters of a throughput test
+///
+/// With autotuning requested, calibration sweeps are run over the tuning
+/// space, and the best configuration found is written into the tuning file
+/// (if one was given). Otherwise the values tuned by an earlier job of the
+/// same application, on the same host, are taken from the tuning file (if
+/// available). The values given on the command line are used as a fallback,
+/// and as the starting point of the calibration sweeps.
+///
+/// @param cfg The throughput test options
+/// @param description The description of the application
+/// @param defaults The values given on the command line
+/// @param space The candidate values of the tunable parameters
+/// @param measure Function measuring the throughput of a configuration
+/// @return The values of the tunable parameters to use
+///
+inline performance::tuning_values tune_parameters(
+    const throughput_options& cfg, std::string_view description,
+    const performance::tuning_values& defaults,
+    const performance::tuning_space& space,
+    const performance::tuning_measurement& measure) {
+
+    // Read the results of earlier jobs, if available.
+    const std::string key = performance::tuning_key(description);
+    performance::tuning_profile profile;
+    if ((!cfg.tuning_file.empty()) && std::ifstream{cfg.tuning_file}.good()) {
+        profile.read(cfg.tuning_file);
+    }
+
+    // Use the earlier results if no autotuning was requested.
+    if (!cfg.autotune) {
+        performance::tuning_values result = defaults;
+        const performance::tuning_values* tuned = profile.find(key);
+        if (tuned == nullptr) {
+            return result;
+        }
+        for (const auto& [name, value] : *tuned) {
+            if (result.find(name) != result.end()) {
+                result[name] = value;
+            }
+        }
+        std::cout << "Using tuned parameters: "
+                  << performance::to_string(result) << "\n"
+                  << std::endl;
+        return result;
+    }
+
+    // Run the calibration sweeps.
+    std::cout << "Running calibration sweeps with " << cfg.tuning_events
+              << " event(s) per configuration" << std::endl;
+    const performance::tuning_result tuned =
+        performance::autotune(defaults, space, measure, &std::cout);
+    std::cout << "Best configuration, out of " << tuned.measurements
+              << " measured: " << performance::to_string(tuned.best) << " ("
+              << tuned.throughput << " events/s)\n"
+              << std::endl;
+
+    // Save the result for later jobs.
+    if (!cfg.tuning_file.empty()) {
+        profile.data[key] = tuned.best;
+        profile.write(cfg.tuning_file);
+    }
+    return tuned.best;
+}
+
+/// The tunable parameters of the device algorithms, with starting values
+///
+/// @param target_cells_per_partition The value given on the command line
+/// @return The parameters, with the default kernel launch sizes
+///
+inline performance::tuning_values device_parameters(
+    unsigned short target_cells_per_partition) {
+
+    const seeding_launch_config launch;
+    return {{"target_cells_per_partition", target_cells_per_partition},
+            {"binning_block_size", launch.binning_block_size},
+            {"finding_block_size", launch.finding_block_size}};
+}
+
+/// Candidate values of the tunable parameters of the device algorithms
+inline performance::tuning_space device_tuning_space() {
+
+    return {{"target_cells_per_partition", {512, 1024, 2048, 4096}},
+            {"binning_block_size", {64, 128, 256, 512}},
+            {"finding_block_size", {32, 64, 128, 256}}};
+}
+
+/// Get the kernel launch sizes of the seeding out of tuned parameters
+inline seeding_launch_config seeding_launch(
+    const performance::tuning_values& values) {
+
+    seeding_launch_config result;
+    result.binning_block_size =
+        static_cast<unsigned int>(values.at("binning_block_size"));
+    result.finding_block_size =
+        static_cast<unsigned int>(values.at("finding_block_size"));
+    return result;
+}
+
+}  // namespace traccc
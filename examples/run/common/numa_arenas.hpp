@@ -0,0 +1,157 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// TBB include(s).
+#include <tbb/info.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace traccc {
+
+/// Set of TBB task arenas, with one arena for every NUMA node used by a job
+///
+/// The worker threads of the job are divided evenly between the NUMA nodes
+/// of the machine, with the threads of every arena pinned to their node. On
+/// machines with a single NUMA node, when TBB can not determine the topology
+/// of the machine, or when NUMA awareness is not requested, a single arena
+/// is used that behaves like a plain @c tbb::task_arena.
+///
+/// Every thread of every arena has its own "slot" index, which can be used
+/// to look up per-thread objects. The slots of an arena are contiguous.
+///
+class numa_arenas {
+
+    public:
+    /// Constructor with the total number of worker threads
+    ///
+    /// @param threads The total number of worker threads to use
+    /// @param use_numa Whether to create one arena per NUMA node
+    ///
+    numa_arenas(std::size_t threads, bool use_numa) {
+
+        // Decide which NUMA nodes to use.
+        std::vector<tbb::numa_node_id> ids = {tbb::task_arena::automatic};
+        if (use_numa) {
+            const std::vector<tbb::numa_node_id> available =
+                tbb::info::numa_nodes();
+            if ((available.size() > 1) && (threads > 1)) {
+                ids.assign(available.begin(),
+                           available.begin() +
+                               std::min(available.size(), threads));
+            }
+        }
+
+        // Set up one arena per node, sharing the threads between them.
+        for (std::size_t i = 0; i < ids.size(); ++i) {
+            auto arena = std::make_unique<node_arena>();
+            arena->m_id = ids[i];
+            arena->m_threads =
+                threads / ids.size() + ((i < threads % ids.size()) ? 1 : 0);
+            arena->m_offset = m_slots;
+            arena->m_arena.initialize(
+                tbb::task_arena::constraints{
+                    ids[i], static_cast<int>(arena->m_threads)},
+                0);
+            // Leave room for a thread joining the arena from the outside.
+            m_slots += arena->m_threads + 1;
+            m_arenas.push_back(std::move(arena));
+        }
+    }
+
+    /// Get the number of arenas (NUMA nodes) in use
+    std::size_t size() const { return m_arenas.size(); }
+
+    /// Get the total number of thread slots of all arenas
+    std::size_t slots() const { return m_slots; }
+
+    /// Get the NUMA node ID of one of the arenas
+    tbb::numa_node_id numa_id(std::size_t index) const {
+        return m_arenas.at(index)->m_id;
+    }
+
+    /// Get the number of worker threads of one of the arenas
+    std::size_t threads(std::size_t index) const {
+        return m_arenas.at(index)->m_threads;
+    }
+
+    /// Get the first thread slot of one of the arenas
+    std::size_t slot_offset(std::size_t index) const {
+        return m_arenas.at(index)->m_offset;
+    }
+
+    /// Get the number of thread slots of one of the arenas
+    std::size_t slots(std::size_t index) const {
+        return m_arenas.at(index)->m_threads + 1;
+    }
+
+    /// Execute a function synchronously in one of the arenas
+    ///
+    /// Memory first touched by the function is placed on the NUMA node of
+    /// the arena.
+    ///
+    template <typename function_t>
+    void execute(std::size_t index, function_t&& func) {
+        m_arenas.at(index)->m_arena.execute(std::forward<function_t>(func));
+    }
+
+    /// Launch a task asynchronously in one of the arenas
+    ///
+    /// @param index The index of the arena to run the task in
+    /// @param func The task, receiving the slot index of the thread that it
+    ///             is executed on
+    ///
+    template <typename function_t>
+    void run(std::size_t index, function_t func) {
+        node_arena& arena = *(m_arenas.at(index));
+        arena.m_arena.execute([&arena, func]() {
+            arena.m_group.run([&arena, func]() {
+                func(arena.m_offset +
+                     static_cast<std::size_t>(
+                         tbb::this_task_arena::current_thread_index()));
+            });
+        });
+    }
+
+    /// Wait for all tasks launched with @c run to finish
+    void wait() {
+        for (std::unique_ptr<node_arena>& arena : m_arenas) {
+            arena->m_arena.execute([&arena]() { arena->m_group.wait(); });
+        }
+    }
+
+    private:
+    /// The arena of a single NUMA node
+    struct node_arena {
+        /// The NUMA node ID
+        tbb::numa_node_id m_id = tbb::task_arena::automatic;
+        /// The number of worker threads
+        std::size_t m_threads = 0;
+        /// The first thread slot
+        std::size_t m_offset = 0;
+        /// The TBB arena
+        tbb::task_arena m_arena;
+        /// The task group used for the tasks of the arena
+        tbb::task_group m_group;
+    };
+
+    /// The arenas in use
+    std::vector<std::unique_ptr<node_arena> > m_arenas;
+    /// The total number of thread slots
+    std::size_t m_slots = 0;
+
+};  // class numa_arenas
+
+}  // namespace traccc
@@ -0,0 +1,326 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/track_parametrization.hpp"
+#include "traccc/edm/alt_cell.hpp"
+#include "traccc/edm/track_parameters.hpp"
+
+// System include(s).
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+// POSIX include(s).
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/// Wire protocol of the traccc reconstruction server
+///
+/// Clients send the cells of an event, as alt-cells and the geometry IDs of
+/// the modules that the cells link to, over a Unix domain socket. The server
+/// answers every request with the track parameters that it reconstructed
+/// from the event, or with an error message. Any number of requests may be
+/// sent over one connection, one after the other. Since the client and the
+/// server run on the same host, all values are sent in the native byte
+/// order.
+///
+namespace traccc::server {
+
+/// Value at the start of every message
+static constexpr std::uint32_t message_magic = 0x43435254;
+
+/// Header of a reconstruction request
+///
+/// Followed by @c n_modules geometry IDs, and @c n_cells @c traccc::alt_cell
+/// objects.
+///
+struct request_header {
+    std::uint32_t magic = message_magic;
+    std::uint32_t n_modules = 0;
+    std::uint64_t n_cells = 0;
+};
+
+/// The largest reconstruction request that a server accepts
+struct request_limits {
+    /// The largest number of modules in a request
+    std::size_t max_modules = 1000000;
+    /// The largest number of cells in a request
+    std::size_t max_cells = 10000000;
+};
+
+/// Exception thrown for requests exceeding the server's limits
+///
+/// The payload of such a request is not read, so the connection can not be
+/// used for any further requests.
+///
+struct request_too_large : public std::runtime_error {
+    using std::runtime_error::runtime_error;
+};
+
+/// Status of a reconstruction request
+enum class response_status : std::uint32_t { success = 0, failure = 1 };
+
+/// Header of a reconstruction response
+///
+/// Followed by @c size @c traccc::server::track_parameters objects on
+/// success, or by an error message of @c size characters on failure.
+///
+struct response_header {
+    std::uint32_t magic = message_magic;
+    response_status status = response_status::success;
+    std::uint64_t size = 0;
+};
+
+/// Track parameters, as sent back to the clients
+struct track_parameters {
+    std::array<scalar, e_bound_size> vector;
+    std::array<scalar, e_bound_size * e_bound_size> covariance;
+};
+
+static_assert(std::is_trivially_copyable_v<alt_cell>,
+              "Cells must be possible to send as raw memory");
+
+/// Write a block of memory into a socket
+inline void write_all(int fd, const void* data, std::size_t size) {
+
+    const char* ptr = static_cast<const char*>(data);
+    while (size > 0) {
+        const ssize_t written = ::send(fd, ptr, size, MSG_NOSIGNAL);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::system_error(errno, std::generic_category(),
+                                    "Could not write to socket");
+        }
+        ptr += written;
+        size -= static_cast<std::size_t>(written);
+    }
+}
+
+/// Read a block of memory from a socket
+///
+/// @return @c false if the connection was closed before any data arrived
+///
+inline bool read_all(int fd, void* data, std::size_t size) {
+
+    char* ptr = static_cast<char*>(data);
+    std::size_t done = 0;
+    while (done < size) {
+        const ssize_t n = ::recv(fd, ptr + done, size - done, 0);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::system_error(errno, std::generic_category(),
+                                    "Could not read from socket");
+        }
+        if (n == 0) {
+            if (done == 0) {
+                return false;
+            }
+            throw std::runtime_error("Connection closed in the middle of a "
+                                     "message");
+        }
+        done += static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+/// Create the address of a Unix domain socket
+inline sockaddr_un make_address(const std::string& path) {
+
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path)) {
+        throw std::invalid_argument("Socket path is too long: " + path);
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size());
+    return address;
+}
+
+/// Create a socket listening for connections on a Unix domain socket path
+///
+/// An existing file at @c path is removed first.
+///
+inline int listen_on(const std::string& path, int backlog = 64) {
+
+    const sockaddr_un address = make_address(path);
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        throw std::system_error(errno, std::generic_category(),
+                                "Could not create socket");
+    }
+    ::unlink(path.c_str());
+    if ((::bind(fd, reinterpret_cast<const sockaddr*>(&address),
+                sizeof(address)) != 0) ||
+        (::listen(fd, backlog) != 0)) {
+        const int error = errno;
+        ::close(fd);
+        throw std::system_error(error, std::generic_category(),
+                                "Could not listen on " + path);
+    }
+    return fd;
+}
+
+/// Connect to a server listening on a Unix domain socket path
+inline int connect_to(const std::string& path) {
+
+    const sockaddr_un address = make_address(path);
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        throw std::system_error(errno, std::generic_category(),
+                                "Could not create socket");
+    }
+    if (::connect(fd, reinterpret_cast<const sockaddr*>(&address),
+                  sizeof(address)) != 0) {
+        const int error = errno;
+        ::close(fd);
+        throw std::system_error(error, std::generic_category(),
+                                "Could not connect to " + path);
+    }
+    return fd;
+}
+
+/// Send a reconstruction request
+///
+/// @param fd The connected socket
+/// @param event The cells of the event, and the modules they link to
+///
+inline void send_request(int fd, const alt_cell_reader_output_t& event) {
+
+    request_header header;
+    header.n_modules = static_cast<std::uint32_t>(event.modules.size());
+    header.n_cells = event.cells.size();
+    std::vector<std::uint64_t> module_ids;
+    module_ids.reserve(event.modules.size());
+    for (const cell_module& module : event.modules) {
+        module_ids.push_back(module.module);
+    }
+
+    write_all(fd, &header, sizeof(header));
+    write_all(fd, module_ids.data(),
+              module_ids.size() * sizeof(std::uint64_t));
+    write_all(fd, event.cells.data(), event.cells.size() * sizeof(alt_cell));
+}
+
+/// Receive a reconstruction request
+///
+/// The sizes claimed by the client are checked against @c limits before any
+/// memory is allocated for the payload.
+///
+/// @param fd The connected socket
+/// @param limits The largest request to accept
+/// @param module_ids The geometry IDs of the modules of the event
+/// @param cells The cells of the event
+/// @return @c false if the client closed the connection
+///
+/// @throws traccc::server::request_too_large if the request exceeds
+///         @c limits
+///
+inline bool receive_request(int fd, const request_limits& limits,
+                            std::vector<std::uint64_t>& module_ids,
+                            alt_cell_collection_types::host& cells) {
+
+    request_header header;
+    if (!read_all(fd, &header, sizeof(header))) {
+        return false;
+    }
+    if (header.magic != message_magic) {
+        throw std::runtime_error("Received a malformed request");
+    }
+    if (header.n_modules > limits.max_modules) {
+        throw request_too_large(
+            "Request with " + std::to_string(header.n_modules) +
+            " modules exceeds the limit of " +
+            std::to_string(limits.max_modules));
+    }
+    if (header.n_cells > limits.max_cells) {
+        throw request_too_large("Request with " +
+                                std::to_string(header.n_cells) +
+                                " cells exceeds the limit of " +
+                                std::to_string(limits.max_cells));
+    }
+    module_ids.resize(header.n_modules);
+    cells.resize(header.n_cells);
+    if (!read_all(fd, module_ids.data(),
+                  module_ids.size() * sizeof(std::uint64_t)) ||
+        !read_all(fd, cells.data(), cells.size() * sizeof(alt_cell))) {
+        throw std::runtime_error("Connection closed in the middle of a "
+                                 "request");
+    }
+    return true;
+}
+
+/// Send the track parameters reconstructed for a request
+inline void send_response(
+    int fd, const bound_track_parameters_collection_types::host& params) {
+
+    std::vector<track_parameters> payload(params.size());
+    for (std::size_t i = 0; i < params.size(); ++i) {
+        for (std::size_t j = 0; j < e_bound_size; ++j) {
+            payload[i].vector[j] = getter::element(params[i].vector(), j, 0);
+            for (std::size_t k = 0; k < e_bound_size; ++k) {
+                payload[i].covariance[j * e_bound_size + k] =
+                    getter::element(params[i].covariance(), j, k);
+            }
+        }
+    }
+
+    response_header header;
+    header.size = payload.size();
+    write_all(fd, &header, sizeof(header));
+    write_all(fd, payload.data(), payload.size() * sizeof(track_parameters));
+}
+
+/// Send an error message in response to a request
+inline void send_error(int fd, const std::string& message) {
+
+    response_header header;
+    header.status = response_status::failure;
+    header.size = message.size();
+    write_all(fd, &header, sizeof(header));
+    write_all(fd, message.data(), message.size());
+}
+
+/// Receive the response to a reconstruction request
+///
+/// @throws std::runtime_error if the server could not process the request
+///
+inline std::vector<track_parameters> receive_response(int fd) {
+
+    response_header header;
+    if (!read_all(fd, &header, sizeof(header))) {
+        throw std::runtime_error("Server closed the connection");
+    }
+    if (header.magic != message_magic) {
+        throw std::runtime_error("Received a malformed response");
+    }
+    if (header.status != response_status::success) {
+        std::string message(header.size, ' ');
+        read_all(fd, message.data(), message.size());
+        throw std::runtime_error("Server error: " + message);
+    }
+    std::vector<track_parameters> result(header.size);
+    read_all(fd, result.data(), result.size() * sizeof(track_parameters));
+    return result;
+}
+
+}  // namespace traccc::server
@@ -16,11 +16,18 @@
 /// TODO: I opted not to include an alternative "read" multiple events at once
 /// to make this already extensive PR shorter, just hardcodding it here.
 #include "traccc/io/demonstrator_alt_edm.hpp"
+#include "traccc/io/output_stream.hpp"
+#include "traccc/io/read.hpp"
 #include "traccc/io/read_cells_alt.hpp"
 #include "traccc/io/read_digitization_config.hpp"
 #include "traccc/io/read_geometry.hpp"
 
 // Performance measurement include(s).
+#include "traccc/performance/energy_info.hpp"
+#include "traccc/performance/energy_meter.hpp"
+#include "traccc/performance/instrumented_memory_resource.hpp"
+#include "traccc/performance/memory_profile.hpp"
+#include "traccc/performance/sizing_profile.hpp"
 #include "traccc/performance/throughput.hpp"
 #include "traccc/performance/timer.hpp"
 #include "traccc/performance/timing_info.hpp"
@@ -30,10 +37,13 @@
 
 // TBB include(s).
 #include <tbb/global_control.h>
-#include <tbb/task_arena.h>
-#include <tbb/task_group.h>
+
+// Local include(s).
+#include "autotuning.hpp"
+#include "numa_arenas.hpp"
 
 // System include(s).
+#include <algorithm>
 #include <atomic>
 #include <cstdlib>
 #include <ctime>
@@ -74,26 +84,47 @@ int throughput_mt_alt(std::string_view description, int argc, char* argv[],
     // Set up the timing info holder.
     performance::timing_info times;
 
-    // Set up the TBB arena and thread group.
+    // Set up the energy measurement, if requested.
+    performance::energy_info energies;
+    std::unique_ptr<performance::energy_meter> energy_meter;
+    if (throughput_cfg.energy_profile) {
+        energy_meter = std::make_unique<performance::energy_meter>();
+        if (!energy_meter->available()) {
+            std::cout << "WARNING: No readable RAPL energy counters found, "
+                         "not measuring the energy use\n"
+                      << std::endl;
+            energy_meter.reset();
+        }
+    }
+
+    // Limit the number of TBB threads. (The calibration sweeps only try
+    // thread counts up to the requested one.)
     tbb::global_control global_thread_limit(
         tbb::global_control::max_allowed_parallelism, mt_cfg.threads + 1);
-    tbb::task_arena arena{static_cast<int>(mt_cfg.threads), 0};
-    tbb::task_group group;
 
     // Memory resource to use in the test.
     HOST_MR uncached_host_mr;
 
-    // Read the surface transforms
-    auto surface_transforms =
-        traccc::io::read_geometry(throughput_cfg.detector_file);
-
-    // Read the digitization configuration file
-    auto digi_cfg = traccc::io::read_digitization_config(
-        throughput_cfg.digitization_config_file);
+    // Pre-sizing the host memory only has an effect with a caching resource.
+    const bool cache_host_memory =
+        use_host_caching || (!throughput_cfg.sizing_profile_input.empty());
 
     // Read in all input events into memory.
     alt_demonstrator_input input;
-    {
+    if (!throughput_cfg.input_archive.empty()) {
+        performance::timer t{"File reading", times};
+        const io::event_archive archive{throughput_cfg.input_archive};
+        input = io::read_alt(throughput_cfg.loaded_events, archive,
+                             &uncached_host_mr);
+    } else {
+        // Read the surface transforms
+        auto surface_transforms =
+            traccc::io::read_geometry(throughput_cfg.detector_file);
+
+        // Read the digitization configuration file
+        auto digi_cfg = traccc::io::read_digitization_config(
+            throughput_cfg.digitization_config_file);
+
         performance::timer t{"File reading", times};
         for (unsigned int event = 0; event < throughput_cfg.loaded_events;
              ++event) {
@@ -104,32 +135,165 @@ int throughput_mt_alt(std::string_view description, int argc, char* argv[],
         }
     }
 
+    // Seed the random number generator.
+    std::srand(std::time(0));
+
+    // Measure the throughput of the job with a given configuration, for the
+    // calibration sweeps.
+    auto measure = [&](const performance::tuning_values& values) {
+        numa_arenas tuning_arenas{values.at("threads"), mt_cfg.numa};
+        std::vector<std::unique_ptr<vecmem::binary_page_memory_resource> >
+            tuning_mrs;
+        std::vector<FULL_CHAIN_ALG> tuning_algs;
+        tuning_algs.reserve(tuning_arenas.slots());
+        for (std::size_t node = 0; node < tuning_arenas.size(); ++node) {
+            tuning_arenas.execute(node, [&, node]() {
+                for (std::size_t i = 0; i < tuning_arenas.slots(node); ++i) {
+                    tuning_mrs.push_back(
+                        std::make_unique<vecmem::binary_page_memory_resource>(
+                            uncached_host_mr));
+                    tuning_algs.push_back(
+                        {cache_host_memory
+                             ? static_cast<vecmem::memory_resource&>(
+                                   *(tuning_mrs.back()))
+                             : static_cast<vecmem::memory_resource&>(
+                                   uncached_host_mr),
+                         static_cast<unsigned short>(
+                             values.at("target_cells_per_partition")),
+                         seeding_launch(values)});
+                }
+            });
+        }
+        std::atomic_size_t n_params = 0;
+        auto run = [&](std::size_t n_events) {
+            for (std::size_t i = 0; i < n_events; ++i) {
+                const std::size_t event =
+                    std::rand() % throughput_cfg.loaded_events;
+                tuning_arenas.run(
+                    i % tuning_arenas.size(), [&, event](std::size_t slot) {
+                        n_params.fetch_add(
+                            tuning_algs.at(slot)(input[event].cells,
+                                                 input[event].modules)
+                                .size());
+                    });
+            }
+            tuning_arenas.wait();
+        };
+        performance::timing_info tuning_times;
+        run(std::min(throughput_cfg.cold_run_events,
+                     throughput_cfg.tuning_events));
+        {
+            performance::timer t{"Calibration", tuning_times};
+            run(throughput_cfg.tuning_events);
+        }
+        tuning_algs.clear();
+        return performance::throughput{throughput_cfg.tuning_events,
+                                       tuning_times, "Calibration"}
+            .m_perSecond;
+    };
+
+    // Decide the number of threads, the partitioning and the kernel launch
+    // sizes to use. At most as many threads as requested on the command line.
+    performance::tuning_values defaults =
+        device_parameters(throughput_cfg.target_cells_per_partition);
+    defaults["threads"] = mt_cfg.threads;
+    performance::tuning_space space = device_tuning_space();
+    {
+        std::vector<std::size_t> thread_counts;
+        for (std::size_t threads = 1; threads < mt_cfg.threads; threads *= 2) {
+            thread_counts.push_back(threads);
+        }
+        thread_counts.push_back(mt_cfg.threads);
+        space.insert(space.begin(),
+                     performance::tuning_space::value_type{"threads",
+                                                           thread_counts});
+    }
+    const performance::tuning_values tuned = tune_parameters(
+        throughput_cfg, description, defaults, space, measure);
+    mt_cfg.threads = std::min(
+        std::max(tuned.at("threads"), std::size_t{1}), mt_cfg.threads);
+    throughput_cfg.target_cells_per_partition =
+        static_cast<unsigned short>(tuned.at("target_cells_per_partition"));
+    const seeding_launch_config launch = seeding_launch(tuned);
+
+    // Set up the TBB arena(s) and thread group(s).
+    numa_arenas arenas{mt_cfg.threads, mt_cfg.numa};
+    if (arenas.size() > 1) {
+        std::cout << "Using " << arenas.size() << " NUMA nodes\n" << std::endl;
+    }
+
+    // Replicate the input events on every NUMA node in use. The copies are
+    // made by the threads of the nodes, so that the memory would be placed
+    // local to the threads processing the events.
+    std::vector<alt_demonstrator_input> replicated_input;
+    std::vector<const alt_demonstrator_input*> local_input(arenas.size(),
+                                                           &input);
+    if (arenas.size() > 1) {
+        performance::timer t{"Input replication", times};
+        replicated_input.resize(arenas.size());
+        for (std::size_t node = 0; node < arenas.size(); ++node) {
+            arenas.execute(node,
+                           [&, node]() { replicated_input[node] = input; });
+            local_input[node] = &(replicated_input[node]);
+        }
+    }
 
     // Set up cached memory resources on top of the host memory resource
     // separately for each CPU thread.
     std::vector<std::unique_ptr<vecmem::binary_page_memory_resource> >
-        cached_host_mrs{mt_cfg.threads + 1};
+        cached_host_mrs{arenas.slots()};
 
-    // Set up the full-chain algorithm(s). One for each thread.
-    std::vector<FULL_CHAIN_ALG> algs;
-    algs.reserve(mt_cfg.threads + 1);
-    for (std::size_t i = 0; i < mt_cfg.threads + 1; ++i) {
+    // Set up memory resources recording the allocations of each thread's
+    // algorithm, if needed.
+    std::vector<std::unique_ptr<performance::instrumented_memory_resource> >
+        instrumented_host_mrs{arenas.slots()};
 
+    // Set up the full-chain algorithm(s). One for each thread. The objects
+    // of every NUMA node are created by the threads of that node.
+    std::vector<FULL_CHAIN_ALG> algs;
+    algs.reserve(arenas.slots());
+    auto setup_slot = [&](std::size_t i) {
         cached_host_mrs.at(i) =
             std::make_unique<vecmem::binary_page_memory_resource>(
                 uncached_host_mr);
-        vecmem::memory_resource& alg_host_mr =
-            use_host_caching
+        vecmem::memory_resource& base_host_mr =
+            cache_host_memory
                 ? static_cast<vecmem::memory_resource&>(
                       *(cached_host_mrs.at(i)))
                 : static_cast<vecmem::memory_resource&>(uncached_host_mr);
+        instrumented_host_mrs.at(i) =
+            std::make_unique<performance::instrumented_memory_resource>(
+                base_host_mr);
+        vecmem::memory_resource& alg_host_mr =
+            throughput_cfg.memory_profile
+                ? static_cast<vecmem::memory_resource&>(
+                      *(instrumented_host_mrs.at(i)))
+                : base_host_mr;
         algs.push_back(
-            {alg_host_mr, throughput_cfg.target_cells_per_partition});
+            {alg_host_mr, throughput_cfg.target_cells_per_partition, launch});
+    };
+    for (std::size_t node = 0; node < arenas.size(); ++node) {
+        arenas.execute(node, [&, node]() {
+            for (std::size_t i = arenas.slot_offset(node);
+                 i < arenas.slot_offset(node) + arenas.slots(node); ++i) {
+                setup_slot(i);
+            }
+        });
     }
 
 
-    // Seed the random number generator.
-    std::srand(std::time(0));
+    // Pre-size the memory caches of the algorithms, if requested.
+    performance::sizing_profile sizing_profile;
+    if (!throughput_cfg.sizing_profile_input.empty()) {
+        sizing_profile.read(throughput_cfg.sizing_profile_input);
+        std::size_t max_cells = 0;
+        for (const auto& event : input) {
+            max_cells = std::max(max_cells, event.cells.size());
+        }
+        for (FULL_CHAIN_ALG& alg : algs) {
+            alg.presize(sizing_profile, max_cells);
+        }
+    }
 
     // Dummy count uses output of tp algorithm to ensure the compiler
     // optimisations don't skip any step
@@ -139,7 +303,8 @@ int throughput_mt_alt(std::string_view description, int argc, char* argv[],
     // measurements.
     {
         // Measure the time of execution.
-        performance::timer t{"Warm-up processing", times};
+        performance::timer t{"Warm-up processing", times, energies,
+                             energy_meter.get()};
 
         // Process the requested number of events.
         for (std::size_t i = 0; i < throughput_cfg.cold_run_events; ++i) {
@@ -148,27 +313,38 @@ int throughput_mt_alt(std::string_view description, int argc, char* argv[],
             const std::size_t event =
                 std::rand() % throughput_cfg.loaded_events;
 
-            // Launch the processing of the event.
-            arena.execute([&, event]() {
-                group.run([&, event]() {
-                    rec_track_params.fetch_add(
-                        algs.at(tbb::this_task_arena::current_thread_index())(
-                                input[event].cells, input[event].modules)
-                            .size());
-                });
+            // Launch the processing of the event, on the NUMA nodes in turn.
+            const std::size_t node = i % arenas.size();
+            arenas.run(node, [&, event, node](std::size_t slot) {
+                const auto& input_event = (*local_input[node])[event];
+                rec_track_params.fetch_add(
+                    algs.at(slot)(input_event.cells, input_event.modules)
+                        .size());
             });
         }
 
         // Wait for all tasks to finish.
-        group.wait();
+        arenas.wait();
     }
 
-    // Reset the dummy counter.
+    // Reset the dummy counter, and the memory profiles.
     rec_track_params = 0;
+    for (auto& mr : instrumented_host_mrs) {
+        mr->reset();
+    }
+
+    // Set up the output stream, if the reconstruction output is to be
+    // written out as part of the measurement.
+    std::unique_ptr<io::output_stream> output;
+    if (!throughput_cfg.output_file.empty()) {
+        output =
+            std::make_unique<io::output_stream>(throughput_cfg.output_file);
+    }
 
     {
         // Measure the total time of execution.
-        performance::timer t{"Event processing", times};
+        performance::timer t{"Event processing", times, energies,
+                             energy_meter.get()};
 
         // Process the requested number of events.
         for (std::size_t i = 0; i < throughput_cfg.processed_events; ++i) {
@@ -180,29 +356,50 @@ int throughput_mt_alt(std::string_view description, int argc, char* argv[],
             // std::cout << "running event " << i << " : " << event <<
             // std::endl;
 
-            // Launch the processing of the event.
-            arena.execute([&, event]() {
-                group.run([&, event]() {
-                    rec_track_params.fetch_add(
-                        algs.at(tbb::this_task_arena::current_thread_index())(
-                                input[event].cells, input[event].modules)
-                            .size());
-                });
+            // Launch the processing of the event, on the NUMA nodes in turn.
+            const std::size_t node = i % arenas.size();
+            arenas.run(node, [&, i, event, node](std::size_t slot) {
+                const auto& input_event = (*local_input[node])[event];
+                const auto params =
+                    algs.at(slot)(input_event.cells, input_event.modules);
+                rec_track_params.fetch_add(params.size());
+                if (output) {
+                    output->write(i, params);
+                }
             });
         }
 
         // Wait for all tasks to finish.
-        group.wait();
+        arenas.wait();
+
+        // Wait for the output to be written.
+        if (output) {
+            output->flush();
+        }
+    }
+
+    // Collect the buffer sizes seen during the job.
+    for (const FULL_CHAIN_ALG& alg : algs) {
+        sizing_profile.add(alg.sizing());
     }
 
     // Delete the algorithms and host memory caches explicitly before their
     // parent object would go out of scope.
     algs.clear();
+    performance::memory_profile memory_profile;
+    for (const auto& mr : instrumented_host_mrs) {
+        memory_profile.add(mr->profile());
+    }
+    instrumented_host_mrs.clear();
     cached_host_mrs.clear();
 
     // Print some results.
     std::cout << "Reconstructed track parameters: " << rec_track_params.load()
               << std::endl;
+    if (output) {
+        std::cout << "Written output: " << output->bytes_written()
+                  << " bytes" << std::endl;
+    }
     std::cout << "Time totals:" << std::endl;
     std::cout << times << std::endl;
     std::cout << "Throughput:" << std::endl;
@@ -212,6 +409,28 @@ int throughput_mt_alt(std::string_view description, int argc, char* argv[],
               << performance::throughput{throughput_cfg.processed_events, times,
                                          "Event processing"}
               << std::endl;
+    if (energy_meter) {
+        std::cout << "Energy totals:" << std::endl;
+        std::cout << energies << std::endl;
+        std::cout << "Energy efficiency:" << std::endl;
+        std::cout << performance::energy_efficiency{
+                         throughput_cfg.cold_run_events, energies, times,
+                         "Warm-up processing"}
+                  << "\n"
+                  << performance::energy_efficiency{
+                         throughput_cfg.processed_events, energies, times,
+                         "Event processing"}
+                  << std::endl;
+    }
+    if (throughput_cfg.memory_profile) {
+        std::cout << "Memory profile:" << std::endl;
+        std::cout << memory_profile << std::endl;
+    }
+    if (!throughput_cfg.sizing_profile_output.empty()) {
+        std::cout << "Sizing profile:" << std::endl;
+        std::cout << sizing_profile << std::endl;
+        sizing_profile.write(throughput_cfg.sizing_profile_output);
+    }
 
     // Print results to log file
     if (throughput_cfg.log_file != "\0") {
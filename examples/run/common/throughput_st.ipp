@@ -12,9 +12,14 @@
 #include "traccc/options/throughput_options.hpp"
 
 // I/O include(s).
+#include "traccc/io/output_stream.hpp"
 #include "traccc/io/read.hpp"
 
 // Performance measurement include(s).
+#include "traccc/performance/energy_info.hpp"
+#include "traccc/performance/energy_meter.hpp"
+#include "traccc/performance/instrumented_memory_resource.hpp"
+#include "traccc/performance/sizing_profile.hpp"
 #include "traccc/performance/throughput.hpp"
 #include "traccc/performance/timer.hpp"
 #include "traccc/performance/timing_info.hpp"
@@ -23,6 +28,7 @@
 #include <vecmem/memory/binary_page_memory_resource.hpp>
 
 // System include(s).
+#include <algorithm>
 #include <cstdlib>
 #include <ctime>
 #include <iostream>
@@ -57,30 +63,80 @@ int throughput_st(std::string_view description, int argc, char* argv[],
     // Set up the timing info holder.
     performance::timing_info times;
 
+    // Set up the energy measurement, if requested.
+    performance::energy_info energies;
+    std::unique_ptr<performance::energy_meter> energy_meter;
+    if (throughput_cfg.energy_profile) {
+        energy_meter = std::make_unique<performance::energy_meter>();
+        if (!energy_meter->available()) {
+            std::cout << "WARNING: No readable RAPL energy counters found, "
+                         "not measuring the energy use\n"
+                      << std::endl;
+            energy_meter.reset();
+        }
+    }
+
     // Memory resource to use in the test.
     HOST_MR uncached_host_mr;
+
+    // Pre-sizing the host memory only has an effect with a caching resource.
+    const bool cache_host_memory =
+        use_host_caching || (!throughput_cfg.sizing_profile_input.empty());
+
     std::unique_ptr<vecmem::binary_page_memory_resource> cached_host_mr =
         std::make_unique<vecmem::binary_page_memory_resource>(uncached_host_mr);
-    vecmem::memory_resource& alg_host_mr =
-        use_host_caching
+    vecmem::memory_resource& base_host_mr =
+        cache_host_memory
             ? static_cast<vecmem::memory_resource&>(*cached_host_mr)
             : static_cast<vecmem::memory_resource&>(uncached_host_mr);
 
+    // Memory resource recording the allocations of the algorithm, if needed.
+    performance::instrumented_memory_resource instrumented_host_mr{
+        base_host_mr};
+    vecmem::memory_resource& alg_host_mr =
+        throughput_cfg.memory_profile
+            ? static_cast<vecmem::memory_resource&>(instrumented_host_mr)
+            : base_host_mr;
+
     // Read in all input events into memory.
     demonstrator_input cells;
     {
         performance::timer t{"File reading", times};
-        cells = io::read(throughput_cfg.loaded_events,
-                         throughput_cfg.input_directory,
-                         throughput_cfg.detector_file,
-                         throughput_cfg.digitization_config_file,
-                         throughput_cfg.input_data_format, &uncached_host_mr);
+        if (!throughput_cfg.input_archive.empty()) {
+            const io::event_archive archive{throughput_cfg.input_archive};
+            cells = io::read(throughput_cfg.loaded_events, archive,
+                             &uncached_host_mr);
+        } else if (throughput_cfg.detector_snapshot_file.empty()) {
+            cells = io::read(throughput_cfg.loaded_events,
+                             throughput_cfg.input_directory,
+                             throughput_cfg.detector_file,
+                             throughput_cfg.digitization_config_file,
+                             throughput_cfg.input_data_format,
+                             &uncached_host_mr);
+        } else {
+            cells = io::read(throughput_cfg.loaded_events,
+                             throughput_cfg.input_directory,
+                             throughput_cfg.detector_snapshot_file,
+                             throughput_cfg.input_data_format,
+                             &uncached_host_mr);
+        }
     }
 
     // Set up the full-chain algorithm.
     std::unique_ptr<FULL_CHAIN_ALG> alg =
         std::make_unique<FULL_CHAIN_ALG>(alg_host_mr);
 
+    // Pre-size the memory caches of the algorithm, if requested.
+    performance::sizing_profile sizing_profile;
+    if (!throughput_cfg.sizing_profile_input.empty()) {
+        sizing_profile.read(throughput_cfg.sizing_profile_input);
+        std::size_t max_cells = 0;
+        for (const cell_container_types::host& event : cells) {
+            max_cells = std::max(max_cells, event.total_size());
+        }
+        alg->presize(sizing_profile, max_cells);
+    }
+
     // Seed the random number generator.
     std::srand(std::time(0));
 
@@ -92,7 +148,8 @@ int throughput_st(std::string_view description, int argc, char* argv[],
     // measurements.
     {
         // Measure the time of execution.
-        performance::timer t{"Warm-up processing", times};
+        performance::timer t{"Warm-up processing", times, energies,
+                             energy_meter.get()};
 
         // Process the requested number of events.
         for (std::size_t i = 0; i < throughput_cfg.cold_run_events; ++i) {
@@ -106,12 +163,22 @@ int throughput_st(std::string_view description, int argc, char* argv[],
         }
     }
 
-    // Reset the dummy counter.
+    // Reset the dummy counter, and the memory profile.
     rec_track_params = 0;
+    instrumented_host_mr.reset();
+
+    // Set up the output stream, if the reconstruction output is to be
+    // written out as part of the measurement.
+    std::unique_ptr<io::output_stream> output;
+    if (!throughput_cfg.output_file.empty()) {
+        output =
+            std::make_unique<io::output_stream>(throughput_cfg.output_file);
+    }
 
     {
         // Measure the total time of execution.
-        performance::timer t{"Event processing", times};
+        performance::timer t{"Event processing", times, energies,
+                             energy_meter.get()};
 
         // Process the requested number of events.
         for (std::size_t i = 0; i < throughput_cfg.processed_events; ++i) {
@@ -121,10 +188,22 @@ int throughput_st(std::string_view description, int argc, char* argv[],
                 std::rand() % throughput_cfg.loaded_events;
 
             // Process one event.
-            rec_track_params += (*alg)(cells[event]).size();
+            const auto params = (*alg)(cells[event]);
+            rec_track_params += params.size();
+            if (output) {
+                output->write(i, params);
+            }
+        }
+
+        // Wait for the output to be written.
+        if (output) {
+            output->flush();
         }
     }
 
+    // Collect the buffer sizes seen during the job.
+    sizing_profile.add(alg->sizing());
+
     // Explicitly delete the objects in the correct order.
     alg.reset();
     cached_host_mr.reset();
@@ -132,6 +211,10 @@ int throughput_st(std::string_view description, int argc, char* argv[],
     // Print some results.
     std::cout << "Reconstructed track parameters: " << rec_track_params
               << std::endl;
+    if (output) {
+        std::cout << "Written output: " << output->bytes_written()
+                  << " bytes" << std::endl;
+    }
     std::cout << "Time totals:" << std::endl;
     std::cout << times << std::endl;
     std::cout << "Throughput:" << std::endl;
@@ -141,6 +224,28 @@ int throughput_st(std::string_view description, int argc, char* argv[],
               << performance::throughput{throughput_cfg.processed_events, times,
                                          "Event processing"}
               << std::endl;
+    if (energy_meter) {
+        std::cout << "Energy totals:" << std::endl;
+        std::cout << energies << std::endl;
+        std::cout << "Energy efficiency:" << std::endl;
+        std::cout << performance::energy_efficiency{
+                         throughput_cfg.cold_run_events, energies, times,
+                         "Warm-up processing"}
+                  << "\n"
+                  << performance::energy_efficiency{
+                         throughput_cfg.processed_events, energies, times,
+                         "Event processing"}
+                  << std::endl;
+    }
+    if (throughput_cfg.memory_profile) {
+        std::cout << "Memory profile:" << std::endl;
+        std::cout << instrumented_host_mr.profile() << std::endl;
+    }
+    if (!throughput_cfg.sizing_profile_output.empty()) {
+        std::cout << "Sizing profile:" << std::endl;
+        std::cout << sizing_profile << std::endl;
+        sizing_profile.write(throughput_cfg.sizing_profile_output);
+    }
 
     // Return gracefully.
     return 0;
@@ -15,11 +15,17 @@
 /// TODO: I opted not to include an alternative "read" multiple events at once
 /// to make this already extensive PR shorter, just hardcodding it here.
 #include "traccc/io/demonstrator_alt_edm.hpp"
+#include "traccc/io/output_stream.hpp"
+#include "traccc/io/read.hpp"
 #include "traccc/io/read_cells_alt.hpp"
 #include "traccc/io/read_digitization_config.hpp"
 #include "traccc/io/read_geometry.hpp"
 
 // Performance measurement include(s).
+#include "traccc/performance/energy_info.hpp"
+#include "traccc/performance/energy_meter.hpp"
+#include "traccc/performance/instrumented_memory_resource.hpp"
+#include "traccc/performance/sizing_profile.hpp"
 #include "traccc/performance/throughput.hpp"
 #include "traccc/performance/timer.hpp"
 #include "traccc/performance/timing_info.hpp"
@@ -27,7 +33,11 @@
 // VecMem include(s).
 #include <vecmem/memory/binary_page_memory_resource.hpp>
 
+// Local include(s).
+#include "autotuning.hpp"
+
 // System include(s).
+#include <algorithm>
 #include <cstdlib>
 #include <ctime>
 #include <iostream>
@@ -62,27 +72,58 @@ int throughput_st_alt(std::string_view description, int argc, char* argv[],
     // Set up the timing info holder.
     performance::timing_info times;
 
+    // Set up the energy measurement, if requested.
+    performance::energy_info energies;
+    std::unique_ptr<performance::energy_meter> energy_meter;
+    if (throughput_cfg.energy_profile) {
+        energy_meter = std::make_unique<performance::energy_meter>();
+        if (!energy_meter->available()) {
+            std::cout << "WARNING: No readable RAPL energy counters found, "
+                         "not measuring the energy use\n"
+                      << std::endl;
+            energy_meter.reset();
+        }
+    }
+
     // Memory resource to use in the test.
     HOST_MR uncached_host_mr;
+
+    // Pre-sizing the host memory only has an effect with a caching resource.
+    const bool cache_host_memory =
+        use_host_caching || (!throughput_cfg.sizing_profile_input.empty());
+
     std::unique_ptr<vecmem::binary_page_memory_resource> cached_host_mr =
         std::make_unique<vecmem::binary_page_memory_resource>(uncached_host_mr);
 
-    vecmem::memory_resource& alg_host_mr =
-        use_host_caching
+    vecmem::memory_resource& base_host_mr =
+        cache_host_memory
             ? static_cast<vecmem::memory_resource&>(*cached_host_mr)
             : static_cast<vecmem::memory_resource&>(uncached_host_mr);
 
-    // Read the surface transforms
-    auto surface_transforms =
-        traccc::io::read_geometry(throughput_cfg.detector_file);
-
-    // Read the digitization configuration file
-    auto digi_cfg = traccc::io::read_digitization_config(
-        throughput_cfg.digitization_config_file);
+    // Memory resource recording the allocations of the algorithm, if needed.
+    performance::instrumented_memory_resource instrumented_host_mr{
+        base_host_mr};
+    vecmem::memory_resource& alg_host_mr =
+        throughput_cfg.memory_profile
+            ? static_cast<vecmem::memory_resource&>(instrumented_host_mr)
+            : base_host_mr;
 
     // Read in all input events into memory.
     alt_demonstrator_input input;
-    {
+    if (!throughput_cfg.input_archive.empty()) {
+        performance::timer t{"File reading", times};
+        const io::event_archive archive{throughput_cfg.input_archive};
+        input = io::read_alt(throughput_cfg.loaded_events, archive,
+                             &uncached_host_mr);
+    } else {
+        // Read the surface transforms
+        auto surface_transforms =
+            traccc::io::read_geometry(throughput_cfg.detector_file);
+
+        // Read the digitization configuration file
+        auto digi_cfg = traccc::io::read_digitization_config(
+            throughput_cfg.digitization_config_file);
+
         performance::timer t{"File reading", times};
         for (unsigned int event = 0; event < throughput_cfg.loaded_events;
              ++event) {
@@ -93,13 +134,63 @@ int throughput_st_alt(std::string_view description, int argc, char* argv[],
         }
     }
 
-    // Set up the full-chain algorithm.
-    std::unique_ptr<FULL_CHAIN_ALG> alg = std::make_unique<FULL_CHAIN_ALG>(
-        alg_host_mr, throughput_cfg.target_cells_per_partition);
-
     // Seed the random number generator.
     std::srand(std::time(0));
 
+    // Measure the throughput of the job with a given configuration, for the
+    // calibration sweeps.
+    auto measure = [&](const performance::tuning_values& values) {
+        FULL_CHAIN_ALG tuning_alg(
+            base_host_mr,
+            static_cast<unsigned short>(
+                values.at("target_cells_per_partition")),
+            seeding_launch(values));
+        std::size_t n_params = 0;
+        auto run = [&](std::size_t n_events) {
+            for (std::size_t i = 0; i < n_events; ++i) {
+                const std::size_t event =
+                    std::rand() % throughput_cfg.loaded_events;
+                n_params +=
+                    tuning_alg(input[event].cells, input[event].modules)
+                        .size();
+            }
+        };
+        performance::timing_info tuning_times;
+        run(std::min(throughput_cfg.cold_run_events,
+                     throughput_cfg.tuning_events));
+        {
+            performance::timer t{"Calibration", tuning_times};
+            run(throughput_cfg.tuning_events);
+        }
+        return performance::throughput{throughput_cfg.tuning_events,
+                                       tuning_times, "Calibration"}
+            .m_perSecond;
+    };
+
+    // Decide the partitioning and the kernel launch sizes to use.
+    const performance::tuning_values tuned = tune_parameters(
+        throughput_cfg, description,
+        device_parameters(throughput_cfg.target_cells_per_partition),
+        device_tuning_space(), measure);
+    throughput_cfg.target_cells_per_partition =
+        static_cast<unsigned short>(tuned.at("target_cells_per_partition"));
+
+    // Set up the full-chain algorithm.
+    std::unique_ptr<FULL_CHAIN_ALG> alg = std::make_unique<FULL_CHAIN_ALG>(
+        alg_host_mr, throughput_cfg.target_cells_per_partition,
+        seeding_launch(tuned));
+
+    // Pre-size the memory caches of the algorithm, if requested.
+    performance::sizing_profile sizing_profile;
+    if (!throughput_cfg.sizing_profile_input.empty()) {
+        sizing_profile.read(throughput_cfg.sizing_profile_input);
+        std::size_t max_cells = 0;
+        for (const auto& event : input) {
+            max_cells = std::max(max_cells, event.cells.size());
+        }
+        alg->presize(sizing_profile, max_cells);
+    }
+
     // Dummy count uses output of tp algorithm to ensure the compiler
     // optimisations don't skip any step
     std::size_t rec_track_params = 0;
@@ -108,7 +199,8 @@ int throughput_st_alt(std::string_view description, int argc, char* argv[],
     // measurements.
     {
         // Measure the time of execution.
-        performance::timer t{"Warm-up processing", times};
+        performance::timer t{"Warm-up processing", times, energies,
+                             energy_meter.get()};
 
         // Process the requested number of events.
         for (std::size_t i = 0; i < throughput_cfg.cold_run_events; ++i) {
@@ -123,12 +215,22 @@ int throughput_st_alt(std::string_view description, int argc, char* argv[],
         }
     }
 
-    // Reset the dummy counter.
+    // Reset the dummy counter, and the memory profile.
     rec_track_params = 0;
+    instrumented_host_mr.reset();
+
+    // Set up the output stream, if the reconstruction output is to be
+    // written out as part of the measurement.
+    std::unique_ptr<io::output_stream> output;
+    if (!throughput_cfg.output_file.empty()) {
+        output =
+            std::make_unique<io::output_stream>(throughput_cfg.output_file);
+    }
 
     {
         // Measure the total time of execution.
-        performance::timer t{"Event processing", times};
+        performance::timer t{"Event processing", times, energies,
+                             energy_meter.get()};
 
         // Process the requested number of events.
         for (std::size_t i = 0; i < throughput_cfg.processed_events; ++i) {
@@ -138,11 +240,23 @@ int throughput_st_alt(std::string_view description, int argc, char* argv[],
                 std::rand() % throughput_cfg.loaded_events;
 
             // Process one event.
-            rec_track_params +=
-                (*alg)(input[event].cells, input[event].modules).size();
+            const auto params =
+                (*alg)(input[event].cells, input[event].modules);
+            rec_track_params += params.size();
+            if (output) {
+                output->write(i, params);
+            }
+        }
+
+        // Wait for the output to be written.
+        if (output) {
+            output->flush();
         }
     }
 
+    // Collect the buffer sizes seen during the job.
+    sizing_profile.add(alg->sizing());
+
     // Explicitly delete the objects in the correct order.
     alg.reset();
     cached_host_mr.reset();
@@ -150,6 +264,10 @@ int throughput_st_alt(std::string_view description, int argc, char* argv[],
     // Print some results.
     std::cout << "Reconstructed track parameters: " << rec_track_params
               << std::endl;
+    if (output) {
+        std::cout << "Written output: " << output->bytes_written()
+                  << " bytes" << std::endl;
+    }
     std::cout << "Time totals:" << std::endl;
     std::cout << times << std::endl;
     std::cout << "Throughput:" << std::endl;
@@ -159,6 +277,28 @@ int throughput_st_alt(std::string_view description, int argc, char* argv[],
               << performance::throughput{throughput_cfg.processed_events, times,
                                          "Event processing"}
               << std::endl;
+    if (energy_meter) {
+        std::cout << "Energy totals:" << std::endl;
+        std::cout << energies << std::endl;
+        std::cout << "Energy efficiency:" << std::endl;
+        std::cout << performance::energy_efficiency{
+                         throughput_cfg.cold_run_events, energies, times,
+                         "Warm-up processing"}
+                  << "\n"
+                  << performance::energy_efficiency{
+                         throughput_cfg.processed_events, energies, times,
+                         "Event processing"}
+                  << std::endl;
+    }
+    if (throughput_cfg.memory_profile) {
+        std::cout << "Memory profile:" << std::endl;
+        std::cout << instrumented_host_mr.profile() << std::endl;
+    }
+    if (!throughput_cfg.sizing_profile_output.empty()) {
+        std::cout << "Sizing profile:" << std::endl;
+        std::cout << sizing_profile << std::endl;
+        sizing_profile.write(throughput_cfg.sizing_profile_output);
+    }
 
     // Return gracefully.
     return 0;
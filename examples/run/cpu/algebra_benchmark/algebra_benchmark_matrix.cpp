@@ -0,0 +1,135 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// System include(s).
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/// Split a comma separated list into its elements
+std::vector<std::string> split(const std::string& list) {
+
+    std::vector<std::string> result;
+    std::istringstream stream(list);
+    std::string element;
+    while (std::getline(stream, element, ',')) {
+        if (!element.empty()) {
+            result.push_back(element);
+        }
+    }
+    return result;
+}
+
+/// Run one of the algebra benchmark executables, and collect its results
+///
+/// @param executable The path to the benchmark executable
+/// @param arguments The arguments to pass to the benchmark
+/// @return The time per item of every stage, in nanoseconds, in the order
+///         in which the stages were run
+///
+std::vector<std::pair<std::string, double>> run_benchmark(
+    const std::string& executable, const std::string& arguments) {
+
+    const std::string command = "\"" + executable + "\"" + arguments;
+    FILE* pipe = popen(command.c_str(), "r");
+    if (pipe == nullptr) {
+        throw std::runtime_error("Could not run " + executable);
+    }
+
+    std::vector<std::pair<std::string, double>> result;
+    char buffer[1024];
+    while (std::fgets(buffer, sizeof(buffer), pipe) != nullptr) {
+        const std::string line(buffer);
+        const std::size_t comma = line.find(',');
+        if (line.empty() || (line[0] == '#') || (comma == std::string::npos)) {
+            continue;
+        }
+        result.emplace_back(line.substr(0, comma),
+                            std::stod(line.substr(comma + 1)));
+    }
+
+    if (pclose(pipe) != 0) {
+        throw std::runtime_error(executable + " failed");
+    }
+    return result;
+}
+
+}  // namespace
+
+/// Run the CPU stage benchmarks of all algebra plugin / scalar type
+/// combinations, and print their results side by side
+///
+/// Any arguments are passed on to every benchmark executable.
+///
+int main(int argc, char* argv[]) {
+
+    // The benchmark executables are installed next to this one.
+    const std::filesystem::path directory =
+        std::filesystem::absolute(argv[0]).parent_path();
+    std::string arguments;
+    for (int i = 1; i < argc; ++i) {
+        arguments += std::string(" ") + argv[i];
+    }
+
+    // Run all of the benchmarks.
+    const std::vector<std::string> benchmarks =
+        split(TRACCC_ALGEBRA_BENCHMARKS);
+    std::map<std::string, std::map<std::string, double>> results;
+    std::vector<std::string> stages;
+    for (const std::string& benchmark : benchmarks) {
+        std::cout << "Running the " << benchmark << " benchmark..."
+                  << std::endl;
+        const std::filesystem::path executable =
+            directory / ("traccc_algebra_benchmark_" + benchmark);
+        for (const auto& [stage, time] :
+             run_benchmark(executable.string(), arguments)) {
+            if (results.find(stage) == results.end()) {
+                stages.push_back(stage);
+            }
+            results[stage][benchmark] = time;
+        }
+    }
+
+    // Print the results.
+    static constexpr int width = 16;
+    std::cout << "\nTime per item [ns]\n" << std::setw(24) << std::left
+              << "Stage";
+    for (const std::string& benchmark : benchmarks) {
+        std::cout << std::setw(width) << std::right << benchmark;
+    }
+    std::cout << std::setw(width) << std::right << "Fastest" << "\n";
+    for (const std::string& stage : stages) {
+        std::cout << std::setw(24) << std::left << stage;
+        std::string fastest;
+        for (const std::string& benchmark : benchmarks) {
+            auto it = results[stage].find(benchmark);
+            if (it == results[stage].end()) {
+                std::cout << std::setw(width) << std::right << "-";
+                continue;
+            }
+            std::cout << std::setw(width) << std::right << std::fixed
+                      << std::setprecision(2) << it->second;
+            if (fastest.empty() || (it->second < results[stage][fastest])) {
+                fastest = benchmark;
+            }
+        }
+        std::cout << std::setw(width) << std::right << fastest << "\n";
+    }
+    std::cout << std::flush;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,277 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/clusterization/spacepoint_formation.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/track_parametrization.hpp"
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/edm/track_state.hpp"
+#include "traccc/fitting/kalman_filter/gain_matrix_smoother.hpp"
+#include "traccc/fitting/kalman_filter/gain_matrix_updater.hpp"
+#include "traccc/seeding/seeding_algorithm.hpp"
+#include "traccc/seeding/track_params_estimation.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s).
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// This file is built once for every algebra plugin / scalar type combination.
+// It is linked against the traccc::core algorithms built for the same
+// combination, selected through the ALGEBRA_PLUGINS_INCLUDE_* and
+// TRACCC_CUSTOM_SCALARTYPE definitions.
+
+#ifndef TRACCC_ALGEBRA_BENCHMARK_NAME
+#define TRACCC_ALGEBRA_BENCHMARK_NAME "unknown"
+#endif
+
+namespace {
+
+/// Matrix operator of the algebra plugin
+using matrix_operator = traccc::transform3::matrix_actor;
+/// Matrix type of the algebra plugin
+template <matrix_operator::size_ty ROWS, matrix_operator::size_ty COLS>
+using matrix_type = matrix_operator::template matrix_type<ROWS, COLS>;
+
+/// Radii of the detector layers crossed by the simulated tracks
+constexpr std::array<traccc::scalar, 5> layer_radii = {40.f, 70.f, 100.f,
+                                                       130.f, 160.f};
+
+/// Sum of the stage results, printed to keep the compiler from optimising
+/// the benchmarked code away
+double checksum = 0.;
+
+/// Stand-in for a detray mask, providing the projection matrix of a 2D
+/// measurement on a planar surface
+struct planar_mask {
+    template <matrix_operator::size_ty SIZE>
+    matrix_type<2, SIZE> projection_matrix() const {
+        matrix_type<2, SIZE> result =
+            matrix_operator().template zero<2, SIZE>();
+        matrix_operator().element(result, 0, 0) = 1.;
+        matrix_operator().element(result, 1, 1) = 1.;
+        return result;
+    }
+};
+
+/// Stand-in for the propagator state used by the Kalman updater
+struct propagation_state {
+    struct {
+        traccc::bound_track_parameters _bound_params;
+    } _stepping;
+};
+
+/// Time the execution of a benchmark stage
+///
+/// @param name The name of the stage
+/// @param n_items The number of items processed by one call to @c stage
+/// @param n_repetitions The number of times to call @c stage
+/// @param stage The callable executing the stage, returning a checksum
+///
+template <typename stage_t>
+void run_stage(const std::string& name, std::size_t n_items,
+               std::size_t n_repetitions, stage_t stage) {
+
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < n_repetitions; ++i) {
+        checksum += stage();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    const double time_per_item =
+        std::chrono::duration<double, std::nano>(end - start).count() /
+        static_cast<double>(n_items * n_repetitions);
+    std::cout << name << "," << time_per_item << std::endl;
+}
+
+}  // namespace
+
+/// Benchmark of the CPU reconstruction stages with one algebra plugin
+///
+/// Prints the time spent per processed item in every stage, in nanoseconds,
+/// as comma separated values. The output is meant to be collected by
+/// @c traccc_algebra_benchmark_matrix.
+///
+int main(int argc, char* argv[]) {
+
+    // The number of spacepoints and repetitions to use.
+    const std::size_t n_spacepoints =
+        (argc > 1) ? std::stoul(argv[1]) : 2000ul;
+    const std::size_t n_repetitions = (argc > 2) ? std::stoul(argv[2]) : 5ul;
+
+    vecmem::host_memory_resource host_mr;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<traccc::scalar> local_dist(-0.05f, 0.05f);
+    std::uniform_real_distribution<traccc::scalar> phi_dist(-M_PI, M_PI);
+    std::uniform_real_distribution<traccc::scalar> cot_theta_dist(-2.f, 2.f);
+    std::uniform_real_distribution<traccc::scalar> z0_dist(-50.f, 50.f);
+
+    std::cout << "# plugin: " << TRACCC_ALGEBRA_BENCHMARK_NAME
+              << ", spacepoints: " << n_spacepoints
+              << ", repetitions: " << n_repetitions << "\n"
+              << "# stage,ns per item" << std::endl;
+
+    /*
+     * Straight tracks from the beam line, with one measurement on a separate
+     * module for every layer that they cross
+     */
+    traccc::measurement_container_types::host measurements(&host_mr);
+    std::vector<traccc::measurement> flat_measurements;
+    flat_measurements.reserve(n_spacepoints);
+    while (flat_measurements.size() < n_spacepoints) {
+        const traccc::scalar phi = phi_dist(gen);
+        const traccc::scalar cot_theta = cot_theta_dist(gen);
+        const traccc::scalar z0 = z0_dist(gen);
+        for (std::size_t l = 0; (l < layer_radii.size()) &&
+                                (flat_measurements.size() < n_spacepoints);
+             ++l) {
+            const traccc::scalar r = layer_radii[l];
+            traccc::cell_module module;
+            module.module = flat_measurements.size();
+            module.placement = traccc::transform3{
+                traccc::vector3{r * std::cos(phi), r * std::sin(phi),
+                                z0 + r * cot_theta},
+                traccc::vector3{std::cos(phi), std::sin(phi), 0.f},
+                traccc::vector3{-std::sin(phi), std::cos(phi), 0.f}};
+            traccc::measurement meas;
+            meas.local = traccc::point2{local_dist(gen), local_dist(gen)};
+            meas.variance = traccc::variance2{0.01f, 0.01f};
+            flat_measurements.push_back(meas);
+            measurements.push_back(
+                std::move(module),
+                traccc::measurement_collection_types::host{meas});
+        }
+    }
+
+    /*
+     * Spacepoint formation
+     */
+    traccc::spacepoint_formation sf(host_mr);
+    traccc::spacepoint_container_types::host spacepoints(&host_mr);
+    run_stage("spacepoint_formation", n_spacepoints, n_repetitions, [&]() {
+        spacepoints = sf(measurements);
+        double sum = 0.;
+        for (std::size_t i = 0; i < spacepoints.size(); ++i) {
+            for (const traccc::spacepoint& sp : spacepoints.get_items()[i]) {
+                sum += sp.global[2];
+            }
+        }
+        return sum;
+    });
+
+    /*
+     * Seeding
+     */
+    traccc::seeding_algorithm sa(host_mr);
+    traccc::seed_collection_types::host seeds(&host_mr);
+    run_stage("seeding", n_spacepoints, n_repetitions, [&]() {
+        seeds = sa(spacepoints);
+        return static_cast<double>(seeds.size());
+    });
+
+    /*
+     * Track parameter estimation
+     */
+    const std::size_t n_seeds = seeds.size() > 0 ? seeds.size() : 1;
+    traccc::track_params_estimation tp(host_mr);
+    run_stage("parameter_estimation", n_seeds, n_repetitions, [&]() {
+        const traccc::bound_track_parameters_collection_types::host params =
+            tp(spacepoints, seeds);
+        double sum = 0.;
+        for (const traccc::bound_track_parameters& param : params) {
+            sum += matrix_operator().element(param.vector(),
+                                             traccc::e_bound_phi, 0);
+        }
+        return sum;
+    });
+
+    /*
+     * Kalman filter update
+     */
+    const std::array<planar_mask, 1> masks{};
+    std::vector<traccc::track_state<traccc::transform3>> states;
+    states.reserve(n_spacepoints);
+    for (std::size_t i = 0; i < n_spacepoints; ++i) {
+        states.emplace_back(traccc::track_candidate{
+            static_cast<traccc::geometry_id>(i), flat_measurements[i]});
+    }
+    traccc::bound_track_parameters predicted;
+    predicted.set_covariance(
+        matrix_operator()
+            .template identity<traccc::e_bound_size, traccc::e_bound_size>());
+    run_stage("kalman_update", n_spacepoints, n_repetitions, [&]() {
+        double sum = 0.;
+        propagation_state propagation;
+        for (std::size_t i = 0; i < n_spacepoints; ++i) {
+            propagation._stepping._bound_params = predicted;
+            traccc::gain_matrix_updater<traccc::transform3>{}(
+                masks, 0u, states[i], propagation);
+            sum += states[i].filtered_chi2();
+        }
+        return sum;
+    });
+    run_stage("kalman_update_single", n_spacepoints, n_repetitions, [&]() {
+        double sum = 0.;
+        propagation_state propagation;
+        for (std::size_t i = 0; i < n_spacepoints; ++i) {
+            propagation._stepping._bound_params = predicted;
+            traccc::gain_matrix_updater<traccc::transform3,
+                                        traccc::transform3>{}(
+                masks, 0u, states[i], propagation);
+            sum += states[i].filtered_chi2();
+        }
+        return sum;
+    });
+
+    /*
+     * Kalman smoother
+     */
+    for (std::size_t i = 0; i < n_spacepoints; ++i) {
+        states[i].smoothed() = states[i].filtered();
+        states[i].jacobian() =
+            matrix_operator()
+                .template identity<traccc::e_bound_size,
+                                   traccc::e_bound_size>();
+    }
+    run_stage("kalman_smoother", n_spacepoints, n_repetitions, [&]() {
+        double sum = 0.;
+        for (std::size_t i = n_spacepoints - 1; i > 0; --i) {
+            traccc::gain_matrix_smoother<traccc::transform3>{}(
+                masks, 0u, states[i - 1], states[i]);
+            sum += states[i - 1].smoothed_chi2();
+        }
+        return sum;
+    });
+    run_stage("kalman_smoother_single", n_spacepoints, n_repetitions, [&]() {
+        double sum = 0.;
+        for (std::size_t i = n_spacepoints - 1; i > 0; --i) {
+            traccc::gain_matrix_smoother<traccc::transform3,
+                                         traccc::transform3>{}(
+                masks, 0u, states[i - 1], states[i]);
+            sum += states[i - 1].smoothed_chi2();
+        }
+        return sum;
+    });
+
+    std::cout << "# checksum: " << checksum << std::endl;
+    return 0;
+}
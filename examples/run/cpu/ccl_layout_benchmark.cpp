@@ -0,0 +1,221 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/clusterization/device/aggregate_cluster.hpp"
+#include "traccc/clusterization/device/reduce_problem_cell.hpp"
+#include "traccc/edm/alt_cell.hpp"
+#include "traccc/edm/alt_cell_soa.hpp"
+#include "traccc/edm/alt_measurement.hpp"
+#include "traccc/io/read_cells_alt.hpp"
+#include "traccc/options/common_options.hpp"
+#include "traccc/options/handle_argument_errors.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+namespace po = boost::program_options;
+
+namespace {
+
+/// Time spent in the different steps of the clusterization
+struct ccl_times {
+    double adjacency = 0.;
+    double total = 0.;
+};
+
+/// Run the clusterization functions of the device code on the host
+///
+/// The cells are split into partitions in the same way as in the CUDA and
+/// SYCL kernels, and the partitions are processed one after the other.
+///
+/// @tparam cell_types The collection types of the cells
+///
+/// @param cells_view The cells of the event
+/// @param modules_view The modules of the event
+/// @param target_cells_per_partition The average number of cells in each
+///                                   partition
+/// @param measurements The measurements to fill (with enough space)
+/// @param cell_links The links from the cells to their measurements
+/// @param times The timers to increment
+/// @return The number of found measurements
+///
+template <typename cell_types>
+unsigned int run_ccl(
+    const typename cell_types::const_view& cells_view,
+    const traccc::cell_module_collection_types::const_view& modules_view,
+    unsigned short target_cells_per_partition,
+    traccc::alt_measurement_collection_types::host& measurements,
+    vecmem::vector<unsigned int>& cell_links, ccl_times& times) {
+
+    using clock = std::chrono::steady_clock;
+    const auto seconds_since = [](const clock::time_point& start) {
+        return std::chrono::duration<double>(clock::now() - start).count();
+    };
+    const clock::time_point start_total = clock::now();
+
+    const typename cell_types::const_device cells(cells_view);
+    const traccc::cell_module_collection_types::const_device modules(
+        modules_view);
+    const unsigned int num_cells = cells.size();
+
+    // Scratch memory of the partitions.
+    std::vector<unsigned char> adjc;
+    std::vector<std::array<unsigned short, 8>> adjv;
+    vecmem::vector<unsigned short> f;
+
+    unsigned int n_measurements = 0;
+    for (unsigned int start = 0, end = 0; start < num_cells; start = end) {
+
+        // Find the end of the partition, like the device kernels do.
+        end = std::min(num_cells, start + target_cells_per_partition);
+        while (end < num_cells &&
+               traccc::get_module_link(cells, end - 1) ==
+                   traccc::get_module_link(cells, end) &&
+               traccc::get_channel1(cells, end) <=
+                   traccc::get_channel1(cells, end - 1) + 1) {
+            ++end;
+        }
+        const unsigned short size = static_cast<unsigned short>(end - start);
+
+        // Look for the adjacent cells of every cell.
+        const clock::time_point start_adjacency = clock::now();
+        adjc.assign(size, 0);
+        adjv.resize(size);
+        for (unsigned short cid = 0; cid < size; ++cid) {
+            traccc::device::reduce_problem_cell(cells, cid, start, end,
+                                                adjc[cid], adjv[cid].data());
+        }
+        times.adjacency += seconds_since(start_adjacency);
+
+        // Label every cell with the lowest index in its cluster.
+        f.resize(size);
+        for (unsigned short cid = 0; cid < size; ++cid) {
+            f[cid] = cid;
+        }
+        for (bool changed = true; changed;) {
+            changed = false;
+            for (unsigned short cid = 0; cid < size; ++cid) {
+                for (unsigned char k = 0; k < adjc[cid]; ++k) {
+                    const unsigned short q = f[adjv[cid][k]];
+                    if (q < f[cid]) {
+                        f[cid] = q;
+                        changed = true;
+                    }
+                }
+            }
+        }
+
+        // Create the measurements of the clusters.
+        for (unsigned short cid = 0; cid < size; ++cid) {
+            if (f[cid] == cid) {
+                traccc::device::aggregate_cluster(
+                    cells, modules, vecmem::get_data(f), start, end, cid,
+                    measurements.at(n_measurements),
+                    vecmem::get_data(cell_links), n_measurements);
+                ++n_measurements;
+            }
+        }
+    }
+
+    times.total += seconds_since(start_total);
+    return n_measurements;
+}
+
+}  // namespace
+
+/// Compare the clusterization of the device code with cells stored as array
+/// of structures and as structure of arrays, running it on the host
+int main(int argc, char* argv[]) {
+
+    // Set up the program options
+    po::options_description desc("Allowed options");
+    desc.add_options()("help,h", "Give some help with the program's options");
+    desc.add_options()("repetitions",
+                       po::value<unsigned int>()->default_value(10),
+                       "number of times to process every event");
+    traccc::common_options common_opts(desc);
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    traccc::handle_argument_errors(vm, desc);
+
+    common_opts.read(vm);
+    const unsigned int repetitions = vm["repetitions"].as<unsigned int>();
+
+    vecmem::host_memory_resource host_mr;
+
+    std::size_t n_cells = 0, n_measurements = 0;
+    ccl_times aos_times, soa_times;
+    const unsigned int skip = static_cast<unsigned int>(common_opts.skip);
+    for (unsigned int event = skip; event < common_opts.events + skip;
+         ++event) {
+
+        // Read the cells of the event in both layouts.
+        const traccc::alt_cell_reader_output_t aos =
+            traccc::io::read_cells_alt(event, common_opts.input_directory,
+                                       common_opts.input_data_format,
+                                       nullptr, nullptr, &host_mr);
+        const traccc::alt_cell_soa_reader_output_t soa =
+            traccc::io::read_cells_alt_soa(
+                event, common_opts.input_directory,
+                common_opts.input_data_format, nullptr, nullptr, &host_mr);
+        n_cells += aos.cells.size();
+
+        // Clusterize them.
+        traccc::alt_measurement_collection_types::host aos_measurements(
+            aos.cells.size(), &host_mr);
+        traccc::alt_measurement_collection_types::host soa_measurements(
+            soa.cells.size(), &host_mr);
+        vecmem::vector<unsigned int> aos_links(aos.cells.size(), &host_mr);
+        vecmem::vector<unsigned int> soa_links(soa.cells.size(), &host_mr);
+        unsigned int aos_count = 0, soa_count = 0;
+        for (unsigned int i = 0; i < repetitions; ++i) {
+            aos_count = run_ccl<traccc::alt_cell_collection_types>(
+                vecmem::get_data(aos.cells), vecmem::get_data(aos.modules),
+                common_opts.target_cells_per_partition, aos_measurements,
+                aos_links, aos_times);
+            soa_count = run_ccl<traccc::alt_cell_soa_types>(
+                traccc::get_data(soa.cells), vecmem::get_data(soa.modules),
+                common_opts.target_cells_per_partition, soa_measurements,
+                soa_links, soa_times);
+        }
+
+        // The two layouts must give the same result.
+        if ((aos_count != soa_count) || (aos_links != soa_links)) {
+            throw std::runtime_error(
+                "Different clusters found with the two cell layouts in "
+                "event " +
+                std::to_string(event));
+        }
+        n_measurements += aos_count;
+    }
+
+    // Print the results.
+    const double n_runs =
+        static_cast<double>(common_opts.events) * repetitions;
+    std::cout << "==> Statistics ... " << std::endl;
+    std::cout << "- read    " << n_cells << " cells" << std::endl;
+    std::cout << "- created " << n_measurements << " measurements"
+              << std::endl;
+    std::cout << "==> Elapsed times (ms/event) ... " << std::endl;
+    std::cout << "- AoS adjacency: " << aos_times.adjacency / n_runs * 1e3
+              << ", total: " << aos_times.total / n_runs * 1e3 << std::endl;
+    std::cout << "- SoA adjacency: " << soa_times.adjacency / n_runs * 1e3
+              << ", total: " << soa_times.total / n_runs * 1e3 << std::endl;
+
+    return 0;
+}
@@ -8,20 +8,65 @@
 // Local include(s).
 #include "full_chain_algorithm.hpp"
 
+// Project include(s).
+#include "traccc/performance/memory_scope.hpp"
+
 namespace traccc {
 
 full_chain_algorithm::full_chain_algorithm(vecmem::memory_resource& mr)
-    : m_clusterization(mr),
-      m_spacepoint_formation(mr),
-      m_seeding(mr),
-      m_track_parameter_estimation(mr) {}
+    : m_host_mr(mr),
+      m_clusterization(m_host_mr),
+      m_spacepoint_formation(m_host_mr),
+      m_seeding(m_host_mr),
+      m_track_parameter_estimation(m_host_mr) {}
+
+full_chain_algorithm::full_chain_algorithm(const full_chain_algorithm& parent)
+    : full_chain_algorithm(parent.m_host_mr.upstream()) {}
+
+void full_chain_algorithm::presize(const performance::sizing_profile& profile,
+                                   std::size_t n_cells) {
+
+    performance::preallocate(
+        m_host_mr.upstream(),
+        profile.estimate_allocations(
+            performance::sizing_profile::host_memory_name, n_cells));
+}
+
+const performance::sizing_profile& full_chain_algorithm::sizing() const {
+
+    return m_sizing;
+}
 
 full_chain_algorithm::output_type full_chain_algorithm::operator()(
     const cell_container_types::host& cells) const {
 
-    const spacepoint_formation::output_type spacepoints =
-        m_spacepoint_formation(m_clusterization(cells));
-    return m_track_parameter_estimation(spacepoints, m_seeding(spacepoints));
+    // Start the memory book-keeping of the event.
+    m_host_mr.reset_peak();
+
+    // Run the clusterization.
+    const spacepoint_formation::output_type spacepoints = [&]() {
+        performance::memory_scope scope{"Clusterization"};
+        return m_spacepoint_formation(m_clusterization(cells));
+    }();
+
+    // Run the seeding.
+    const seeding_algorithm::output_type seeds = [&]() {
+        performance::memory_scope scope{"Seeding"};
+        return m_seeding(spacepoints);
+    }();
+
+    // Run the track parameter estimation.
+    output_type result = [&]() {
+        performance::memory_scope scope{"Estimation"};
+        return m_track_parameter_estimation(spacepoints, seeds);
+    }();
+
+    // Record the memory needed by the event.
+    m_sizing.record(performance::sizing_profile::host_memory_name,
+                    cells.total_size(), m_host_mr.peak());
+    m_sizing.record_allocations(performance::sizing_profile::host_memory_name,
+                                cells.total_size(), m_host_mr.largest());
+    return result;
 }
 
 }  // namespace traccc
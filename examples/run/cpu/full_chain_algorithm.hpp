@@ -10,6 +10,8 @@
 // Project include(s).
 #include "traccc/clusterization/clusterization_algorithm.hpp"
 #include "traccc/clusterization/spacepoint_formation.hpp"
+#include "traccc/performance/high_water_memory_resource.hpp"
+#include "traccc/performance/sizing_profile.hpp"
 #include "traccc/seeding/seeding_algorithm.hpp"
 #include "traccc/seeding/track_params_estimation.hpp"
 #include "traccc/utils/algorithm.hpp"
@@ -17,6 +19,9 @@
 // VecMem include(s).
 #include <vecmem/memory/memory_resource.hpp>
 
+// System include(s).
+#include <cstddef>
+
 namespace traccc {
 
 /// Algorithm performing the full chain of track reconstruction
@@ -35,6 +40,15 @@ class full_chain_algorithm
     ///
     full_chain_algorithm(vecmem::memory_resource& mr);
 
+    /// Copy constructor
+    ///
+    /// The copy uses the same upstream memory resource as its parent, but
+    /// starts recording its own buffer sizes.
+    ///
+    /// @param parent The parent algorithm chain to copy
+    ///
+    full_chain_algorithm(const full_chain_algorithm& parent);
+
     /// Reconstruct track parameters in the entire detector
     ///
     /// @param cells The cells for every detector module in the event
@@ -43,7 +57,23 @@ class full_chain_algorithm
     output_type operator()(
         const cell_container_types::host& cells) const override;
 
+    /// Pre-size the memory caches of the algorithm
+    ///
+    /// @param profile The buffer sizes recorded in earlier jobs
+    /// @param n_cells The number of cells in the largest expected event
+    ///
+    void presize(const performance::sizing_profile& profile,
+                 std::size_t n_cells);
+
+    /// Get the buffer sizes recorded while processing events
+    const performance::sizing_profile& sizing() const;
+
     private:
+    /// Host memory resource, keeping track of the memory used per event
+    mutable performance::high_water_memory_resource m_host_mr;
+    /// Buffer sizes recorded while processing events
+    mutable performance::sizing_profile m_sizing;
+
     /// @name Sub-algorithms used by this full-chain algorithm
     /// @{
 
@@ -0,0 +1,212 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/edm/internal_spacepoint.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/seeding/detail/static_seeding_config.hpp"
+#include "traccc/seeding/doublet_finding_helper.hpp"
+#include "traccc/seeding/seed_finding.hpp"
+#include "traccc/seeding/spacepoint_binning.hpp"
+#include "traccc/seeding/static_seed_finding.hpp"
+#include "traccc/seeding/triplet_finding_helper.hpp"
+
+// Performance measurement include(s).
+#include "traccc/performance/timer.hpp"
+#include "traccc/performance/timing_info.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s).
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+/// Type of the spacepoints used in the benchmark
+using internal_sp = traccc::internal_spacepoint<traccc::spacepoint>;
+
+/// Generate random spacepoints in the barrel of the default configuration
+std::vector<internal_sp> generate_spacepoints(std::size_t n_spacepoints) {
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<traccc::scalar> r_dist(33., 200.);
+    std::uniform_real_distribution<traccc::scalar> phi_dist(-0.1, 0.1);
+    std::uniform_real_distribution<traccc::scalar> z_dist(-300., 300.);
+
+    std::vector<internal_sp> result;
+    result.reserve(n_spacepoints);
+    for (std::size_t i = 0; i < n_spacepoints; ++i) {
+        const traccc::scalar r = r_dist(gen);
+        const traccc::scalar phi = phi_dist(gen);
+        traccc::spacepoint sp;
+        sp.global =
+            traccc::point3{r * std::cos(phi), r * std::sin(phi), z_dist(gen)};
+        result.emplace_back(sp, static_cast<unsigned int>(i),
+                            traccc::vector2{0., 0.});
+    }
+    return result;
+}
+
+/// Run the doublet and triplet compatibility checks on all spacepoints
+///
+/// @return The number of compatible triplets found
+///
+template <typename config_t>
+std::size_t count_triplets(const std::vector<internal_sp>& spacepoints,
+                           const config_t& config) {
+
+    std::size_t n_triplets = 0;
+    std::vector<traccc::lin_circle> bottoms, tops;
+    for (const internal_sp& spM : spacepoints) {
+
+        // Find the doublets of the middle spacepoint.
+        bottoms.clear();
+        tops.clear();
+        for (const internal_sp& sp : spacepoints) {
+            if (traccc::doublet_finding_helper::isCompatible<
+                    traccc::details::spacepoint_type::bottom>(spM, sp,
+                                                              config)) {
+                bottoms.push_back(
+                    traccc::doublet_finding_helper::transform_coordinates<
+                        traccc::details::spacepoint_type::bottom>(spM, sp));
+            }
+            if (traccc::doublet_finding_helper::isCompatible<
+                    traccc::details::spacepoint_type::top>(spM, sp, config)) {
+                tops.push_back(
+                    traccc::doublet_finding_helper::transform_coordinates<
+                        traccc::details::spacepoint_type::top>(spM, sp));
+            }
+        }
+
+        // Combine them into triplets.
+        for (const traccc::lin_circle& lb : bottoms) {
+            const traccc::scalar iSinTheta2 = 1 + lb.cotTheta() * lb.cotTheta();
+            const traccc::scalar scatteringInRegion2 =
+                config.maxScatteringAngle2 * iSinTheta2 *
+                config.sigmaScattering * config.sigmaScattering;
+            for (const traccc::lin_circle& lt : tops) {
+                traccc::scalar curvature = 0., impact_parameter = 0.;
+                if (traccc::triplet_finding_helper::isCompatible(
+                        spM, lb, lt, config, iSinTheta2, scatteringInRegion2,
+                        curvature, impact_parameter)) {
+                    ++n_triplets;
+                }
+            }
+        }
+    }
+    return n_triplets;
+}
+
+}  // namespace
+
+/// Benchmark comparing the seeding compatibility checks, and the full seed
+/// finding, with a runtime and a compile time seed finder configuration
+int main(int argc, char* argv[]) {
+
+    // The number of spacepoints and repetitions to use.
+    const std::size_t n_spacepoints =
+        (argc > 1) ? std::stoul(argv[1]) : 5000ul;
+    const std::size_t n_repetitions = (argc > 2) ? std::stoul(argv[2]) : 5ul;
+
+    const std::vector<internal_sp> spacepoints =
+        generate_spacepoints(n_spacepoints);
+
+    // The two configurations, describing the same setup.
+    using static_config_type = traccc::static_seedfinder_config<>;
+    const traccc::seedfinder_config runtime_config =
+        static_config_type::runtime_config().toInternalUnits();
+    const static_config_type static_config{};
+
+    // Run the benchmarks of the compatibility checks.
+    traccc::performance::timing_info times;
+    std::size_t n_runtime = 0, n_static = 0;
+    {
+        traccc::performance::timer t{"Runtime configuration", times};
+        for (std::size_t i = 0; i < n_repetitions; ++i) {
+            n_runtime += count_triplets(spacepoints, runtime_config);
+        }
+    }
+    {
+        traccc::performance::timer t{"Compile time configuration", times};
+        for (std::size_t i = 0; i < n_repetitions; ++i) {
+            n_static += count_triplets(spacepoints, static_config);
+        }
+    }
+
+    // Put the same spacepoints into a grid, for the full seed finding.
+    vecmem::host_memory_resource host_mr;
+    traccc::spacepoint_container_types::host sp_container(&host_mr);
+    traccc::spacepoint_collection_types::host sp_items(&host_mr);
+    for (const internal_sp& sp : spacepoints) {
+        traccc::spacepoint item;
+        item.global = traccc::point3{sp.x(), sp.y(), sp.z()};
+        sp_items.push_back(item);
+    }
+    sp_container.push_back(0u, std::move(sp_items));
+
+    const traccc::seedfinder_config user_config =
+        static_config_type::runtime_config();
+    traccc::spacepoint_grid_config grid_config;
+    grid_config.bFieldInZ = user_config.bFieldInZ;
+    grid_config.minPt = user_config.minPt;
+    grid_config.rMax = user_config.rMax;
+    grid_config.zMax = user_config.zMax;
+    grid_config.zMin = user_config.zMin;
+    grid_config.deltaRMax = user_config.deltaRMax;
+    grid_config.cotThetaMax = user_config.cotThetaMax;
+    grid_config.impactMax = user_config.impactMax;
+    grid_config.phiMax = user_config.phiMax;
+    grid_config.phiMin = user_config.phiMin;
+    grid_config.phiBinDeflectionCoverage =
+        user_config.phiBinDeflectionCoverage;
+    traccc::spacepoint_binning sb(user_config, grid_config, host_mr);
+    const traccc::sp_grid grid = sb(sp_container);
+
+    // Run the benchmarks of the full seed finding.
+    const traccc::seedfilter_config filter_config;
+    traccc::seed_finding sf_runtime(user_config, filter_config);
+    traccc::static_seed_finding<static_config_type> sf_static(filter_config);
+    std::size_t n_runtime_seeds = 0, n_static_seeds = 0;
+    {
+        traccc::performance::timer t{"Seed finding (runtime)", times};
+        for (std::size_t i = 0; i < n_repetitions; ++i) {
+            n_runtime_seeds += sf_runtime(sp_container, grid).size();
+        }
+    }
+    {
+        traccc::performance::timer t{"Seed finding (compile time)", times};
+        for (std::size_t i = 0; i < n_repetitions; ++i) {
+            n_static_seeds += sf_static(sp_container, grid).size();
+        }
+    }
+
+    // Print the results.
+    std::cout << "Spacepoints: " << n_spacepoints
+              << ", repetitions: " << n_repetitions << "\n"
+              << "Triplets (runtime configuration)     : " << n_runtime << "\n"
+              << "Triplets (compile time configuration): " << n_static << "\n"
+              << "Seeds (runtime configuration)        : " << n_runtime_seeds
+              << "\n"
+              << "Seeds (compile time configuration)   : " << n_static_seeds
+              << "\n"
+              << "Time totals:\n"
+              << times << std::endl;
+
+    // Fail if the two configurations did not find the same triplets and
+    // seeds.
+    return ((n_runtime == n_static) && (n_runtime_seeds == n_static_seeds))
+               ? EXIT_SUCCESS
+               : EXIT_FAILURE;
+}
@@ -0,0 +1,338 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "../common/server_protocol.hpp"
+#include "full_chain_algorithm.hpp"
+
+// Project include(s).
+#include "traccc/edm/alt_cell.hpp"
+#include "traccc/edm/cell.hpp"
+#include "traccc/geometry/digitization_config.hpp"
+#include "traccc/geometry/geometry.hpp"
+
+// I/O include(s).
+#include "traccc/io/read_digitization_config.hpp"
+#include "traccc/io/read_geometry.hpp"
+
+// Command line option include(s).
+#include "traccc/options/full_tracking_input_options.hpp"
+#include "traccc/options/handle_argument_errors.hpp"
+#include "traccc/options/mt_options.hpp"
+#include "traccc/options/server_options.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/binary_page_memory_resource.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// POSIX include(s).
+#include <pthread.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+/// Flag telling the server to stop
+std::atomic_bool stop_requested{false};
+
+/// A reconstruction request waiting to be processed
+struct pending_request {
+    /// The cells of the event to reconstruct
+    traccc::cell_container_types::host cells;
+    /// The result of the reconstruction
+    std::promise<traccc::bound_track_parameters_collection_types::host>
+        result;
+};
+
+/// Queue handing out the reconstruction requests to the workers
+///
+/// The chain reconstructs one event at a time, so every request is handed
+/// to the next free worker as soon as it arrives.
+///
+class request_queue {
+
+    public:
+    /// Add a request to the queue
+    void push(pending_request& request) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_requests.push_back(&request);
+        }
+        m_cv.notify_one();
+    }
+
+    /// Take the next request from the queue, waiting for one if needed
+    ///
+    /// @return The request, @c nullptr if the queue was closed
+    ///
+    pending_request* pop() {
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this]() { return m_closed || !m_requests.empty(); });
+        if (m_requests.empty()) {
+            return nullptr;
+        }
+        pending_request* result = m_requests.front();
+        m_requests.pop_front();
+        return result;
+    }
+
+    /// Close the queue, waking up all waiting workers
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_closed = true;
+        }
+        m_cv.notify_all();
+    }
+
+    private:
+    /// Mutex protecting the queue
+    std::mutex m_mutex;
+    /// Condition variable signalling new requests
+    std::condition_variable m_cv;
+    /// The requests waiting to be processed
+    std::deque<pending_request*> m_requests;
+    /// Whether the queue was closed
+    bool m_closed = false;
+
+};  // class request_queue
+
+/// Convert the cells received from a client into the format of the chain
+///
+/// The placements and the segmentations of the modules are taken from the
+/// geometry and digitization configuration kept by the server.
+///
+traccc::cell_container_types::host make_cells(
+    const std::vector<std::uint64_t>& module_ids,
+    const traccc::alt_cell_collection_types::host& alt_cells,
+    const traccc::geometry& geom, const traccc::digitization_config& dconfig,
+    vecmem::memory_resource& mr) {
+
+    traccc::cell_container_types::host result(module_ids.size(), &mr);
+    for (std::size_t i = 0; i < module_ids.size(); ++i) {
+
+        traccc::cell_module& module = result.get_headers()[i];
+        module.module = module_ids[i];
+        if (!geom.contains(module.module)) {
+            throw std::runtime_error(
+                "Could not find placement for geometry ID " +
+                std::to_string(module.module));
+        }
+        module.placement = geom[module.module];
+        const traccc::digitization_config::Iterator geo_it =
+            dconfig.find(module.module);
+        if (geo_it == dconfig.end()) {
+            throw std::runtime_error(
+                "Could not find digitization config for geometry ID " +
+                std::to_string(module.module));
+        }
+        const auto& binning_data = geo_it->segmentation.binningData();
+        assert(binning_data.size() >= 2);
+        module.pixel = {binning_data[0].min, binning_data[1].min,
+                        binning_data[0].step, binning_data[1].step};
+    }
+    for (const traccc::alt_cell& cell : alt_cells) {
+        if (cell.module_link >= module_ids.size()) {
+            throw std::runtime_error("Cell with an invalid module link");
+        }
+        result.get_items()[cell.module_link].push_back(cell.c);
+    }
+    return result;
+}
+
+}  // namespace
+
+/// Long lived reconstruction server
+///
+/// Keeps the detector description, the full-chain algorithms and their warm
+/// memory caches resident, and reconstructs the events sent to it over a
+/// Unix domain socket. The requests are processed by a pool of worker
+/// threads, each of them taking the next waiting request as soon as it is
+/// free.
+///
+int main(int argc, char* argv[]) {
+
+    // Convenience typedef.
+    namespace po = boost::program_options;
+
+    // Read in the command line options.
+    po::options_description desc{"traccc reconstruction server"};
+    desc.add_options()("help,h", "Give help with the program's options");
+    traccc::full_tracking_input_config input_cfg{desc};
+    traccc::mt_options mt_cfg{desc};
+    traccc::server_options server_cfg{desc};
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    traccc::handle_argument_errors(vm, desc);
+
+    input_cfg.read(vm);
+    mt_cfg.read(vm);
+    server_cfg.read(vm);
+
+    std::cout << "\ntraccc reconstruction server\n\n"
+              << mt_cfg << "\n"
+              << server_cfg << "\n"
+              << std::endl;
+
+    // Read in the detector description, once for the lifetime of the server.
+    const traccc::geometry geom =
+        traccc::io::read_geometry(input_cfg.detector_file);
+    const traccc::digitization_config dconfig =
+        traccc::io::read_digitization_config(
+            input_cfg.digitization_config_file);
+
+    // Memory resource used for the incoming events.
+    vecmem::host_memory_resource host_mr;
+
+    // Block the stop signals in all threads. They are handled synchronously
+    // by a dedicated thread instead, which can wake up the main thread.
+    sigset_t stop_signals;
+    sigemptyset(&stop_signals);
+    sigaddset(&stop_signals, SIGINT);
+    sigaddset(&stop_signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &stop_signals, nullptr);
+
+    // Set up the worker pool, with one algorithm and memory cache for each
+    // worker.
+    request_queue queue;
+    std::atomic_size_t n_requests{0};
+    std::vector<std::thread> workers;
+    for (std::size_t i = 0; i < mt_cfg.threads; ++i) {
+        workers.emplace_back([&]() {
+            vecmem::binary_page_memory_resource cached_mr{host_mr};
+            traccc::full_chain_algorithm alg{cached_mr};
+            for (pending_request* request = queue.pop(); request != nullptr;
+                 request = queue.pop()) {
+                try {
+                    request->result.set_value(alg(request->cells));
+                } catch (...) {
+                    request->result.set_exception(std::current_exception());
+                }
+                ++n_requests;
+            }
+        });
+    }
+
+    // Start listening for connections.
+    const int listen_fd = traccc::server::listen_on(server_cfg.socket);
+    std::cout << "Listening on " << server_cfg.socket << std::endl;
+
+    // Wait for a stop signal, and shut down the listening socket when it
+    // arrives, to interrupt the blocking accept() call.
+    std::thread signal_thread([&]() {
+        int signal = 0;
+        sigwait(&stop_signals, &signal);
+        stop_requested = true;
+        ::shutdown(listen_fd, SHUT_RDWR);
+    });
+
+    // The largest request to accept from the clients.
+    traccc::server::request_limits limits;
+    limits.max_modules = server_cfg.max_request_modules;
+    limits.max_cells = server_cfg.max_request_cells;
+
+    // Serve every connection on its own thread, until asked to stop.
+    std::mutex connections_mutex;
+    std::condition_variable connections_cv;
+    std::vector<int> connections;
+    while (!stop_requested) {
+
+        const int fd = ::accept(listen_fd, nullptr, nullptr);
+        if (fd < 0) {
+            continue;
+        }
+        {
+            std::lock_guard<std::mutex> lock(connections_mutex);
+            connections.push_back(fd);
+        }
+        std::thread([&, fd]() {
+            std::vector<std::uint64_t> module_ids;
+            traccc::alt_cell_collection_types::host alt_cells{&host_mr};
+            try {
+                while (traccc::server::receive_request(
+                    fd, limits, module_ids, alt_cells)) {
+                    pending_request request;
+                    try {
+                        request.cells = make_cells(module_ids, alt_cells,
+                                                   geom, dconfig, host_mr);
+                    } catch (const std::exception& ex) {
+                        traccc::server::send_error(fd, ex.what());
+                        continue;
+                    }
+                    auto result = request.result.get_future();
+                    queue.push(request);
+                    try {
+                        traccc::server::send_response(fd, result.get());
+                    } catch (const std::system_error&) {
+                        throw;
+                    } catch (const std::exception& ex) {
+                        traccc::server::send_error(fd, ex.what());
+                    }
+                }
+            } catch (const traccc::server::request_too_large& ex) {
+                // Tell the client why its connection is closed.
+                try {
+                    traccc::server::send_error(fd, ex.what());
+                } catch (const std::exception&) {
+                    // The client may have gone away already.
+                }
+                std::cerr << "Rejected request: " << ex.what() << std::endl;
+            } catch (const std::exception& ex) {
+                if (!stop_requested) {
+                    std::cerr << "Connection error: " << ex.what()
+                              << std::endl;
+                }
+            }
+            std::unique_lock<std::mutex> lock(connections_mutex);
+            ::close(fd);
+            connections.erase(
+                std::find(connections.begin(), connections.end(), fd));
+            std::notify_all_at_thread_exit(connections_cv, std::move(lock));
+        }).detach();
+    }
+
+    // Shut down the server.
+    std::cout << "Shutting down..." << std::endl;
+    signal_thread.join();
+    ::close(listen_fd);
+    ::unlink(server_cfg.socket.c_str());
+    {
+        std::unique_lock<std::mutex> lock(connections_mutex);
+        for (int fd : connections) {
+            ::shutdown(fd, SHUT_RDWR);
+        }
+        connections_cv.wait(lock, [&]() { return connections.empty(); });
+    }
+    queue.close();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    std::cout << "Processed " << n_requests.load() << " request(s)"
+              << std::endl;
+    return EXIT_SUCCESS;
+}
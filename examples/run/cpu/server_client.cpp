@@ -0,0 +1,156 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "../common/server_protocol.hpp"
+
+// I/O include(s).
+#include "traccc/io/demonstrator_alt_edm.hpp"
+#include "traccc/io/read_cells_alt.hpp"
+
+// Command line option include(s).
+#include "traccc/options/common_options.hpp"
+#include "traccc/options/handle_argument_errors.hpp"
+#include "traccc/options/mt_options.hpp"
+#include "traccc/options/server_options.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+// POSIX include(s).
+#include <unistd.h>
+
+/// Benchmark client of the traccc reconstruction server
+///
+/// Sends the events of a dataset to the server over a configurable number of
+/// concurrent connections, and reports the latency of the requests and the
+/// throughput of the server.
+///
+int main(int argc, char* argv[]) {
+
+    // Convenience typedef.
+    namespace po = boost::program_options;
+    using clock = std::chrono::steady_clock;
+
+    // Read in the command line options.
+    po::options_description desc{"traccc reconstruction server client"};
+    desc.add_options()("help,h", "Give help with the program's options");
+    traccc::common_options common_cfg{desc};
+    traccc::mt_options mt_cfg{desc};
+    traccc::server_options server_cfg{desc};
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    traccc::handle_argument_errors(vm, desc);
+
+    common_cfg.read(vm);
+    mt_cfg.read(vm);
+    server_cfg.read(vm);
+
+    std::cout << "\ntraccc reconstruction server client\n\n"
+              << mt_cfg << "\n"
+              << server_cfg << "\n"
+              << std::endl;
+
+    // Read in the events to send. The server fills in the module placements
+    // and segmentations from its own detector description.
+    vecmem::host_memory_resource host_mr;
+    traccc::alt_demonstrator_input events;
+    for (unsigned int event = common_cfg.skip;
+         event < common_cfg.events + common_cfg.skip; ++event) {
+        events.push_back(traccc::io::read_cells_alt(
+            event, common_cfg.input_directory, common_cfg.input_data_format,
+            nullptr, nullptr, &host_mr));
+    }
+    if (events.empty()) {
+        std::cerr << "No events to send" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Send the requests from one thread per connection.
+    std::vector<std::vector<double> > latencies(mt_cfg.threads);
+    std::atomic_size_t n_track_params{0}, n_failures{0};
+    std::vector<std::thread> clients;
+    const clock::time_point start = clock::now();
+    for (std::size_t i = 0; i < mt_cfg.threads; ++i) {
+        clients.emplace_back([&, i]() {
+            try {
+                const int fd = traccc::server::connect_to(server_cfg.socket);
+                latencies[i].reserve(server_cfg.requests);
+                for (std::size_t r = 0; r < server_cfg.requests; ++r) {
+                    const clock::time_point sent = clock::now();
+                    traccc::server::send_request(
+                        fd, events[(i + r * mt_cfg.threads) % events.size()]);
+                    try {
+                        n_track_params +=
+                            traccc::server::receive_response(fd).size();
+                    } catch (const std::runtime_error& ex) {
+                        std::cerr << ex.what() << std::endl;
+                        ++n_failures;
+                    }
+                    latencies[i].push_back(
+                        std::chrono::duration<double, std::milli>(
+                            clock::now() - sent)
+                            .count());
+                }
+                ::close(fd);
+            } catch (const std::exception& ex) {
+                std::cerr << "Connection " << i << " failed: " << ex.what()
+                          << std::endl;
+                ++n_failures;
+            }
+        });
+    }
+    for (std::thread& client : clients) {
+        client.join();
+    }
+    const double total_time =
+        std::chrono::duration<double>(clock::now() - start).count();
+
+    // Summarise the results.
+    std::vector<double> all_latencies;
+    for (const std::vector<double>& l : latencies) {
+        all_latencies.insert(all_latencies.end(), l.begin(), l.end());
+    }
+    std::sort(all_latencies.begin(), all_latencies.end());
+    const std::size_t n_requests = all_latencies.size();
+    if (n_requests == 0) {
+        std::cerr << "No requests were completed" << std::endl;
+        return EXIT_FAILURE;
+    }
+    const auto percentile = [&](double p) {
+        return all_latencies[std::min(
+            n_requests - 1, static_cast<std::size_t>(p * n_requests))];
+    };
+    std::cout << "Requests       : " << n_requests << " (" << n_failures.load()
+              << " failed)\n"
+              << "Track params   : " << n_track_params.load() << "\n"
+              << "Throughput     : " << n_requests / total_time
+              << " events/s\n"
+              << "Latency mean   : "
+              << std::accumulate(all_latencies.begin(), all_latencies.end(),
+                                 0.) /
+                     n_requests
+              << " ms\n"
+              << "Latency median : " << percentile(0.5) << " ms\n"
+              << "Latency p99    : " << percentile(0.99) << " ms\n"
+              << "Latency max    : " << all_latencies.back() << " ms"
+              << std::endl;
+
+    return (n_failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
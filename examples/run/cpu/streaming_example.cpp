@@ -0,0 +1,165 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/edm/alt_cell.hpp"
+#include "traccc/edm/cell.hpp"
+#include "traccc/io/read_cells.hpp"
+#include "traccc/io/read_digitization_config.hpp"
+#include "traccc/io/read_geometry.hpp"
+#include "traccc/options/common_options.hpp"
+#include "traccc/options/handle_argument_errors.hpp"
+#include "traccc/streaming/time_slice_reconstruction.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace po = boost::program_options;
+
+/// Reconstruct a synthetic continuous cell stream in time slices
+///
+/// The stream is made out of the cells of the input events, which are
+/// repeated as many times as requested. The events are placed at random
+/// times, with exponentially distributed distances between them, and all
+/// cells of an event get the time of the event. The stream is given to the
+/// reconstruction one event at a time.
+///
+int main(int argc, char* argv[]) {
+
+    // Set up the program options
+    po::options_description desc("Allowed options");
+    desc.add_options()("help,h", "Give some help with the program's options");
+    desc.add_options()("detector_file", po::value<std::string>()->required(),
+                       "specify detector file");
+    desc.add_options()("digitization_config_file",
+                       po::value<std::string>()->required(),
+                       "specify digitization configuration file");
+    desc.add_options()("repetitions",
+                       po::value<unsigned int>()->default_value(10),
+                       "number of times to put the input events into the "
+                       "stream");
+    desc.add_options()("event_spacing",
+                       po::value<traccc::scalar>()->default_value(25.f),
+                       "mean time between two events");
+    desc.add_options()("slice_length",
+                       po::value<traccc::scalar>()->default_value(250.f),
+                       "length of the time slices");
+    desc.add_options()("slice_overlap",
+                       po::value<traccc::scalar>()->default_value(10.f),
+                       "overlap between the time slices");
+    traccc::common_options common_opts(desc);
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    traccc::handle_argument_errors(vm, desc);
+    common_opts.read(vm);
+    const unsigned int repetitions = vm["repetitions"].as<unsigned int>();
+    const traccc::scalar event_spacing =
+        vm["event_spacing"].as<traccc::scalar>();
+    traccc::time_slicing_config slicing;
+    slicing.slice_length = vm["slice_length"].as<traccc::scalar>();
+    slicing.overlap = vm["slice_overlap"].as<traccc::scalar>();
+
+    // Read the detector description.
+    const traccc::geometry surface_transforms = traccc::io::read_geometry(
+        vm["detector_file"].as<std::string>());
+    const traccc::digitization_config digi_cfg =
+        traccc::io::read_digitization_config(
+            vm["digitization_config_file"].as<std::string>());
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Read the input events, with the modules of all events collected into
+    // a single collection.
+    traccc::cell_module_collection_types::host modules(&host_mr);
+    std::map<traccc::geometry_id, unsigned int> module_links;
+    std::vector<traccc::alt_cell_collection_types::host> events;
+    for (unsigned int event = common_opts.skip;
+         event < common_opts.events + common_opts.skip; ++event) {
+
+        const traccc::cell_container_types::host cells =
+            traccc::io::read_cells(event, common_opts.input_directory,
+                                   common_opts.input_data_format,
+                                   &surface_transforms, &digi_cfg, &host_mr);
+        traccc::alt_cell_collection_types::host& event_cells =
+            events.emplace_back(&host_mr);
+        for (std::size_t i = 0; i < cells.size(); ++i) {
+            const traccc::cell_module& module = cells.get_headers()[i];
+            auto it = module_links.find(module.module);
+            if (it == module_links.end()) {
+                it = module_links
+                         .insert({module.module,
+                                  static_cast<unsigned int>(modules.size())})
+                         .first;
+                modules.push_back(module);
+            }
+            for (const traccc::cell& c : cells.get_items()[i]) {
+                event_cells.push_back({c, it->second});
+            }
+        }
+    }
+
+    // Stream the events through the reconstruction.
+    traccc::time_slice_reconstruction reco(slicing, modules, host_mr);
+    std::mt19937 engine(42u);
+    std::exponential_distribution<traccc::scalar> spacing(1.f / event_spacing);
+
+    std::size_t n_cells = 0, n_slices = 0, n_measurements = 0, n_seeds = 0;
+    std::size_t max_buffered = 0;
+    using slices_type = traccc::time_slice_reconstruction::output_type;
+    const auto count = [&](const slices_type& slices) {
+        for (const traccc::time_slice& slice : slices) {
+            ++n_slices;
+            n_measurements += slice.measurements.total_size();
+            n_seeds += slice.seeds.size();
+        }
+    };
+
+    using clock = std::chrono::steady_clock;
+    const clock::time_point start = clock::now();
+    traccc::scalar time = 0.f;
+    traccc::alt_cell_collection_types::host chunk(&host_mr);
+    for (unsigned int r = 0; r < repetitions; ++r) {
+        for (const traccc::alt_cell_collection_types::host& event : events) {
+            time += spacing(engine);
+            chunk.assign(event.begin(), event.end());
+            for (traccc::alt_cell& c : chunk) {
+                c.c.time = time;
+            }
+            n_cells += chunk.size();
+            count(reco(chunk));
+            max_buffered = std::max(max_buffered, reco.buffered_cells());
+        }
+    }
+    count(reco.finish());
+    const double seconds =
+        std::chrono::duration<double>(clock::now() - start).count();
+
+    std::cout << "==> Statistics ... " << std::endl;
+    std::cout << "- streamed " << n_cells << " cells in " << time
+              << " time units, reconstructed in " << n_slices << " slices"
+              << std::endl;
+    std::cout << "- created " << n_measurements << " measurements and "
+              << n_seeds << " seeds" << std::endl;
+    std::cout << "- maximum number of buffered cells: " << max_buffered
+              << std::endl;
+    std::cout << "- throughput: " << n_cells / seconds << " cells/s, "
+              << n_slices / seconds << " slices/s" << std::endl;
+
+    return 0;
+}
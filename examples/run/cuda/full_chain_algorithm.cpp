@@ -29,20 +29,26 @@ namespace traccc::cuda {
 
 full_chain_algorithm::full_chain_algorithm(
     vecmem::memory_resource& host_mr,
-    const unsigned short target_cells_per_partition)
+    const unsigned short target_cells_per_partition,
+    const seeding_launch_config& seeding_launch)
     : m_host_mr(host_mr),
       m_stream(),
       m_device_mr(),
       m_cached_device_mr(
           std::make_unique<vecmem::binary_page_memory_resource>(m_device_mr)),
+      m_tracked_host_mr(m_host_mr),
+      m_tracked_device_mr(*m_cached_device_mr),
       m_copy(m_stream.cudaStream()),
       m_target_cells_per_partition(target_cells_per_partition),
-      m_clusterization(memory_resource{*m_cached_device_mr, &m_host_mr}, m_copy,
-                       m_stream, m_target_cells_per_partition),
-      m_seeding(memory_resource{*m_cached_device_mr, &m_host_mr}, m_copy,
-                m_stream),
+      m_seeding_launch(seeding_launch),
+      m_clusterization(
+          memory_resource{m_tracked_device_mr, &m_tracked_host_mr}, m_copy,
+          m_stream, m_target_cells_per_partition),
+      m_seeding(memory_resource{m_tracked_device_mr, &m_tracked_host_mr},
+                m_copy, m_stream, m_seeding_launch),
       m_track_parameter_estimation(
-          memory_resource{*m_cached_device_mr, &m_host_mr}, m_copy, m_stream) {
+          memory_resource{m_tracked_device_mr, &m_tracked_host_mr}, m_copy,
+          m_stream) {
 
     // Tell the user what device is being used.
     int device = 0;
@@ -60,14 +66,19 @@ full_chain_algorithm::full_chain_algorithm(const full_chain_algorithm& parent)
       m_device_mr(),
       m_cached_device_mr(
           std::make_unique<vecmem::binary_page_memory_resource>(m_device_mr)),
+      m_tracked_host_mr(m_host_mr),
+      m_tracked_device_mr(*m_cached_device_mr),
       m_copy(m_stream.cudaStream()),
       m_target_cells_per_partition(parent.m_target_cells_per_partition),
-      m_clusterization(memory_resource{*m_cached_device_mr, &m_host_mr}, m_copy,
-                       m_stream, m_target_cells_per_partition),
-      m_seeding(memory_resource{*m_cached_device_mr, &m_host_mr}, m_copy,
-                m_stream),
+      m_seeding_launch(parent.m_seeding_launch),
+      m_clusterization(
+          memory_resource{m_tracked_device_mr, &m_tracked_host_mr}, m_copy,
+          m_stream, m_target_cells_per_partition),
+      m_seeding(memory_resource{m_tracked_device_mr, &m_tracked_host_mr},
+                m_copy, m_stream, m_seeding_launch),
       m_track_parameter_estimation(
-          memory_resource{*m_cached_device_mr, &m_host_mr}, m_copy, m_stream) {}
+          memory_resource{m_tracked_device_mr, &m_tracked_host_mr}, m_copy,
+          m_stream) {}
 
 full_chain_algorithm::~full_chain_algorithm() {
 
@@ -76,18 +87,39 @@ full_chain_algorithm::~full_chain_algorithm() {
     m_cached_device_mr.reset();
 }
 
+void full_chain_algorithm::presize(const performance::sizing_profile& profile,
+                                   std::size_t n_cells) {
+
+    performance::preallocate(
+        m_host_mr, profile.estimate_allocations(
+                       performance::sizing_profile::host_memory_name, n_cells));
+    performance::preallocate(
+        *m_cached_device_mr,
+        profile.estimate_allocations(
+            performance::sizing_profile::device_memory_name, n_cells));
+}
+
+const performance::sizing_profile& full_chain_algorithm::sizing() const {
+
+    return m_sizing;
+}
+
 full_chain_algorithm::output_type full_chain_algorithm::operator()(
     const alt_cell_collection_types::host& cells,
     const cell_module_collection_types::host& modules) const {
 
+    // Start the memory book-keeping of the event.
+    m_tracked_host_mr.reset_peak();
+    m_tracked_device_mr.reset_peak();
+
     LIKWID_MARKER_START("CopyToDevice");
 
     // Create device copy of input collections
     alt_cell_collection_types::buffer cells_buffer(cells.size(),
-                                                   *m_cached_device_mr);
+                                                   m_tracked_device_mr);
     m_copy(vecmem::get_data(cells), cells_buffer);
     cell_module_collection_types::buffer modules_buffer(modules.size(),
-                                                        *m_cached_device_mr);
+                                                        m_tracked_device_mr);
     m_copy(vecmem::get_data(modules), modules_buffer);
 
     LIKWID_MARKER_STOP("CopyToDevice");
@@ -114,6 +146,18 @@ full_chain_algorithm::output_type full_chain_algorithm::operator()(
     LIKWID_MARKER_STOP("CopyBackToHost");
 
     m_stream.synchronize();
+
+    // Record the memory needed by the event.
+    m_sizing.record(performance::sizing_profile::host_memory_name,
+                    cells.size(), m_tracked_host_mr.peak());
+    m_sizing.record(performance::sizing_profile::device_memory_name,
+                    cells.size(), m_tracked_device_mr.peak());
+    m_sizing.record_allocations(performance::sizing_profile::host_memory_name,
+                                cells.size(), m_tracked_host_mr.largest());
+    m_sizing.record_allocations(
+        performance::sizing_profile::device_memory_name, cells.size(),
+        m_tracked_device_mr.largest());
+
     // Return the host container.
     return result;
 }
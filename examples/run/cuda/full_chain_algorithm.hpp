@@ -14,6 +14,9 @@
 #include "traccc/cuda/utils/stream.hpp"
 #include "traccc/device/container_h2d_copy_alg.hpp"
 #include "traccc/edm/alt_cell.hpp"
+#include "traccc/performance/high_water_memory_resource.hpp"
+#include "traccc/performance/sizing_profile.hpp"
+#include "traccc/seeding/detail/seeding_launch_config.hpp"
 #include "traccc/utils/algorithm.hpp"
 
 // VecMem include(s).
@@ -23,6 +26,7 @@
 #include <vecmem/utils/cuda/async_copy.hpp>
 
 // System include(s).
+#include <cstddef>
 #include <memory>
 
 #ifdef LIKWID_PERFMON
@@ -56,9 +60,11 @@ class full_chain_algorithm
     ///           objects
     /// @param target_cells_per_partition The average number of cells in each
     /// partition.
+    /// @param seeding_launch The kernel launch sizes of the seeding
     ///
     full_chain_algorithm(vecmem::memory_resource& host_mr,
-                         const unsigned short target_cells_per_partiton);
+                         const unsigned short target_cells_per_partiton,
+                         const seeding_launch_config& seeding_launch = {});
 
     /// Copy constructor
     ///
@@ -82,6 +88,17 @@ class full_chain_algorithm
         const alt_cell_collection_types::host& cells,
         const cell_module_collection_types::host& modules) const override;
 
+    /// Pre-size the host and device memory caches of the algorithm
+    ///
+    /// @param profile The buffer sizes recorded in earlier jobs
+    /// @param n_cells The number of cells in the largest expected event
+    ///
+    void presize(const performance::sizing_profile& profile,
+                 std::size_t n_cells);
+
+    /// Get the buffer sizes recorded while processing events
+    const performance::sizing_profile& sizing() const;
+
     private:
     /// Host memory resource
     vecmem::memory_resource& m_host_mr;
@@ -91,6 +108,12 @@ class full_chain_algorithm
     vecmem::cuda::device_memory_resource m_device_mr;
     /// Device caching memory resource
     std::unique_ptr<vecmem::binary_page_memory_resource> m_cached_device_mr;
+    /// Host memory resource, keeping track of the memory used per event
+    mutable performance::high_water_memory_resource m_tracked_host_mr;
+    /// Device memory resource, keeping track of the memory used per event
+    mutable performance::high_water_memory_resource m_tracked_device_mr;
+    /// Buffer sizes recorded while processing events
+    mutable performance::sizing_profile m_sizing;
     /// (Asynchronous) Memory copy object
     mutable vecmem::cuda::async_copy m_copy;
 
@@ -100,6 +123,8 @@ class full_chain_algorithm
     /// The average number of cells in each partition.
     /// Adapt to different GPUs' capabilities.
     unsigned short m_target_cells_per_partition;
+    /// The kernel launch sizes of the seeding
+    seeding_launch_config m_seeding_launch;
     /// Clusterization algorithm
     clusterization_algorithm m_clusterization;
     /// Seeding algorithm
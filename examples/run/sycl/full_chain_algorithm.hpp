@@ -9,6 +9,9 @@
 
 // Project include(s).
 #include "traccc/edm/alt_cell.hpp"
+#include "traccc/performance/high_water_memory_resource.hpp"
+#include "traccc/performance/sizing_profile.hpp"
+#include "traccc/seeding/detail/seeding_launch_config.hpp"
 #include "traccc/sycl/clusterization/clusterization_algorithm.hpp"
 #include "traccc/sycl/seeding/seeding_algorithm.hpp"
 #include "traccc/sycl/seeding/track_params_estimation.hpp"
@@ -21,6 +24,7 @@
 #include <vecmem/utils/sycl/copy.hpp>
 
 // System include(s).
+#include <cstddef>
 #include <memory>
 
 namespace traccc::sycl {
@@ -45,9 +49,11 @@ class full_chain_algorithm
     ///           objects
     /// @param target_cells_per_partition The average number of cells in each
     /// partition.
+    /// @param seeding_launch The kernel launch sizes of the seeding
     ///
     full_chain_algorithm(vecmem::memory_resource& host_mr,
-                         const unsigned short target_cells_per_partition);
+                         const unsigned short target_cells_per_partition,
+                         const seeding_launch_config& seeding_launch = {});
 
     /// Copy constructor
     ///
@@ -71,6 +77,17 @@ class full_chain_algorithm
         const alt_cell_collection_types::host& cells,
         const cell_module_collection_types::host& modules) const override;
 
+    /// Pre-size the host and device memory caches of the algorithm
+    ///
+    /// @param profile The buffer sizes recorded in earlier jobs
+    /// @param n_cells The number of cells in the largest expected event
+    ///
+    void presize(const performance::sizing_profile& profile,
+                 std::size_t n_cells);
+
+    /// Get the buffer sizes recorded while processing events
+    const performance::sizing_profile& sizing() const;
+
     private:
     /// Private data object
     details::full_chain_algorithm_data* m_data;
@@ -80,6 +97,12 @@ class full_chain_algorithm
     std::unique_ptr<vecmem::sycl::device_memory_resource> m_device_mr;
     /// Device caching memory resource
     std::unique_ptr<vecmem::binary_page_memory_resource> m_cached_device_mr;
+    /// Host memory resource, keeping track of the memory used per event
+    mutable performance::high_water_memory_resource m_tracked_host_mr;
+    /// Device memory resource, keeping track of the memory used per event
+    mutable performance::high_water_memory_resource m_tracked_device_mr;
+    /// Buffer sizes recorded while processing events
+    mutable performance::sizing_profile m_sizing;
     /// Memory copy object
     mutable std::unique_ptr<vecmem::sycl::copy> m_copy;
 
@@ -89,6 +112,8 @@ class full_chain_algorithm
     /// The number of cells to put together in each partition.
     /// Adapt to different GPUs' capabilities.
     unsigned short m_target_cells_per_partition;
+    /// The kernel launch sizes of the seeding
+    seeding_launch_config m_seeding_launch;
     /// Clusterization algorithm
     clusterization_algorithm m_clusterization;
     /// Seeding algorithm
@@ -0,0 +1,217 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "track_candidate_simulator.hpp"
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/fitting/fitting_algorithm.hpp"
+#include "traccc/fitting/fitting_output.hpp"
+#include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
+#include "traccc/options/handle_argument_errors.hpp"
+#include "traccc/options/particle_gen_options.hpp"
+#include "traccc/performance/high_water_memory_resource.hpp"
+
+// detray include(s).
+#include "detray/detectors/create_telescope_detector.hpp"
+#include "detray/propagator/navigator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Boost include(s).
+#include <boost/program_options.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace traccc;
+namespace po = boost::program_options;
+
+namespace {
+
+/// Type declarations
+using detector_type =
+    detray::detector<detray::detector_registry::telescope_detector,
+                     covfie::field, detray::host_container_types>;
+using b_field_t = typename detector_type::bfield_type;
+using rk_stepper_type = detray::rk_stepper<b_field_t::view_t, transform3,
+                                           detray::constrained_step<>>;
+using navigator_type = detray::navigator<const detector_type>;
+using simulator_type =
+    track_candidate_simulator<rk_stepper_type, navigator_type>;
+using fitter_type = kalman_fitter<rk_stepper_type, navigator_type>;
+
+/// Memory used by the payload of a fitting output container
+template <typename container_t>
+std::size_t payload_bytes(const container_t& container) {
+
+    std::size_t result =
+        container.size() * sizeof(typename container_t::header_type);
+    for (const auto& items : container.get_items()) {
+        result += items.capacity() * sizeof(typename container_t::item_type);
+    }
+    return result;
+}
+
+/// Fit all events with one fitting output, and print the cost per track
+///
+/// @param name The name of the fitting output
+/// @param algorithm The fitting algorithm to benchmark
+/// @param det The detector to fit the tracks in
+/// @param events The track candidates of all events
+/// @param tracker The memory resource that the fitting allocates from
+///
+template <typename algorithm_t>
+void benchmark(const std::string& name, const algorithm_t& algorithm,
+               const detector_type& det,
+               const std::vector<track_candidate_container_types::host>& events,
+               performance::high_water_memory_resource& tracker) {
+
+    using clock = std::chrono::steady_clock;
+
+    std::size_t n_tracks = 0, output_bytes = 0, working_bytes = 0;
+    double seconds = 0.;
+    for (const track_candidate_container_types::host& candidates : events) {
+
+        // Measure the memory needed while fitting this one event.
+        const std::size_t before = tracker.current();
+        tracker.reset_peak();
+
+        const clock::time_point start = clock::now();
+        const typename algorithm_t::output_type result =
+            algorithm(det, candidates);
+        seconds += std::chrono::duration<double>(clock::now() - start).count();
+
+        n_tracks += result.size();
+        output_bytes += payload_bytes(result);
+        working_bytes += tracker.peak() - before;
+    }
+
+    n_tracks = std::max<std::size_t>(n_tracks, 1u);
+    std::cout << "- " << name << ": " << seconds / n_tracks * 1e6
+              << " us/track, " << static_cast<double>(output_bytes) / n_tracks
+              << " output bytes/track, "
+              << static_cast<double>(working_bytes) / n_tracks
+              << " peak bytes/track" << std::endl;
+}
+
+}  // namespace
+
+/// Benchmark the fitting with the different trimmings of its output
+///
+/// The events are simulated up front in a telescope detector. Then all of
+/// them are fitted with every fitting output, one event at a time. The time
+/// per track, the size of the output per track, and the highest number of
+/// bytes allocated while fitting an event (including its output) per track
+/// are printed for each of them.
+///
+int main(int argc, char* argv[]) {
+
+    // Set up the program options
+    po::options_description desc("Allowed options");
+    desc.add_options()("help,h", "Give some help with the program's options");
+    desc.add_options()("events", po::value<unsigned int>()->required(),
+                       "number of events");
+    desc.add_options()("seed",
+                       po::value<std::uint64_t>()->default_value(42u),
+                       "seed of the random number streams of the events");
+    traccc::particle_gen_options<scalar> pg_opts(desc);
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    traccc::handle_argument_errors(vm, desc);
+
+    const unsigned int n_events = vm["events"].as<unsigned int>();
+    pg_opts.read(vm);
+
+    // Memory resource used by the detector and the simulated events.
+    vecmem::host_memory_resource host_mr;
+
+    /*****************************
+     * Build a telescope geometry
+     *****************************/
+
+    // Plane alignment direction (aligned to x-axis)
+    detray::detail::ray<transform3> traj{{0, 0, 0}, 0, {1, 0, 0}, -1};
+    // Position of planes (in mm unit)
+    std::vector<scalar> plane_positions = {-10., 20., 40., 60.,  80., 100.,
+                                           120., 140, 160, 180., 200.};
+
+    // B field value
+    const vector3 B{2 * detray::unit<scalar>::T, 0, 0};
+
+    // Create the detector
+    const auto mat = detray::silicon_tml<scalar>();
+    const scalar thickness = 0.5 * detray::unit<scalar>::mm;
+
+    const detector_type det = create_telescope_detector(
+        host_mr,
+        b_field_t(b_field_t::backend_t::configuration_t{B[0], B[1], B[2]}),
+        plane_positions, traj, 100000. * detray::unit<scalar>::mm,
+        100000. * detray::unit<scalar>::mm, mat, thickness);
+
+    /***************************
+     * Simulate the events
+     ***************************/
+
+    simulator_type::config sim_cfg;
+    sim_cfg.n_particles = pg_opts.gen_nparticles;
+    for (unsigned int i = 0; i < 3; ++i) {
+        sim_cfg.vertex[i] = pg_opts.vertex[i];
+        sim_cfg.vertex_stddev[i] = pg_opts.vertex_stddev[i];
+    }
+    for (unsigned int i = 0; i < 2; ++i) {
+        sim_cfg.mom_range[i] = pg_opts.mom_range[i];
+        sim_cfg.theta_range[i] = pg_opts.theta_range[i];
+        sim_cfg.phi_range[i] = pg_opts.phi_range[i];
+    }
+    sim_cfg.seed = vm["seed"].as<std::uint64_t>();
+    const simulator_type simulator(det, sim_cfg);
+
+    std::vector<track_candidate_container_types::host> events;
+    std::size_t n_measurements = 0;
+    for (unsigned int event = 0; event < n_events; ++event) {
+        events.push_back(simulator(event, host_mr));
+        n_measurements += events.back().total_size();
+    }
+
+    /***************************
+     * Run the benchmarks
+     ***************************/
+
+    // The fitting algorithm allocates its output, and the track states that
+    // it works with, from the default memory resource. Keep track of that.
+    vecmem::host_memory_resource upstream_mr;
+    performance::high_water_memory_resource tracker(upstream_mr);
+    vecmem::memory_resource* previous_mr = set_default_resource(&tracker);
+
+    std::cout << "==> Fitting " << n_events << " events with "
+              << n_measurements << " measurements" << std::endl;
+    benchmark("full    ",
+              fitting_algorithm<fitter_type, fitting_output::full>{}, det,
+              events, tracker);
+    benchmark("smoothed",
+              fitting_algorithm<fitter_type, fitting_output::smoothed>{}, det,
+              events, tracker);
+    benchmark("summary ",
+              fitting_algorithm<fitter_type, fitting_output::summary>{}, det,
+              events, tracker);
+
+    set_default_resource(previous_mr);
+
+    return 0;
+}
@@ -0,0 +1,335 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "track_candidate_simulator.hpp"
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/fitting/fitting_algorithm.hpp"
+#include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
+#include "traccc/fitting/fitting_output.hpp"
+#include "traccc/io/event_archive.hpp"
+#include "traccc/io/utils.hpp"
+#include "traccc/io/write.hpp"
+#include "traccc/options/handle_argument_errors.hpp"
+#include "traccc/options/mt_options.hpp"
+#include "traccc/options/options.hpp"
+#include "traccc/options/particle_gen_options.hpp"
+
+// detray include(s).
+#include "detray/detectors/create_telescope_detector.hpp"
+#include "detray/propagator/navigator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Boost include(s).
+#include <boost/filesystem.hpp>
+
+// System include(s).
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace traccc;
+namespace po = boost::program_options;
+
+namespace {
+
+/// Type declarations
+using detector_type =
+    detray::detector<detray::detector_registry::telescope_detector,
+                     covfie::field, detray::host_container_types>;
+using b_field_t = typename detector_type::bfield_type;
+using rk_stepper_type = detray::rk_stepper<b_field_t::view_t, transform3,
+                                           detray::constrained_step<>>;
+using navigator_type = detray::navigator<const detector_type>;
+using simulator_type =
+    track_candidate_simulator<rk_stepper_type, navigator_type>;
+using fitter_type = kalman_fitter<rk_stepper_type, navigator_type>;
+
+/// Time spent by one worker thread in the different steps
+struct worker_times {
+    double simulation = 0.;
+    double fitting = 0.;
+    double output = 0.;
+};
+
+/// Memory used by the payload of a fitting output container
+template <typename container_t>
+std::size_t payload_bytes(const container_t& container) {
+
+    std::size_t result =
+        container.size() * sizeof(typename container_t::header_type);
+    for (const auto& items : container.get_items()) {
+        result += items.capacity() * sizeof(typename container_t::item_type);
+    }
+    return result;
+}
+
+}  // namespace
+
+/// Simulate events in a telescope detector in parallel
+///
+/// Every event is simulated with its own random number stream, so the
+/// result does not depend on the number of threads used. The simulated
+/// truth track candidates are written either into one binary file per event,
+/// or into a single event archive, or not written at all. They can
+/// optionally be fitted right away in memory, to benchmark the track fitting
+/// without any file I/O, and to compare the time per track and the output
+/// size with the different trimmings of the fitting output. (See
+/// fitting_output_benchmark for the memory used while fitting.)
+///
+int main(int argc, char* argv[]) {
+
+    // Set up the program options
+    po::options_description desc("Allowed options");
+    desc.add_options()("help,h", "Give some help with the program's options");
+    desc.add_options()("output_directory",
+                       po::value<std::string>()->default_value(""),
+                       "specify the directory of output data");
+    desc.add_options()("output_format",
+                       po::value<std::string>()->default_value("binary"),
+                       "format of the output: binary, archive or none");
+    desc.add_options()("events", po::value<unsigned int>()->required(),
+                       "number of events");
+    desc.add_options()("seed",
+                       po::value<std::uint64_t>()->default_value(42u),
+                       "seed of the random number streams of the events");
+    desc.add_options()("fit", po::bool_switch()->default_value(false),
+                       "fit the simulated events in memory");
+    desc.add_options()("fit_output",
+                       po::value<std::string>()->default_value("full"),
+                       "fitting output to keep: full, smoothed or summary");
+    traccc::particle_gen_options<scalar> pg_opts(desc);
+    traccc::mt_options mt_opts(desc);
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    traccc::handle_argument_errors(vm, desc);
+
+    const std::string output_directory =
+        vm["output_directory"].as<std::string>();
+    const std::string output_format = vm["output_format"].as<std::string>();
+    const unsigned int events = vm["events"].as<unsigned int>();
+    const bool fit = vm["fit"].as<bool>();
+    const std::string fit_output = vm["fit_output"].as<std::string>();
+    pg_opts.read(vm);
+    mt_opts.read(vm);
+    if ((output_format != "binary") && (output_format != "archive") &&
+        (output_format != "none")) {
+        throw std::invalid_argument("Unknown output format: " + output_format);
+    }
+    if ((fit_output != "full") && (fit_output != "smoothed") &&
+        (fit_output != "summary")) {
+        throw std::invalid_argument("Unknown fit output: " + fit_output);
+    }
+
+    // Memory resource used by the EDM. (Thread-safe.)
+    vecmem::host_memory_resource host_mr;
+
+    /*****************************
+     * Build a telescope geometry
+     *****************************/
+
+    // Plane alignment direction (aligned to x-axis)
+    detray::detail::ray<transform3> traj{{0, 0, 0}, 0, {1, 0, 0}, -1};
+    // Position of planes (in mm unit)
+    std::vector<scalar> plane_positions = {-10., 20., 40., 60.,  80., 100.,
+                                           120., 140, 160, 180., 200.};
+
+    // B field value
+    const vector3 B{2 * detray::unit<scalar>::T, 0, 0};
+
+    // Create the detector
+    const auto mat = detray::silicon_tml<scalar>();
+    const scalar thickness = 0.5 * detray::unit<scalar>::mm;
+
+    const detector_type det = create_telescope_detector(
+        host_mr,
+        b_field_t(b_field_t::backend_t::configuration_t{B[0], B[1], B[2]}),
+        plane_positions, traj, 100000. * detray::unit<scalar>::mm,
+        100000. * detray::unit<scalar>::mm, mat, thickness);
+
+    /***************************
+     * Set up the simulation
+     ***************************/
+
+    simulator_type::config sim_cfg;
+    sim_cfg.n_particles = pg_opts.gen_nparticles;
+    for (unsigned int i = 0; i < 3; ++i) {
+        sim_cfg.vertex[i] = pg_opts.vertex[i];
+        sim_cfg.vertex_stddev[i] = pg_opts.vertex_stddev[i];
+    }
+    for (unsigned int i = 0; i < 2; ++i) {
+        sim_cfg.mom_range[i] = pg_opts.mom_range[i];
+        sim_cfg.theta_range[i] = pg_opts.theta_range[i];
+        sim_cfg.phi_range[i] = pg_opts.phi_range[i];
+    }
+    sim_cfg.seed = vm["seed"].as<std::uint64_t>();
+    const simulator_type simulator(det, sim_cfg);
+
+    const fitting_algorithm<fitter_type, fitting_output::full> fitting;
+    const fitting_algorithm<fitter_type, fitting_output::smoothed>
+        smoothed_fitting;
+    const fitting_algorithm<fitter_type, fitting_output::summary>
+        summary_fitting;
+
+    // Set up the output.
+    const std::string full_path = io::data_directory() + output_directory;
+    if (output_format != "none") {
+        boost::filesystem::create_directories(full_path);
+    }
+    std::unique_ptr<io::event_archive_writer> archive;
+    if (output_format == "archive") {
+        archive = std::make_unique<io::event_archive_writer>(
+            output_directory + "telescope.archive");
+    }
+
+    // Events that were simulated, but can not be added to the archive yet,
+    // since an earlier event is still being simulated.
+    std::mutex archive_mutex;
+    std::map<std::size_t, track_candidate_container_types::host> pending;
+    std::size_t next_archived = 0;
+
+    /***************************
+     * Run the simulation
+     ***************************/
+
+    using clock = std::chrono::steady_clock;
+    const auto seconds_since = [](const clock::time_point& start) {
+        return std::chrono::duration<double>(clock::now() - start).count();
+    };
+
+    std::atomic_size_t next_event{0};
+    std::atomic_size_t n_tracks{0}, n_measurements{0}, n_fitted{0};
+    std::atomic_size_t fit_bytes{0};
+    std::vector<worker_times> times(mt_opts.threads);
+    std::mutex error_mutex;
+    std::exception_ptr error;
+
+    const auto worker = [&](worker_times& t) {
+        try {
+            for (std::size_t event = next_event++; event < events;
+                 event = next_event++) {
+
+                clock::time_point start = clock::now();
+                track_candidate_container_types::host track_candidates =
+                    simulator(event, host_mr);
+                t.simulation += seconds_since(start);
+                n_tracks += track_candidates.size();
+                n_measurements += track_candidates.total_size();
+
+                if (fit) {
+                    start = clock::now();
+                    const auto run_fit = [&](const auto& algorithm) {
+                        const auto result = algorithm(det, track_candidates);
+                        n_fitted += result.size();
+                        fit_bytes += payload_bytes(result);
+                    };
+                    if (fit_output == "full") {
+                        run_fit(fitting);
+                    } else if (fit_output == "smoothed") {
+                        run_fit(smoothed_fitting);
+                    } else {
+                        run_fit(summary_fitting);
+                    }
+                    t.fitting += seconds_since(start);
+                }
+
+                start = clock::now();
+                if (output_format == "binary") {
+                    io::write(event, output_directory, data_format::binary,
+                              get_data(track_candidates));
+                } else if (output_format == "archive") {
+                    // Add the events to the archive in order.
+                    std::lock_guard<std::mutex> lock(archive_mutex);
+                    pending.emplace(event, std::move(track_candidates));
+                    for (auto it = pending.find(next_archived);
+                         it != pending.end();
+                         it = pending.find(next_archived)) {
+                        archive->add(next_archived, it->second);
+                        pending.erase(it);
+                        ++next_archived;
+                    }
+                }
+                t.output += seconds_since(start);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+            // Make the other threads stop.
+            next_event = events;
+        }
+    };
+
+    const clock::time_point start = clock::now();
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < mt_opts.threads; ++i) {
+        threads.emplace_back(worker, std::ref(times[i]));
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    if (archive) {
+        archive->close();
+    }
+    const double wall_time = seconds_since(start);
+
+    // Print the results.
+    worker_times total;
+    for (const worker_times& t : times) {
+        total.simulation += t.simulation;
+        total.fitting += t.fitting;
+        total.output += t.output;
+    }
+    std::cout << "==> Statistics ... " << std::endl;
+    std::cout << "- simulated " << events << " events with " << n_tracks
+              << " tracks and " << n_measurements << " measurements"
+              << std::endl;
+    std::cout << "- used " << mt_opts.threads << " thread(s), wall time "
+              << wall_time << " s (" << events / wall_time << " events/s)"
+              << std::endl;
+    std::cout << "- simulation time: " << total.simulation << " s ("
+              << total.simulation / events * 1e3 << " ms/event/thread)"
+              << std::endl;
+    std::cout << "- output time    : " << total.output << " s" << std::endl;
+    if (fit) {
+        std::cout << "- fitted " << n_fitted << " tracks in "
+                  << total.fitting << " s ("
+                  << total.fitting / events * 1e3 << " ms/event/thread)"
+                  << std::endl;
+        if (n_fitted > 0) {
+            std::cout << "- fit output (" << fit_output
+                      << "): " << total.fitting / n_fitted * 1e6
+                      << " us/track/thread, "
+                      << static_cast<double>(fit_bytes) / n_fitted
+                      << " bytes/track" << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,292 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/track_parametrization.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/track_parameters.hpp"
+
+// detray include(s).
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/actors/parameter_resetter.hpp"
+#include "detray/propagator/actors/parameter_transporter.hpp"
+#include "detray/propagator/actors/pointwise_material_interactor.hpp"
+#include "detray/propagator/base_actor.hpp"
+#include "detray/propagator/propagator.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <tuple>
+
+namespace traccc {
+
+/// Simulation of the (truth) track candidates of events
+///
+/// For every generated particle the simulation produces the smeared
+/// measurements on all sensitive surfaces that the particle crosses, and
+/// seed parameters smeared around the true parameters on the first of these
+/// surfaces. The result has the same layout as the truth track candidates
+/// made by @c traccc::event_map2, and can be given directly to
+/// @c traccc::fitting_algorithm.
+///
+/// Every event uses its own random number stream, seeded from the
+/// configured seed and the event number. So events can be simulated in any
+/// order, in parallel, and always give the same result.
+///
+/// Multiple scattering is simulated by Gaussian kicks to the direction of
+/// the particles on every sensitive surface, following the Highland formula.
+///
+template <typename stepper_t, typename navigator_t>
+class track_candidate_simulator {
+
+    public:
+    /// Type declarations
+    using transform3_type = typename stepper_t::transform3_type;
+    using detector_type = typename navigator_t::detector_type;
+
+    /// Configuration of the simulation
+    struct config {
+        /// The number of particles to generate per event
+        unsigned int n_particles = 1;
+        /// Mean and standard deviation of the vertex of the particles
+        std::array<scalar, 3> vertex{0., 0., 0.};
+        std::array<scalar, 3> vertex_stddev{0., 0., 0.};
+        /// Ranges of the momentum, theta and phi of the particles
+        std::array<scalar, 2> mom_range{1. * detray::unit<scalar>::GeV,
+                                        1. * detray::unit<scalar>::GeV};
+        std::array<scalar, 2> theta_range{M_PI_2, M_PI_2};
+        std::array<scalar, 2> phi_range{0., 0.};
+        /// Charge and mass of the particles
+        scalar charge = -1.;
+        scalar mass = PION_MASS_MEV;
+        /// Thickness of the sensitive surfaces, in radiation lengths
+        scalar x_over_x0 = (0.5 * detray::unit<scalar>::mm) /
+                           (93.7 * detray::unit<scalar>::mm);
+        /// Standard deviations of the local measurement positions
+        std::array<scalar, 2> meas_stddev{50 * detray::unit<scalar>::um,
+                                          50 * detray::unit<scalar>::um};
+        /// Standard deviations for the smearing of the seed parameters
+        std::array<scalar, e_bound_size> seed_stddev{
+            0.03 * detray::unit<scalar>::mm,
+            0.03 * detray::unit<scalar>::mm,
+            0.017,
+            0.017,
+            0.001 / detray::unit<scalar>::GeV,
+            1 * detray::unit<scalar>::ns};
+        /// Seed of the random number streams of the events
+        std::uint64_t seed = 42u;
+        /// Step size constraint of the stepper
+        scalar step_constraint = 5. * detray::unit<scalar>::mm;
+    };
+
+    /// Random number engine used for a single event
+    using engine_type = std::mt19937_64;
+
+    /// Actor recording the measurements of a particle
+    struct recorder : detray::actor {
+
+        /// Actor state
+        struct state {
+            /// The configuration of the simulation
+            const config& m_cfg;
+            /// The random number stream of the event
+            engine_type& m_engine;
+            /// The seed parameters of the particle
+            bound_track_parameters m_seed{};
+            /// The measurements of the particle
+            vecmem::vector<track_candidate> m_candidates;
+        };
+
+        /// Actor operation
+        ///
+        /// @param actor_state the actor state
+        /// @param propagation the propagator state
+        template <typename propagator_state_t>
+        void operator()(state& actor_state,
+                        propagator_state_t& propagation) const {
+
+            auto& navigation = propagation._navigation;
+            if (!navigation.is_on_sensitive()) {
+                return;
+            }
+
+            using matrix_operator = typename transform3_type::matrix_actor;
+            const config& cfg = actor_state.m_cfg;
+            engine_type& engine = actor_state.m_engine;
+            auto& params = propagation._stepping._bound_params;
+            auto vec = params.vector();
+            std::normal_distribution<scalar> normal(0., 1.);
+
+            // Smear the true parameters on the first surface into the seed.
+            if (actor_state.m_candidates.empty()) {
+                auto seed_vec =
+                    matrix_operator().template zero<e_bound_size, 1>();
+                auto seed_cov =
+                    matrix_operator()
+                        .template zero<e_bound_size, e_bound_size>();
+                for (unsigned int i = 0; i < e_bound_size; ++i) {
+                    matrix_operator().element(seed_vec, i, 0) =
+                        matrix_operator().element(vec, i, 0) +
+                        cfg.seed_stddev[i] * normal(engine);
+                    matrix_operator().element(seed_cov, i, i) =
+                        cfg.seed_stddev[i] * cfg.seed_stddev[i];
+                }
+                actor_state.m_seed = params;
+                actor_state.m_seed.set_vector(seed_vec);
+                actor_state.m_seed.set_covariance(seed_cov);
+            }
+
+            // Record the smeared measurement.
+            measurement meas;
+            meas.local = {
+                matrix_operator().element(vec, e_bound_loc0, 0) +
+                    cfg.meas_stddev[0] * normal(engine),
+                matrix_operator().element(vec, e_bound_loc1, 0) +
+                    cfg.meas_stddev[1] * normal(engine)};
+            meas.variance = {cfg.meas_stddev[0] * cfg.meas_stddev[0],
+                             cfg.meas_stddev[1] * cfg.meas_stddev[1]};
+            actor_state.m_candidates.push_back(
+                {static_cast<geometry_id>(navigation.current_object()),
+                 meas});
+
+            // Scatter the particle. The free parameters are updated from
+            // the bound ones by the parameter resetter after this actor.
+            const scalar qop =
+                matrix_operator().element(vec, e_bound_qoverp, 0);
+            const scalar p = std::abs(cfg.charge / qop);
+            const scalar beta = p / std::sqrt(p * p + cfg.mass * cfg.mass);
+            const scalar theta0 =
+                13.6f * detray::unit<scalar>::MeV / (beta * p) *
+                std::abs(cfg.charge) * std::sqrt(cfg.x_over_x0) *
+                (1.f + 0.038f * std::log(cfg.x_over_x0 * cfg.charge *
+                                         cfg.charge / (beta * beta)));
+            const scalar theta =
+                matrix_operator().element(vec, e_bound_theta, 0);
+            matrix_operator().element(vec, e_bound_phi, 0) +=
+                theta0 * normal(engine) / std::sin(theta);
+            matrix_operator().element(vec, e_bound_theta, 0) +=
+                theta0 * normal(engine);
+            params.set_vector(vec);
+        }
+    };
+
+    /// Actor types
+    using transporter = detray::parameter_transporter<transform3_type>;
+    using interactor = detray::pointwise_material_interactor<transform3_type>;
+    using resetter = detray::parameter_resetter<transform3_type>;
+    using actor_chain_type =
+        detray::actor_chain<std::tuple, transporter, interactor, recorder,
+                            resetter>;
+
+    /// Propagator type
+    using propagator_type =
+        detray::propagator<stepper_t, navigator_t, actor_chain_type>;
+
+    /// Constructor with a detector
+    ///
+    /// @param det the detector to simulate the particles in
+    /// @param cfg the configuration of the simulation
+    ///
+    track_candidate_simulator(const detector_type& det, const config& cfg)
+        : m_detector(det), m_cfg(cfg) {}
+
+    /// Simulate one event
+    ///
+    /// The function can be called concurrently from multiple threads.
+    ///
+    /// @param event the number of the event to simulate
+    /// @param mr the memory resource to create the result with
+    /// @return the track candidates of all particles that reached at least
+    ///         one sensitive surface
+    ///
+    track_candidate_container_types::host operator()(
+        std::size_t event, vecmem::memory_resource& mr) const {
+
+        // Set up the random number stream of the event.
+        std::seed_seq seq{static_cast<std::uint32_t>(m_cfg.seed),
+                          static_cast<std::uint32_t>(m_cfg.seed >> 32),
+                          static_cast<std::uint32_t>(event),
+                          static_cast<std::uint32_t>(
+                              static_cast<std::uint64_t>(event) >> 32)};
+        engine_type engine(seq);
+
+        track_candidate_container_types::host result(&mr);
+        propagator_type propagator({}, {});
+        for (unsigned int i = 0; i < m_cfg.n_particles; ++i) {
+
+            // Generate the particle.
+            const free_track_parameters vertex = generate(engine);
+
+            // Propagate it through the detector.
+            typename transporter::state transporter_state{};
+            typename interactor::state interactor_state{};
+            typename recorder::state recorder_state{
+                m_cfg, engine, {}, vecmem::vector<track_candidate>{&mr}};
+            typename resetter::state resetter_state{};
+            auto actor_states = std::tie(transporter_state, interactor_state,
+                                         recorder_state, resetter_state);
+
+            typename propagator_type::state propagation(
+                vertex, m_detector.get_bfield(), m_detector);
+            propagation._stepping
+                .template set_constraint<detray::step::constraint::e_accuracy>(
+                    m_cfg.step_constraint);
+            propagator.propagate(propagation, actor_states);
+
+            if (!recorder_state.m_candidates.empty()) {
+                result.push_back(std::move(recorder_state.m_seed),
+                                 std::move(recorder_state.m_candidates));
+            }
+        }
+        return result;
+    }
+
+    private:
+    /// Generate the parameters of a particle at its vertex
+    free_track_parameters generate(engine_type& engine) const {
+
+        const auto uniform = [&engine](const std::array<scalar, 2>& range) {
+            return std::uniform_real_distribution<scalar>(range[0],
+                                                          range[1])(engine);
+        };
+        std::normal_distribution<scalar> normal(0., 1.);
+
+        point3 pos;
+        for (unsigned int i = 0; i < 3; ++i) {
+            pos[i] = m_cfg.vertex[i] + m_cfg.vertex_stddev[i] * normal(engine);
+        }
+        const scalar p = uniform(m_cfg.mom_range);
+        const scalar theta = uniform(m_cfg.theta_range);
+        const scalar phi = uniform(m_cfg.phi_range);
+        const vector3 mom{p * std::cos(phi) * std::sin(theta),
+                          p * std::sin(phi) * std::sin(theta),
+                          p * std::cos(theta)};
+
+        return free_track_parameters(pos, 0., mom, m_cfg.charge);
+    }
+
+    /// The detector to simulate the particles in
+    const detector_type& m_detector;
+    /// The configuration of the simulation
+    config m_cfg;
+
+};  // class track_candidate_simulator
+
+}  // namespace traccc
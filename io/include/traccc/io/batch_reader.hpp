@@ -0,0 +1,97 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace traccc::io {
+
+/// Reader loading the full contents of many files with batched I/O
+///
+/// The reads of all files are submitted to the kernel in batches through
+/// io_uring, into a pool of preallocated, page aligned buffers. Each file is
+/// handed to a user provided callback, run by a pool of worker threads, as
+/// soon as its read completes. Its buffer is then re-used for one of the
+/// files still to be read.
+///
+/// When io_uring is not available (not a Linux host, a kernel that is too
+/// old, or a sandbox forbidding it) the reads are done with @c pread calls
+/// from a pool of threads instead.
+///
+class batch_reader {
+
+    public:
+    /// The I/O backends known to the reader
+    enum class backend : int {
+        automatic = 0,
+        io_uring = 1,
+        pread = 2,
+    };
+
+    /// Callback receiving the contents of a single file
+    ///
+    /// The arguments are the index of the file in the list given to
+    /// @c traccc::io::batch_reader::read, and the file's contents. The memory
+    /// is only valid during the call. The callback is called from multiple
+    /// threads at the same time.
+    ///
+    using callback_type =
+        std::function<void(std::size_t, const char*, std::size_t)>;
+
+    /// Constructor with the backend and queue configuration
+    ///
+    /// @param requested The backend to use, falling back to @c pread if
+    ///                  io_uring can not be set up
+    /// @param queue_depth The maximal number of reads in flight
+    /// @param threads The number of threads running the callback (and doing
+    ///                the reads of the @c pread backend), 0 meaning one per
+    ///                hardware thread
+    ///
+    batch_reader(backend requested = backend::automatic,
+                 unsigned int queue_depth = 64, unsigned int threads = 0);
+
+    /// Get the backend that is used for the reads
+    backend active_backend() const { return m_backend; }
+
+    /// Read the full contents of a list of files
+    ///
+    /// Exceptions thrown by the callback, and I/O errors, are propagated to
+    /// the caller once all reads in flight have finished.
+    ///
+    /// @param filenames The names of the files to read
+    /// @param callback The function processing the contents of each file
+    ///
+    void read(const std::vector<std::string>& filenames,
+              const callback_type& callback) const;
+
+    private:
+    /// Read the files with io_uring
+    void read_io_uring(const std::vector<std::string>& filenames,
+                       const callback_type& callback) const;
+    /// Read the files with @c pread calls from a thread pool
+    void read_pread(const std::vector<std::string>& filenames,
+                    const callback_type& callback) const;
+
+    /// The backend in use
+    backend m_backend;
+    /// The maximal number of reads in flight
+    unsigned int m_queue_depth;
+    /// The number of threads running the callback
+    unsigned int m_threads;
+
+};  // class batch_reader
+
+/// Printout helper for @c traccc::io::batch_reader::backend
+std::ostream& operator<<(std::ostream& out, batch_reader::backend b);
+
+}  // namespace traccc::io
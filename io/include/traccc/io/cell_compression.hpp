@@ -0,0 +1,68 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/cell.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <vector>
+
+namespace traccc::io {
+
+/// Configuration for the compressed encoding of cells
+struct cell_compression_config {
+    /// The number of bits to quantize the cell activations to
+    ///
+    /// With the default value of 0 the activations are stored without any
+    /// loss of precision. Values between 1 and 32 make the encoding lossy,
+    /// with the activations of every event quantized linearly between
+    /// their minimum and maximum value.
+    ///
+    unsigned int activation_bits = 0;
+};
+
+/// Encode the cells of an event in a compact binary format
+///
+/// The module descriptions are reduced to delta-encoded geometry IDs, the
+/// channel IDs of the cells are delta-encoded within each module, and all
+/// of these integers are stored as variable length integers. The cell
+/// activations are either stored as they are, or quantized and bit-packed,
+/// depending on @c config. Cell times are only stored once if they are the
+/// same for all cells of the event.
+///
+/// The placements and segmentations of the modules are not stored. They
+/// need to be set up again from the detector description when reading
+/// the cells back.
+///
+/// @param cells The cells to encode
+/// @param config The configuration of the encoding
+/// @return The encoded cells
+///
+std::vector<char> compress_cells(
+    const cell_container_types::const_view& cells,
+    const cell_compression_config& config = {});
+
+/// Decode cells encoded with @c traccc::io::compress_cells
+///
+/// The cells are decoded straight into the memory of the result container.
+/// Only the geometry IDs of the module descriptions are set.
+///
+/// @param data The encoded cells
+/// @param size The size of the encoded cells in bytes
+/// @param mr The memory resource to create the result with
+/// @return The decoded cells
+///
+cell_container_types::host decompress_cells(
+    const char* data, std::size_t size, vecmem::memory_resource* mr = nullptr);
+
+}  // namespace traccc::io
@@ -17,6 +17,7 @@ enum data_format : int {
     csv = 0,
     binary = 1,
     json = 2,
+    compressed = 3,
 };
 
 /// Printout helper for @c traccc::data_format
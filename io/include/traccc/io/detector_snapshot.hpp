@@ -0,0 +1,117 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/cell.hpp"
+#include "traccc/geometry/digitization_config.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string_view>
+
+namespace traccc::io {
+
+/// Read-only, memory mapped description of all detector modules
+///
+/// The snapshot is a single binary file holding the sorted geometry IDs of
+/// all detector modules, followed by fully set up @c traccc::cell_module
+/// objects (placement, threshold and pixel segmentation) for each of them.
+/// It is meant to replace the parsing of the surface CSV and digitization
+/// JSON files at the start of every job. The file is mapped into memory
+/// with a single @c mmap call, and module lookups are done with a binary
+/// search over the geometry IDs.
+///
+/// Since the module descriptions are stored as raw bytes, a snapshot can
+/// only be used by a build using the same algebra plugin and scalar type as
+/// the one that wrote it. These are recorded in the file header, and are
+/// checked when opening the file.
+///
+class detector_snapshot {
+
+    public:
+    /// Current version of the snapshot file format
+    static constexpr std::uint32_t format_version = 2;
+
+    /// Open (map) a snapshot file
+    ///
+    /// @param filename The name of the snapshot file, relative to
+    ///                 @c traccc::io::data_directory()
+    ///
+    explicit detector_snapshot(std::string_view filename);
+    /// Unmap the snapshot file
+    ~detector_snapshot();
+
+    /// The object is not copyable
+    detector_snapshot(const detector_snapshot&) = delete;
+    /// The object is movable
+    detector_snapshot(detector_snapshot&& parent) noexcept;
+
+    /// The object is not copy-assignable
+    detector_snapshot& operator=(const detector_snapshot&) = delete;
+    /// The object is move-assignable
+    detector_snapshot& operator=(detector_snapshot&& rhs) noexcept;
+
+    /// Get the number of modules described by the snapshot
+    std::size_t size() const { return m_size; }
+
+    /// Check whether a given module is known to the snapshot
+    bool contains(geometry_id module) const {
+        return find(module) != nullptr;
+    }
+
+    /// Find the description of a given module
+    ///
+    /// @param module The geometry ID of the module to look up
+    /// @return A pointer to the module description, or @c nullptr if the
+    ///         module is not known
+    ///
+    const cell_module* find(geometry_id module) const;
+
+    /// Find the description of a given module, with bounds checking
+    ///
+    /// @param module The geometry ID of the module to look up
+    /// @return The description of the module
+    ///
+    const cell_module& at(geometry_id module) const;
+
+    private:
+    /// Release the memory mapping held by the object
+    void unmap();
+
+    /// Pointer to the beginning of the mapped file
+    void* m_mapping = nullptr;
+    /// Size of the mapped file in bytes
+    std::size_t m_mapping_size = 0;
+    /// Number of modules in the snapshot
+    std::size_t m_size = 0;
+    /// Sorted geometry IDs of the modules
+    const geometry_id* m_ids = nullptr;
+    /// Module descriptions, in the same order as @c m_ids
+    const cell_module* m_modules = nullptr;
+
+};  // class detector_snapshot
+
+/// Write a detector snapshot file
+///
+/// An exception is thrown for modules without a digitization configuration,
+/// the same as when reading cells from CSV files.
+///
+/// @param filename The name of the output file, relative to
+///                 @c traccc::io::data_directory()
+/// @param surfaces The placements of all detector modules
+/// @param dconfig The detector's digitization configuration
+///
+void write_detector_snapshot(std::string_view filename,
+                             const std::map<geometry_id, transform3>& surfaces,
+                             const digitization_config& dconfig);
+
+}  // namespace traccc::io
@@ -0,0 +1,204 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/alt_cell.hpp"
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/edm/track_candidate.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace traccc::io {
+
+/// Location of the data of a single event in an event archive
+struct event_archive_entry {
+    /// The (original) number of the event
+    std::uint64_t event = 0;
+    /// Offset and size of the cells of the event in the file (size 0 if
+    /// missing)
+    std::uint64_t cells_offset = 0, cells_size = 0;
+    /// Offset and size of the spacepoints of the event (size 0 if missing)
+    std::uint64_t spacepoints_offset = 0, spacepoints_size = 0;
+    /// Offset and size of the measurements of the event (size 0 if missing)
+    std::uint64_t measurements_offset = 0, measurements_size = 0;
+    /// Offset and size of the (truth) track candidates of the event (size 0
+    /// if missing)
+    std::uint64_t track_candidates_offset = 0, track_candidates_size = 0;
+};
+
+/// Read-only access to a single-file archive of many events
+///
+/// An archive holds the cells (with fully set up module descriptions) of
+/// any number of events, and optionally their spacepoints and measurements,
+/// in the same binary layout as the per-event @c .dat files. Simulated
+/// events may instead only hold (truth) track candidates, as input for the
+/// track fitting. An index of
+/// the offsets and sizes of all of these blocks is stored at the end of the
+/// file. The index is read when the archive is opened, after which reading
+/// any block of any event takes a single @c pread call, without having to
+/// open any further files.
+///
+/// Reading is thread-safe, so events may be read in parallel.
+///
+/// Since the objects are stored as raw bytes, an archive can only be used
+/// by a build using the same algebra plugin and scalar type as the one that
+/// wrote it. These are recorded in the file header, and are checked when
+/// opening the file.
+///
+class event_archive {
+
+    public:
+    /// Current version of the archive file format
+    static constexpr std::uint32_t format_version = 3;
+
+    /// Open an archive file
+    ///
+    /// @param filename The name of the archive file, relative to
+    ///                 @c traccc::io::data_directory()
+    ///
+    explicit event_archive(std::string_view filename);
+    /// Close the archive file
+    ~event_archive();
+
+    /// The object is not copyable
+    event_archive(const event_archive&) = delete;
+    /// The object is movable
+    event_archive(event_archive&& parent) noexcept;
+
+    /// The object is not copy-assignable
+    event_archive& operator=(const event_archive&) = delete;
+    /// The object is move-assignable
+    event_archive& operator=(event_archive&& rhs) noexcept;
+
+    /// Get the number of events in the archive
+    std::size_t size() const { return m_index.size(); }
+
+    /// Get the index entry of one of the events
+    const event_archive_entry& entry(std::size_t index) const {
+        return m_index.at(index);
+    }
+
+    /// Read the cells of one of the events
+    ///
+    /// @param index The index of the event in the archive
+    /// @param mr The memory resource to create the result with
+    ///
+    cell_container_types::host read_cells(
+        std::size_t index, vecmem::memory_resource* mr = nullptr) const;
+
+    /// Read the cells of one of the events, in the "alt" format
+    ///
+    /// @param index The index of the event in the archive
+    /// @param mr The memory resource to create the result with
+    ///
+    alt_cell_reader_output_t read_cells_alt(
+        std::size_t index, vecmem::memory_resource* mr = nullptr) const;
+
+    /// Read the spacepoints of one of the events
+    ///
+    /// @param index The index of the event in the archive
+    /// @param mr The memory resource to create the result with
+    ///
+    spacepoint_container_types::host read_spacepoints(
+        std::size_t index, vecmem::memory_resource* mr = nullptr) const;
+
+    /// Read the measurements of one of the events
+    ///
+    /// @param index The index of the event in the archive
+    /// @param mr The memory resource to create the result with
+    ///
+    measurement_container_types::host read_measurements(
+        std::size_t index, vecmem::memory_resource* mr = nullptr) const;
+
+    /// Read the track candidates of one of the events
+    ///
+    /// @param index The index of the event in the archive
+    /// @param mr The memory resource to create the result with
+    ///
+    track_candidate_container_types::host read_track_candidates(
+        std::size_t index, vecmem::memory_resource* mr = nullptr) const;
+
+    private:
+    /// Read a block of the file into memory
+    std::vector<char> read_block(std::uint64_t offset,
+                                 std::uint64_t size) const;
+
+    /// The name of the archive file
+    std::string m_filename;
+    /// File descriptor of the archive file
+    int m_fd = -1;
+    /// The index of all events in the archive
+    std::vector<event_archive_entry> m_index;
+
+};  // class event_archive
+
+/// Writer of single-file event archives
+///
+/// Events are appended to the file one by one, and the index is written
+/// at the end of the file by @c close().
+///
+class event_archive_writer {
+
+    public:
+    /// Create a new archive file
+    ///
+    /// @param filename The name of the archive file, relative to
+    ///                 @c traccc::io::data_directory()
+    ///
+    explicit event_archive_writer(std::string_view filename);
+    /// Destructor, closing the archive if it was not closed yet
+    ~event_archive_writer();
+
+    /// The object is not copyable
+    event_archive_writer(const event_archive_writer&) = delete;
+    /// The object is not copy-assignable
+    event_archive_writer& operator=(const event_archive_writer&) = delete;
+
+    /// Append an event to the archive
+    ///
+    /// @param event The number of the event
+    /// @param cells The cells of the event
+    /// @param spacepoints The spacepoints of the event (optional)
+    /// @param measurements The measurements of the event (optional)
+    ///
+    void add(std::size_t event, const cell_container_types::host& cells,
+             const spacepoint_container_types::host* spacepoints = nullptr,
+             const measurement_container_types::host* measurements = nullptr);
+
+    /// Append an event without cells to the archive
+    ///
+    /// @param event The number of the event
+    /// @param track_candidates The (truth) track candidates of the event
+    ///
+    void add(std::size_t event,
+             const track_candidate_container_types::host& track_candidates);
+
+    /// Write the index, and close the archive file
+    void close();
+
+    private:
+    /// The output file
+    std::ofstream m_file;
+    /// The index of the events written so far
+    std::vector<event_archive_entry> m_index;
+
+};  // class event_archive_writer
+
+}  // namespace traccc::io
@@ -0,0 +1,159 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/edm/track_state.hpp"
+
+// System include(s).
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace traccc::io {
+
+/// Value at the start of every record of an output stream
+static constexpr std::uint32_t output_record_magic = 0x54434352;
+
+/// Types of reconstruction products that can be written to an output stream
+enum class output_record_type : std::uint32_t {
+    seeds = 1,
+    track_parameters = 2,
+    track_states = 3
+};
+
+/// Header of a single record in an output stream
+///
+/// For seeds and track parameters the header is followed by @c n_items
+/// objects of @c item_size bytes each. For track states it is followed by
+/// the number of states of each of the @c n_items tracks (as
+/// @c std::uint64_t values), the @c n_items fitter infos, and finally the
+/// track states of all tracks, one after the other. @c size is the number
+/// of bytes following the header in all cases.
+///
+struct output_record_header {
+    std::uint32_t magic = output_record_magic;
+    output_record_type type = output_record_type::seeds;
+    std::uint64_t event = 0;
+    std::uint64_t n_items = 0;
+    std::uint64_t item_size = 0;
+    std::uint64_t size = 0;
+};
+
+/// Append-only binary stream of reconstruction products
+///
+/// Records are copied into an in-memory buffer by the threads producing
+/// them, and written to disk by a background thread. Two buffers are used,
+/// so that one of them can be filled while the other one is being written
+/// out. Producers only have to wait for the disk when both buffers are full.
+///
+/// The stream may be written to from multiple threads at the same time.
+/// Every record is written as a whole, but the order of the records
+/// coming from different threads is not defined.
+///
+class output_stream {
+
+    public:
+    /// Default size of the output buffers
+    static constexpr std::size_t default_buffer_size = 16 * 1024 * 1024;
+
+    /// Constructor with the name of the output file
+    ///
+    /// @param filename The file to append the records to
+    /// @param buffer_size The size of each of the two output buffers
+    ///
+    output_stream(std::string_view filename,
+                  std::size_t buffer_size = default_buffer_size);
+    /// Destructor, writing out all pending records
+    ~output_stream();
+
+    /// The object can not be copied
+    output_stream(const output_stream&) = delete;
+    /// The object can not be copied
+    output_stream& operator=(const output_stream&) = delete;
+
+    /// Write the seeds of an event
+    ///
+    /// @param event The index of the event
+    /// @param seeds The seeds to write
+    ///
+    void write(std::size_t event, const seed_collection_types::host& seeds);
+
+    /// Write the track parameters of an event
+    ///
+    /// @param event The index of the event
+    /// @param params The track parameters to write
+    ///
+    void write(std::size_t event,
+               const bound_track_parameters_collection_types::host& params);
+
+    /// Write the fitted track states of an event
+    ///
+    /// @param event The index of the event
+    /// @param states The fitted tracks to write
+    ///
+    void write(std::size_t event,
+               const track_state_container_types::host& states);
+
+    /// Wait for all records written so far to reach the output file
+    void flush();
+
+    /// Get the number of bytes handed to the stream so far
+    std::size_t bytes_written() const;
+
+    private:
+    /// A block of memory to be appended to a record
+    using chunk = std::pair<const void*, std::size_t>;
+
+    /// Append one record to the active buffer
+    void append(const output_record_header& header,
+                const std::vector<chunk>& chunks);
+    /// Hand the active buffer over to the writer thread
+    ///
+    /// Must be called with @c m_mutex locked through @c lock.
+    ///
+    void swap_buffers(std::unique_lock<std::mutex>& lock);
+    /// Throw an exception if the writer thread ran into an error
+    void check_error() const;
+    /// Function executed by the writer thread
+    void write_loop();
+
+    /// The output file
+    std::ofstream m_file;
+    /// The size at which the active buffer is handed to the writer
+    std::size_t m_buffer_size;
+    /// The buffer being filled by the producers
+    std::vector<char> m_active;
+    /// The buffer being written out by the writer thread
+    std::vector<char> m_writing;
+    /// Whether @c m_writing holds data that was not written out yet
+    bool m_pending = false;
+    /// Whether the writer thread should stop
+    bool m_stop = false;
+    /// Whether writing to the output file failed
+    bool m_failed = false;
+    /// The number of bytes handed to the stream
+    std::size_t m_bytes = 0;
+    /// Mutex protecting all of the above
+    mutable std::mutex m_mutex;
+    /// Condition variable signalling a change of @c m_pending or @c m_stop
+    std::condition_variable m_cv;
+    /// The writer thread
+    std::thread m_writer;
+
+};  // class output_stream
+
+}  // namespace traccc::io
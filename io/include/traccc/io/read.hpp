@@ -9,7 +9,9 @@
 
 // Local include(s).
 #include "traccc/io/data_format.hpp"
+#include "traccc/io/demonstrator_alt_edm.hpp"
 #include "traccc/io/demonstrator_edm.hpp"
+#include "traccc/io/event_archive.hpp"
 
 // VecMem include(s).
 #include <vecmem/memory/memory_resource.hpp>
@@ -23,6 +25,8 @@ namespace traccc::io {
 ///
 /// This function can read data about multiple events into memory at the
 /// same time. Even using (OpenMP) parallelism for the reading if possible.
+/// Binary and compressed files are read with batched I/O (see
+/// @c traccc::io::batch_reader).
 ///
 /// @param events The number of events to read input data for
 /// @param directory The directory to read the cell data from
@@ -38,4 +42,42 @@ demonstrator_input read(std::size_t events, std::string_view directory,
                         data_format format = data_format::csv,
                         vecmem::memory_resource *mr = nullptr);
 
+/// Read input data for a specified number of events, using a detector
+/// snapshot for the module descriptions
+///
+/// @param events The number of events to read input data for
+/// @param directory The directory to read the cell data from
+/// @param detector_snapshot_file The binary snapshot of the detector
+///                               (see @c traccc::io::detector_snapshot)
+/// @param format The format of the event file(s)
+/// @param mr The memory resource to allocate the container(s) with
+/// @return An object with the requested events worth of input
+///
+demonstrator_input read(std::size_t events, std::string_view directory,
+                        std::string_view detector_snapshot_file,
+                        data_format format = data_format::csv,
+                        vecmem::memory_resource *mr = nullptr);
+
+/// Read input data for a specified number of events from an event archive
+///
+/// @param events The number of events to read input data for
+/// @param archive The archive to read the events from
+/// @param mr The memory resource to allocate the container(s) with
+/// @return An object with the requested events worth of input
+///
+demonstrator_input read(std::size_t events, const event_archive &archive,
+                        vecmem::memory_resource *mr = nullptr);
+
+/// Read input data for a specified number of events from an event archive,
+/// in the "alt" format
+///
+/// @param events The number of events to read input data for
+/// @param archive The archive to read the events from
+/// @param mr The memory resource to allocate the container(s) with
+/// @return An object with the requested events worth of input
+///
+alt_demonstrator_input read_alt(std::size_t events,
+                                const event_archive &archive,
+                                vecmem::memory_resource *mr = nullptr);
+
 }  // namespace traccc::io
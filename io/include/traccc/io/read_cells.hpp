@@ -9,6 +9,7 @@
 
 // Local include(s).
 #include "traccc/io/data_format.hpp"
+#include "traccc/io/detector_snapshot.hpp"
 
 // Project include(s).
 #include "traccc/edm/cell.hpp"
@@ -20,10 +21,21 @@
 
 // System include(s).
 #include <cstddef>
+#include <string>
 #include <string_view>
 
 namespace traccc::io {
 
+/// Get the name of the cell data file of a given event
+///
+/// @param event The event ID to get the file name for
+/// @param directory The directory holding the cell data files
+/// @param format The format of the cell data files
+/// @return The full path of the cell data file
+///
+std::string get_cells_filename(std::size_t event, std::string_view directory,
+                               data_format format);
+
 /// Read cell data into memory
 ///
 /// The file to read is selected according the naming conventions used in
@@ -60,4 +72,58 @@ cell_container_types::host read_cells(
     const digitization_config *dconfig = nullptr,
     vecmem::memory_resource *mr = nullptr);
 
+/// Read cell data into memory, using a detector snapshot
+///
+/// The file to read is selected according the naming conventions used in
+/// our data. The module descriptions are taken from the detector snapshot.
+///
+/// @param event The event ID to read in the cells for
+/// @param directory The directory holding the cell data files
+/// @param detector The snapshot describing all detector modules
+/// @param format The format of the cell data files (to read)
+/// @param mr The memory resource to create the host container with
+/// @return A cell (host) container
+///
+cell_container_types::host read_cells(std::size_t event,
+                                      std::string_view directory,
+                                      const detector_snapshot &detector,
+                                      data_format format = data_format::csv,
+                                      vecmem::memory_resource *mr = nullptr);
+
+/// Read cell data from a memory buffer
+///
+/// Only the @c traccc::data_format::binary and
+/// @c traccc::data_format::compressed formats are supported.
+///
+/// @param data The contents of a cell data file
+/// @param size The size of the cell data file
+/// @param format The format of the cell data
+/// @param geom The description of the detector geometry
+/// @param dconfig The detector's digitization configuration
+/// @param mr The memory resource to create the host container with
+/// @return A cell (host) container
+///
+cell_container_types::host read_cells(
+    const char *data, std::size_t size, data_format format,
+    const geometry *geom = nullptr,
+    const digitization_config *dconfig = nullptr,
+    vecmem::memory_resource *mr = nullptr);
+
+/// Read cell data from a memory buffer, using a detector snapshot
+///
+/// Only the @c traccc::data_format::binary and
+/// @c traccc::data_format::compressed formats are supported.
+///
+/// @param data The contents of a cell data file
+/// @param size The size of the cell data file
+/// @param detector The snapshot describing all detector modules
+/// @param format The format of the cell data
+/// @param mr The memory resource to create the host container with
+/// @return A cell (host) container
+///
+cell_container_types::host read_cells(const char *data, std::size_t size,
+                                      const detector_snapshot &detector,
+                                      data_format format,
+                                      vecmem::memory_resource *mr = nullptr);
+
 }  // namespace traccc::io
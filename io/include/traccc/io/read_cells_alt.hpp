@@ -12,6 +12,7 @@
 
 // Project include(s).
 #include "traccc/edm/alt_cell.hpp"
+#include "traccc/edm/alt_cell_soa.hpp"
 #include "traccc/geometry/digitization_config.hpp"
 #include "traccc/geometry/geometry.hpp"
 
@@ -60,4 +61,42 @@ alt_cell_reader_output_t read_cells_alt(
     const digitization_config *dconfig = nullptr,
     vecmem::memory_resource *mr = nullptr);
 
+/// Read cell data into memory, with the cells stored as structure of arrays
+///
+/// The file to read is selected according the naming conventions used in
+/// our data.
+///
+/// @param event The event ID to read in the cells for
+/// @param directory The directory holding the cell data files
+/// @param format The format of the cell data files (to read)
+/// @param geom The description of the detector geometry
+/// @param dconfig The detector's digitization configuration
+/// @param mr The memory resource to create the host collections with
+/// @return A structure-of-arrays alt_cell (host) collection & a cell_module
+///         collection
+///
+alt_cell_soa_reader_output_t read_cells_alt_soa(
+    std::size_t event, std::string_view directory,
+    data_format format = data_format::csv, const geometry *geom = nullptr,
+    const digitization_config *dconfig = nullptr,
+    vecmem::memory_resource *mr = nullptr);
+
+/// Read cell data into memory, with the cells stored as structure of arrays
+///
+/// The file name is selected explicitly by the user.
+///
+/// @param filename The file to read the cell data from
+/// @param format The format of the cell data files (to read)
+/// @param geom The description of the detector geometry
+/// @param dconfig The detector's digitization configuration
+/// @param mr The memory resource to create the host collections with
+/// @return A structure-of-arrays alt_cell (host) collection & a cell_module
+///         collection
+///
+alt_cell_soa_reader_output_t read_cells_alt_soa(
+    std::string_view filename, data_format format = data_format::csv,
+    const geometry *geom = nullptr,
+    const digitization_config *dconfig = nullptr,
+    vecmem::memory_resource *mr = nullptr);
+
 }  // namespace traccc::io
@@ -0,0 +1,29 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/field/field_map.hpp"
+
+// System include(s).
+#include <string_view>
+
+namespace traccc::io {
+
+/// Read a magnetic field map from a CSV file
+///
+/// The file needs to hold the field, in Tesla, on every point of a regular
+/// grid in x, y and z (in millimeters). The points may be in any order.
+///
+/// @param filename The name of the input file, relative to the data
+///                 directory
+/// @return The field map, with the field in native units
+///
+field_map read_field_map(std::string_view filename);
+
+}  // namespace traccc::io
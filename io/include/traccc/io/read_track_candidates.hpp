@@ -0,0 +1,54 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/io/data_format.hpp"
+
+// Project include(s).
+#include "traccc/edm/track_candidate.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <string_view>
+
+namespace traccc::io {
+
+/// Read track candidate data into memory
+///
+/// The file to read is selected according the naming conventions used in
+/// our data.
+///
+/// @param event The event ID to read in the track candidates for
+/// @param directory The directory holding the track candidate data files
+/// @param format The format of the track candidate data files (to read)
+/// @param mr The memory resource to create the host container with
+/// @return A track candidate (host) container
+///
+track_candidate_container_types::host read_track_candidates(
+    std::size_t event, std::string_view directory,
+    data_format format = data_format::binary,
+    vecmem::memory_resource *mr = nullptr);
+
+/// Read track candidate data into memory
+///
+/// The file name is selected explicitly by the user.
+///
+/// @param filename The file to read the track candidate data from
+/// @param format The format of the track candidate data file (to read)
+/// @param mr The memory resource to create the host container with
+/// @return A track candidate (host) container
+///
+track_candidate_container_types::host read_track_candidates(
+    std::string_view filename, data_format format = data_format::binary,
+    vecmem::memory_resource *mr = nullptr);
+
+}  // namespace traccc::io
@@ -10,6 +10,8 @@
 // Project include(s).
 #include "traccc/edm/cell.hpp"
 #include "traccc/edm/spacepoint.hpp"
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/io/cell_compression.hpp"
 #include "traccc/io/data_format.hpp"
 
 // System include(s).
@@ -24,10 +26,12 @@ namespace traccc::io {
 /// @param directory is the directory for the output cell file
 /// @param format is the data format (e.g. csv or binary) of output file
 /// @param cells is the cell container to write
+/// @param compression is the configuration of the compressed format
 ///
 void write(std::size_t event, std::string_view directory,
            traccc::data_format format,
-           traccc::cell_container_types::const_view cells);
+           traccc::cell_container_types::const_view cells,
+           const cell_compression_config& compression = {});
 
 /// Function for hit file writing
 ///
@@ -51,4 +55,15 @@ void write(std::size_t event, std::string_view directory,
            traccc::data_format format,
            measurement_container_types::const_view measurements);
 
+/// Function for track candidate file writing
+///
+/// @param event is the event index
+/// @param directory is the directory for the output track candidate file
+/// @param format is the data format (e.g. csv or binary) of output file
+/// @param track_candidates is the track candidate container to write
+///
+void write(std::size_t event, std::string_view directory,
+           traccc::data_format format,
+           track_candidate_container_types::const_view track_candidates);
+
 }  // namespace traccc::io
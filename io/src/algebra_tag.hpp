@@ -0,0 +1,61 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+
+// System include(s).
+#include <array>
+#include <cstddef>
+#include <cstring>
+
+// Helper macros for turning the scalar type definitions into strings.
+#define TRACCC_IO_ALGEBRA_TAG_STRING(x) #x
+#define TRACCC_IO_ALGEBRA_TAG_EXPAND(x) TRACCC_IO_ALGEBRA_TAG_STRING(x)
+
+namespace traccc::io::details {
+
+/// Size of the algebra tag in the binary file headers
+constexpr std::size_t algebra_tag_size = 32;
+
+/// Tag describing the algebra plugin and the scalar types of the build
+///
+/// The binary files holding raw event data model objects store it in their
+/// headers. Objects of two different configurations may have the same size,
+/// while having a different memory layout.
+///
+using algebra_tag = std::array<char, algebra_tag_size>;
+
+/// @return The algebra tag of the current build
+inline algebra_tag current_algebra_tag() {
+
+#if ALGEBRA_PLUGINS_INCLUDE_ARRAY
+    static constexpr char plugin[] = "array";
+#elif ALGEBRA_PLUGINS_INCLUDE_EIGEN
+    static constexpr char plugin[] = "eigen";
+#elif ALGEBRA_PLUGINS_INCLUDE_SMATRIX
+    static constexpr char plugin[] = "smatrix";
+#elif ALGEBRA_PLUGINS_INCLUDE_VC
+    static constexpr char plugin[] = "vc";
+#elif ALGEBRA_PLUGINS_INCLUDE_VECMEM
+    static constexpr char plugin[] = "vecmem";
+#endif
+    static constexpr char tag[] =
+        "/" TRACCC_IO_ALGEBRA_TAG_EXPAND(TRACCC_CUSTOM_SCALARTYPE) "/"
+            TRACCC_IO_ALGEBRA_TAG_EXPAND(TRACCC_CUSTOM_FITTING_SCALARTYPE);
+    static_assert(sizeof(plugin) + sizeof(tag) <= algebra_tag_size,
+                  "Algebra tag is too long");
+
+    algebra_tag result{};
+    std::memcpy(result.data(), plugin, sizeof(plugin) - 1);
+    std::memcpy(result.data() + sizeof(plugin) - 1, tag, sizeof(tag));
+    return result;
+}
+
+}  // namespace traccc::io::details
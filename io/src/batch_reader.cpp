@@ -0,0 +1,651 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/batch_reader.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+// POSIX include(s).
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Linux include(s).
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define TRACCC_IO_HAVE_IO_URING
+#endif
+#endif
+
+namespace {
+
+/// Alignment of the read buffers
+constexpr std::size_t buffer_alignment = 4096;
+
+/// Largest single read request (io_uring reads take a 32-bit length)
+constexpr std::size_t max_read_size = std::size_t{1} << 30;
+
+/// Page aligned memory buffer, growing as needed
+class aligned_buffer {
+
+    public:
+    /// Make sure that the buffer can hold a given number of bytes
+    char* reserve(std::size_t size) {
+        if ((size > m_capacity) || (!m_data)) {
+            const std::size_t capacity =
+                std::max<std::size_t>((size + buffer_alignment - 1) /
+                                          buffer_alignment * buffer_alignment,
+                                      buffer_alignment);
+            m_data.reset(static_cast<char*>(
+                std::aligned_alloc(buffer_alignment, capacity)));
+            if (!m_data) {
+                throw std::bad_alloc();
+            }
+            m_capacity = capacity;
+        }
+        return m_data.get();
+    }
+    /// Pointer to the buffer's memory
+    char* data() { return m_data.get(); }
+
+    private:
+    /// Deleter for memory allocated with @c std::aligned_alloc
+    struct deleter {
+        void operator()(char* ptr) const { std::free(ptr); }
+    };
+    /// The buffer's memory
+    std::unique_ptr<char, deleter> m_data;
+    /// The size of the buffer
+    std::size_t m_capacity = 0;
+
+};  // class aligned_buffer
+
+/// An open input file
+struct input_file {
+    /// The file descriptor
+    int fd = -1;
+    /// The size of the file
+    std::size_t size = 0;
+};
+
+/// Open a file, and get its size
+input_file open_file(const std::string& filename) {
+
+    input_file result;
+    result.fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (result.fd < 0) {
+        throw std::runtime_error("Could not open file: " + filename);
+    }
+    struct stat file_stat;
+    if (::fstat(result.fd, &file_stat) != 0) {
+        ::close(result.fd);
+        throw std::runtime_error("Could not stat file: " + filename);
+    }
+    result.size = static_cast<std::size_t>(file_stat.st_size);
+    return result;
+}
+
+/// Read (the remainder of) a file with blocking @c pread calls
+void pread_fully(int fd, char* buffer, std::size_t size, std::size_t offset,
+                 const std::string& filename) {
+
+    while (offset < size) {
+        const ssize_t result =
+            ::pread(fd, buffer + offset, std::min(size - offset, max_read_size),
+                    static_cast<off_t>(offset));
+        if ((result < 0) && (errno == EINTR)) {
+            continue;
+        }
+        if (result <= 0) {
+            throw std::runtime_error("Could not read file: " + filename);
+        }
+        offset += static_cast<std::size_t>(result);
+    }
+}
+
+#ifdef TRACCC_IO_HAVE_IO_URING
+
+/// Minimal io_uring instance, using the raw system calls
+///
+/// Only what is needed for reading files is implemented. Submissions and
+/// completions must only be handled by one thread at a time.
+///
+class uring {
+
+    public:
+    /// Set up a ring with (at least) the specified number of entries
+    explicit uring(unsigned int entries) {
+
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        m_fd =
+            static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (m_fd < 0) {
+            throw std::runtime_error("Could not set up io_uring");
+        }
+
+        // Map the submission and completion rings, and the submission
+        // entries into memory.
+        m_sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        m_cq_size =
+            params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP);
+        if (single_mmap) {
+            m_sq_size = m_cq_size = std::max(m_sq_size, m_cq_size);
+        }
+        m_sq_ptr = ::mmap(nullptr, m_sq_size, PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQ_RING);
+        if (m_sq_ptr == MAP_FAILED) {
+            m_sq_ptr = nullptr;
+            release();
+            throw std::runtime_error("Could not map the io_uring queues");
+        }
+        if (single_mmap) {
+            m_cq_ptr = m_sq_ptr;
+        } else {
+            m_cq_ptr =
+                ::mmap(nullptr, m_cq_size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_CQ_RING);
+            if (m_cq_ptr == MAP_FAILED) {
+                m_cq_ptr = nullptr;
+                release();
+                throw std::runtime_error("Could not map the io_uring queues");
+            }
+        }
+        m_sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqes =
+            ::mmap(nullptr, m_sqes_size, PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED) {
+            release();
+            throw std::runtime_error("Could not map the io_uring entries");
+        }
+        m_sqes = static_cast<io_uring_sqe*>(sqes);
+
+        // Set up the pointers into the rings.
+        char* sq = static_cast<char*>(m_sq_ptr);
+        m_sq_head = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        m_sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        m_sq_mask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        m_sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        m_sq_entries = params.sq_entries;
+        char* cq = static_cast<char*>(m_cq_ptr);
+        m_cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        m_cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        m_cq_mask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        m_cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    }
+    /// Tear down the ring
+    ~uring() { release(); }
+
+    /// The object is not copyable
+    uring(const uring&) = delete;
+    /// The object is not copy-assignable
+    uring& operator=(const uring&) = delete;
+
+    /// Queue a read request, returning @c false if the queue is full
+    bool queue_read(int fd, char* buffer, std::size_t size,
+                    std::size_t offset, std::uint64_t user_data) {
+
+        const unsigned tail = *m_sq_tail;
+        const unsigned head = __atomic_load_n(m_sq_head, __ATOMIC_ACQUIRE);
+        if (tail - head >= m_sq_entries) {
+            return false;
+        }
+        const unsigned index = tail & m_sq_mask;
+        io_uring_sqe& sqe = m_sqes[index];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = IORING_OP_READ;
+        sqe.fd = fd;
+        sqe.addr = reinterpret_cast<std::uint64_t>(buffer);
+        sqe.len = static_cast<std::uint32_t>(std::min(size, max_read_size));
+        sqe.off = offset;
+        sqe.user_data = user_data;
+        m_sq_array[index] = index;
+        __atomic_store_n(m_sq_tail, tail + 1, __ATOMIC_RELEASE);
+        ++m_queued;
+        return true;
+    }
+
+    /// Submit all queued requests, and wait for at least one completion
+    void submit_and_wait() {
+
+        while (true) {
+            const long result =
+                ::syscall(__NR_io_uring_enter, m_fd, m_queued, 1u,
+                          IORING_ENTER_GETEVENTS, nullptr, 0);
+            if (result >= 0) {
+                m_queued -= std::min(m_queued, static_cast<unsigned>(result));
+                return;
+            }
+            if ((errno != EINTR) && (errno != EAGAIN)) {
+                throw std::runtime_error("io_uring submission failed");
+            }
+        }
+    }
+
+    /// Take the next completion off the queue, if there is any
+    bool pop(io_uring_cqe& cqe) {
+
+        const unsigned head = *m_cq_head;
+        if (head == __atomic_load_n(m_cq_tail, __ATOMIC_ACQUIRE)) {
+            return false;
+        }
+        cqe = m_cqes[head & m_cq_mask];
+        __atomic_store_n(m_cq_head, head + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    private:
+    /// Release all resources held by the ring
+    void release() {
+        if (m_sqes != nullptr) {
+            ::munmap(m_sqes, m_sqes_size);
+            m_sqes = nullptr;
+        }
+        if ((m_cq_ptr != nullptr) && (m_cq_ptr != m_sq_ptr)) {
+            ::munmap(m_cq_ptr, m_cq_size);
+        }
+        m_cq_ptr = nullptr;
+        if (m_sq_ptr != nullptr) {
+            ::munmap(m_sq_ptr, m_sq_size);
+            m_sq_ptr = nullptr;
+        }
+        if (m_fd >= 0) {
+            ::close(m_fd);
+            m_fd = -1;
+        }
+    }
+
+    /// The ring's file descriptor
+    int m_fd = -1;
+    /// Mapped submission ring
+    void* m_sq_ptr = nullptr;
+    /// Size of the mapped submission ring
+    std::size_t m_sq_size = 0;
+    /// Mapped completion ring
+    void* m_cq_ptr = nullptr;
+    /// Size of the mapped completion ring
+    std::size_t m_cq_size = 0;
+    /// Mapped submission entries
+    io_uring_sqe* m_sqes = nullptr;
+    /// Size of the mapped submission entries
+    std::size_t m_sqes_size = 0;
+
+    /// Pointers into the submission ring
+    unsigned *m_sq_head = nullptr, *m_sq_tail = nullptr, *m_sq_array = nullptr;
+    /// Mask and size of the submission ring
+    unsigned m_sq_mask = 0, m_sq_entries = 0;
+    /// Pointers into the completion ring
+    unsigned *m_cq_head = nullptr, *m_cq_tail = nullptr;
+    /// Mask of the completion ring
+    unsigned m_cq_mask = 0;
+    /// Completion entries
+    io_uring_cqe* m_cqes = nullptr;
+    /// Number of requests queued, but not submitted yet
+    unsigned m_queued = 0;
+
+};  // class uring
+
+#endif  // TRACCC_IO_HAVE_IO_URING
+
+}  // namespace
+
+namespace traccc::io {
+
+batch_reader::batch_reader(backend requested, unsigned int queue_depth,
+                           unsigned int threads)
+    : m_backend(backend::pread),
+      m_queue_depth(std::max(queue_depth, 1u)),
+      m_threads(threads != 0 ? threads
+                             : std::max(std::thread::hardware_concurrency(),
+                                        1u)) {
+
+#ifdef TRACCC_IO_HAVE_IO_URING
+    // Check whether an io_uring instance can be set up in this environment.
+    if (requested != backend::pread) {
+        try {
+            uring probe{m_queue_depth};
+            m_backend = backend::io_uring;
+        } catch (const std::runtime_error&) {
+        }
+    }
+#else
+    (void)requested;
+#endif
+}
+
+void batch_reader::read(const std::vector<std::string>& filenames,
+                        const callback_type& callback) const {
+
+    if (filenames.empty()) {
+        return;
+    }
+    if (m_backend == backend::io_uring) {
+        read_io_uring(filenames, callback);
+    } else {
+        read_pread(filenames, callback);
+    }
+}
+
+void batch_reader::read_io_uring(
+    [[maybe_unused]] const std::vector<std::string>& filenames,
+    [[maybe_unused]] const callback_type& callback) const {
+
+#ifdef TRACCC_IO_HAVE_IO_URING
+    // The state of one of the reads in flight.
+    struct slot {
+        std::size_t file = 0;
+        input_file input;
+        std::size_t done = 0;
+        aligned_buffer buffer;
+    };
+    std::vector<slot> slots(std::min<std::size_t>(m_queue_depth,
+                                                  filenames.size()));
+
+    uring ring{static_cast<unsigned int>(slots.size())};
+    std::size_t next_file = 0;
+    std::size_t in_flight = 0;
+
+    // State shared with the worker threads, which run the callback on the
+    // files that were read completely.
+    std::mutex mutex;
+    std::condition_variable ready_cv, freed_cv;
+    // Slots of files waiting for the callback
+    std::deque<std::size_t> ready;
+    // Slots that the callback is done with
+    std::deque<std::size_t> freed;
+    // Number of slots handed to the workers, and not given back yet
+    std::size_t busy = 0;
+    // Flag telling the workers that no more slots will be handed to them
+    bool finished = false;
+    std::exception_ptr error;
+
+    // Record an error, keeping the first one.
+    auto set_error = [&](std::exception_ptr e) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!error) {
+            error = e;
+        }
+    };
+    // Check whether an error occurred.
+    auto failed = [&]() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return static_cast<bool>(error);
+    };
+    // Hand a file that was read completely to the workers.
+    auto finish = [&](std::size_t index) {
+        ::close(slots[index].input.fd);
+        slots[index].input.fd = -1;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ready.push_back(index);
+            ++busy;
+        }
+        ready_cv.notify_one();
+    };
+    // Start reading the next file into a given slot.
+    auto start = [&](std::size_t index) {
+        slot& s = slots[index];
+        while ((next_file < filenames.size()) && (!failed())) {
+            try {
+                s.file = next_file++;
+                s.input = open_file(filenames[s.file]);
+                s.done = 0;
+                s.buffer.reserve(s.input.size);
+                if (s.input.size == 0) {
+                    finish(index);
+                    return;
+                }
+                if (!ring.queue_read(s.input.fd, s.buffer.data(),
+                                     s.input.size, 0, index)) {
+                    throw std::logic_error("io_uring queue overflow");
+                }
+                ++in_flight;
+                return;
+            } catch (...) {
+                if (s.input.fd >= 0) {
+                    ::close(s.input.fd);
+                    s.input.fd = -1;
+                }
+                set_error(std::current_exception());
+            }
+        }
+    };
+
+    // Function executed by the worker threads, running the callback on the
+    // files handed to them until the reading is finished.
+    auto work = [&]() {
+        while (true) {
+            std::size_t index = 0;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                ready_cv.wait(lock,
+                              [&]() { return finished || !ready.empty(); });
+                if (ready.empty()) {
+                    return;
+                }
+                index = ready.front();
+                ready.pop_front();
+            }
+            slot& s = slots[index];
+            std::exception_ptr callback_error;
+            try {
+                callback(s.file, s.buffer.data(), s.input.size);
+            } catch (...) {
+                callback_error = std::current_exception();
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (callback_error && (!error)) {
+                    error = callback_error;
+                }
+                freed.push_back(index);
+                --busy;
+            }
+            freed_cv.notify_one();
+        }
+    };
+    std::vector<std::thread> workers;
+    const std::size_t n_workers =
+        std::min<std::size_t>(m_threads, filenames.size());
+    workers.reserve(n_workers);
+    for (std::size_t i = 0; i < n_workers; ++i) {
+        workers.emplace_back(work);
+    }
+
+    // Fill the queue, and then keep it full while processing completions.
+    // Slots are only re-used once the workers are done with their files.
+    try {
+        for (std::size_t i = 0; i < slots.size(); ++i) {
+            start(i);
+        }
+        while (true) {
+            if (in_flight > 0) {
+                ring.submit_and_wait();
+                io_uring_cqe cqe;
+                while (ring.pop(cqe)) {
+                    const std::size_t index =
+                        static_cast<std::size_t>(cqe.user_data);
+                    slot& s = slots[index];
+                    --in_flight;
+                    try {
+                        if (cqe.res > 0) {
+                            s.done += static_cast<std::size_t>(cqe.res);
+                        } else if (cqe.res == 0) {
+                            throw std::runtime_error(
+                                "Unexpected end of file: " + filenames[s.file]);
+                        } else {
+                            // Let the kernel's error (or missing support for
+                            // the operation) be handled by a blocking read.
+                            pread_fully(s.input.fd, s.buffer.data(),
+                                        s.input.size, s.done,
+                                        filenames[s.file]);
+                            s.done = s.input.size;
+                        }
+                        if (s.done < s.input.size) {
+                            // Issue a new request for the rest of a short
+                            // read.
+                            if (!ring.queue_read(
+                                    s.input.fd, s.buffer.data() + s.done,
+                                    s.input.size - s.done, s.done, index)) {
+                                throw std::logic_error(
+                                    "io_uring queue overflow");
+                            }
+                            ++in_flight;
+                            continue;
+                        }
+                        finish(index);
+                    } catch (...) {
+                        if (s.input.fd >= 0) {
+                            ::close(s.input.fd);
+                            s.input.fd = -1;
+                        }
+                        set_error(std::current_exception());
+                        start(index);
+                    }
+                }
+            }
+
+            // Re-use the slots that the workers are done with. If no read
+            // is in flight, wait for one of them, or for all work to end.
+            std::deque<std::size_t> restart;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                if (in_flight == 0) {
+                    freed_cv.wait(lock, [&]() {
+                        return (!freed.empty()) || (busy == 0);
+                    });
+                }
+                restart.swap(freed);
+                if ((in_flight == 0) && (busy == 0) && restart.empty()) {
+                    break;
+                }
+            }
+            for (std::size_t index : restart) {
+                start(index);
+            }
+        }
+    } catch (...) {
+        set_error(std::current_exception());
+    }
+
+    // Stop the workers.
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        finished = true;
+    }
+    ready_cv.notify_all();
+    for (std::thread& t : workers) {
+        t.join();
+    }
+
+    // Report the first error that occurred.
+    if (error) {
+        std::rethrow_exception(error);
+    }
+#else
+    throw std::logic_error("io_uring is not supported by this build");
+#endif
+}
+
+void batch_reader::read_pread(const std::vector<std::string>& filenames,
+                              const callback_type& callback) const {
+
+    std::atomic<std::size_t> next_file{0};
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    // Function executed by every thread, reading files until there are any
+    // left.
+    auto process = [&]() {
+        aligned_buffer buffer;
+        while (!failed) {
+            const std::size_t file = next_file++;
+            if (file >= filenames.size()) {
+                return;
+            }
+            input_file input;
+            try {
+                input = open_file(filenames[file]);
+                buffer.reserve(input.size);
+                pread_fully(input.fd, buffer.data(), input.size, 0,
+                            filenames[file]);
+                ::close(input.fd);
+                input.fd = -1;
+                callback(file, buffer.data(), input.size);
+            } catch (...) {
+                if (input.fd >= 0) {
+                    ::close(input.fd);
+                }
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                failed = true;
+            }
+        }
+    };
+
+    // Run the reads on the requested number of threads.
+    const std::size_t n_threads =
+        std::min<std::size_t>(m_threads, filenames.size());
+    std::vector<std::thread> threads;
+    threads.reserve(n_threads - 1);
+    for (std::size_t i = 1; i < n_threads; ++i) {
+        threads.emplace_back(process);
+    }
+    process();
+    for (std::thread& t : threads) {
+        t.join();
+    }
+
+    // Report the first error that occurred.
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+std::ostream& operator<<(std::ostream& out, batch_reader::backend b) {
+
+    switch (b) {
+        case batch_reader::backend::automatic:
+            out << "automatic";
+            break;
+        case batch_reader::backend::io_uring:
+            out << "io_uring";
+            break;
+        case batch_reader::backend::pread:
+            out << "pread";
+            break;
+        default:
+            out << "?!?";
+            break;
+    }
+    return out;
+}
+
+}  // namespace traccc::io
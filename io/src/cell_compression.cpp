@@ -0,0 +1,402 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/cell_compression.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+/// Identifier at the start of every encoded event
+constexpr char compression_magic[4] = {'T', 'R', 'C', 'Z'};
+
+/// Current version of the encoding
+constexpr std::uint16_t compression_version = 1;
+
+/// Flag signalling that all cells of the event have the same time
+constexpr std::uint8_t constant_time_flag = 0x1;
+
+/// Header at the start of every encoded event
+struct compression_header {
+    char magic[4];
+    std::uint16_t version;
+    std::uint8_t activation_bits;
+    std::uint8_t flags;
+    std::uint32_t scalar_size;
+    std::uint32_t padding;
+    std::uint64_t n_modules;
+    std::uint64_t n_cells;
+    /// Size of the variable length integer section
+    std::uint64_t varint_size;
+    /// Offset and step of the quantized activations
+    double activation_min;
+    double activation_step;
+    /// The time of all cells, if it is the same for all of them
+    double time;
+};
+
+/// Map a signed integer onto an unsigned one, keeping small values small
+inline std::uint64_t zigzag_encode(std::int64_t value) {
+    return (static_cast<std::uint64_t>(value) << 1) ^
+           static_cast<std::uint64_t>(value >> 63);
+}
+
+/// Inverse of @c zigzag_encode
+inline std::int64_t zigzag_decode(std::uint64_t value) {
+    return static_cast<std::int64_t>(value >> 1) ^
+           -static_cast<std::int64_t>(value & 1);
+}
+
+/// Append a variable length integer to a buffer
+inline void write_varint(std::vector<char>& out, std::uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+/// Reader of a block of variable length integers
+class varint_reader {
+    public:
+    varint_reader(const char* begin, const char* end)
+        : m_ptr(reinterpret_cast<const std::uint8_t*>(begin)),
+          m_end(reinterpret_cast<const std::uint8_t*>(end)) {}
+
+    /// Read the next integer
+    std::uint64_t read() {
+        std::uint64_t result = 0;
+        for (unsigned int shift = 0; shift < 64; shift += 7) {
+            if (m_ptr == m_end) {
+                throw std::runtime_error("Truncated compressed cell data");
+            }
+            const std::uint8_t byte = *(m_ptr++);
+            result |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0) {
+                return result;
+            }
+        }
+        throw std::runtime_error("Corrupt compressed cell data");
+    }
+
+    private:
+    const std::uint8_t* m_ptr;
+    const std::uint8_t* m_end;
+};
+
+/// Writer of fixed width unsigned integers into a packed bit stream
+class bit_writer {
+    public:
+    explicit bit_writer(std::vector<char>& out) : m_out(out) {}
+
+    /// Append the lowest @c bits bits of @c value
+    void write(std::uint64_t value, unsigned int bits) {
+        m_buffer |= value << m_bits;
+        m_bits += bits;
+        while (m_bits >= 8) {
+            m_out.push_back(static_cast<char>(m_buffer & 0xff));
+            m_buffer >>= 8;
+            m_bits -= 8;
+        }
+    }
+    /// Write out the last, partially filled byte
+    void finish() {
+        if (m_bits > 0) {
+            m_out.push_back(static_cast<char>(m_buffer & 0xff));
+        }
+        m_buffer = 0;
+        m_bits = 0;
+    }
+
+    private:
+    std::vector<char>& m_out;
+    std::uint64_t m_buffer = 0;
+    unsigned int m_bits = 0;
+};
+
+/// Reader of fixed width unsigned integers from a packed bit stream
+class bit_reader {
+    public:
+    bit_reader(const char* begin, const char* end)
+        : m_ptr(reinterpret_cast<const std::uint8_t*>(begin)),
+          m_end(reinterpret_cast<const std::uint8_t*>(end)) {}
+
+    /// Read the next @c bits bits
+    std::uint64_t read(unsigned int bits) {
+        while (m_bits < bits) {
+            if (m_ptr == m_end) {
+                throw std::runtime_error("Truncated compressed cell data");
+            }
+            m_buffer |= static_cast<std::uint64_t>(*(m_ptr++)) << m_bits;
+            m_bits += 8;
+        }
+        const std::uint64_t result = m_buffer & ((1ull << bits) - 1);
+        m_buffer >>= bits;
+        m_bits -= bits;
+        return result;
+    }
+
+    private:
+    const std::uint8_t* m_ptr;
+    const std::uint8_t* m_end;
+    std::uint64_t m_buffer = 0;
+    unsigned int m_bits = 0;
+};
+
+/// Append raw scalar values to a buffer
+inline void write_scalar(std::vector<char>& out, traccc::scalar value) {
+    const std::size_t offset = out.size();
+    out.resize(offset + sizeof(traccc::scalar));
+    std::memcpy(out.data() + offset, &value, sizeof(traccc::scalar));
+}
+
+}  // namespace
+
+namespace traccc::io {
+
+std::vector<char> compress_cells(const cell_container_types::const_view& cells,
+                                 const cell_compression_config& config) {
+
+    if (config.activation_bits > 32) {
+        throw std::invalid_argument(
+            "Activations can be quantized to at most 32 bits");
+    }
+    const cell_container_types::const_device device{cells};
+
+    // Set up the header.
+    compression_header header;
+    std::memcpy(header.magic, compression_magic, sizeof(compression_magic));
+    header.version = compression_version;
+    header.activation_bits =
+        static_cast<std::uint8_t>(config.activation_bits);
+    header.flags = constant_time_flag;
+    header.scalar_size = sizeof(scalar);
+    header.padding = 0;
+    header.n_modules = device.size();
+    header.n_cells = 0;
+    header.varint_size = 0;
+    header.activation_min = 0.;
+    header.activation_step = 1.;
+    header.time = 0.;
+
+    // Collect the ranges of the activations and times.
+    scalar min_activation = std::numeric_limits<scalar>::max();
+    scalar max_activation = std::numeric_limits<scalar>::lowest();
+    bool first_cell = true;
+    for (std::size_t i = 0; i < device.size(); ++i) {
+        for (const cell& c : device.get_items()[i]) {
+            min_activation = std::min(min_activation, c.activation);
+            max_activation = std::max(max_activation, c.activation);
+            if (first_cell) {
+                header.time = c.time;
+                first_cell = false;
+            } else if (c.time != header.time) {
+                header.flags &= static_cast<std::uint8_t>(~constant_time_flag);
+            }
+            ++header.n_cells;
+        }
+    }
+    if ((config.activation_bits > 0) && (header.n_cells > 0)) {
+        const double levels =
+            static_cast<double>((1ull << config.activation_bits) - 1);
+        header.activation_min = min_activation;
+        header.activation_step =
+            (max_activation > min_activation)
+                ? (static_cast<double>(max_activation) - min_activation) /
+                      levels
+                : 1.;
+    }
+
+    // Encode the modules and the channels of their cells.
+    std::vector<char> varints;
+    varints.reserve(header.n_modules * 4 + header.n_cells * 2);
+    geometry_id previous_module = 0;
+    for (std::size_t i = 0; i < device.size(); ++i) {
+        const geometry_id module = device.get_headers()[i].module;
+        write_varint(varints, zigzag_encode(static_cast<std::int64_t>(
+                                  module - previous_module)));
+        previous_module = module;
+        const auto items = device.get_items()[i];
+        write_varint(varints, items.size());
+        std::int64_t channel0 = 0, channel1 = 0;
+        for (const cell& c : items) {
+            write_varint(varints, zigzag_encode(c.channel0 - channel0));
+            write_varint(varints, zigzag_encode(c.channel1 - channel1));
+            channel0 = c.channel0;
+            channel1 = c.channel1;
+        }
+    }
+    header.varint_size = varints.size();
+
+    // Put together the full payload.
+    std::vector<char> result(sizeof(header));
+    result.reserve(sizeof(header) + varints.size() +
+                   header.n_cells * 2 * sizeof(scalar));
+    std::memcpy(result.data(), &header, sizeof(header));
+    result.insert(result.end(), varints.begin(), varints.end());
+
+    // Encode the activations.
+    if (config.activation_bits == 0) {
+        for (std::size_t i = 0; i < device.size(); ++i) {
+            for (const cell& c : device.get_items()[i]) {
+                write_scalar(result, c.activation);
+            }
+        }
+    } else {
+        bit_writer bits(result);
+        const std::uint64_t max_level = (1ull << config.activation_bits) - 1;
+        for (std::size_t i = 0; i < device.size(); ++i) {
+            for (const cell& c : device.get_items()[i]) {
+                const double level = std::round(
+                    (c.activation - header.activation_min) /
+                    header.activation_step);
+                bits.write(std::min(static_cast<std::uint64_t>(
+                                        std::max(level, 0.)),
+                                    max_level),
+                           config.activation_bits);
+            }
+        }
+        bits.finish();
+    }
+
+    // Encode the times, if needed.
+    if ((header.flags & constant_time_flag) == 0) {
+        for (std::size_t i = 0; i < device.size(); ++i) {
+            for (const cell& c : device.get_items()[i]) {
+                write_scalar(result, c.time);
+            }
+        }
+    }
+
+    return result;
+}
+
+cell_container_types::host decompress_cells(const char* data,
+                                            std::size_t size,
+                                            vecmem::memory_resource* mr) {
+
+    // Read and validate the header.
+    compression_header header;
+    if (size < sizeof(header)) {
+        throw std::runtime_error("Truncated compressed cell data");
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, compression_magic,
+                    sizeof(compression_magic)) != 0) {
+        throw std::runtime_error("Not compressed cell data");
+    }
+    if (header.version != compression_version) {
+        throw std::runtime_error("Unsupported compressed cell data version " +
+                                 std::to_string(header.version));
+    }
+    if ((header.activation_bits == 0) &&
+        (header.scalar_size != sizeof(scalar))) {
+        throw std::runtime_error(
+            "Losslessly compressed cell data was written with a different "
+            "scalar type");
+    }
+    const char* const end = data + size;
+    const char* ptr = data + sizeof(header);
+    if (header.varint_size > static_cast<std::size_t>(end - ptr)) {
+        throw std::runtime_error("Truncated compressed cell data");
+    }
+
+    // Decode the modules and the channels of the cells, straight into the
+    // result container.
+    cell_container_types::host result(header.n_modules, mr);
+    varint_reader varints(ptr, ptr + header.varint_size);
+    ptr += header.varint_size;
+    geometry_id module = 0;
+    std::uint64_t n_cells = 0;
+    for (std::size_t i = 0; i < header.n_modules; ++i) {
+        module += static_cast<geometry_id>(zigzag_decode(varints.read()));
+        result.get_headers()[i].module = module;
+        auto& items = result.get_items()[i];
+        items.resize(varints.read());
+        n_cells += items.size();
+        if (n_cells > header.n_cells) {
+            throw std::runtime_error("Corrupt compressed cell data");
+        }
+        std::int64_t channel0 = 0, channel1 = 0;
+        for (cell& c : items) {
+            channel0 += zigzag_decode(varints.read());
+            channel1 += zigzag_decode(varints.read());
+            c.channel0 = static_cast<channel_id>(channel0);
+            c.channel1 = static_cast<channel_id>(channel1);
+        }
+    }
+    if (n_cells != header.n_cells) {
+        throw std::runtime_error("Corrupt compressed cell data");
+    }
+
+    // Decode the activations.
+    if (header.activation_bits == 0) {
+        if (header.n_cells * sizeof(scalar) >
+            static_cast<std::size_t>(end - ptr)) {
+            throw std::runtime_error("Truncated compressed cell data");
+        }
+        for (auto& items : result.get_items()) {
+            for (cell& c : items) {
+                std::memcpy(&(c.activation), ptr, sizeof(scalar));
+                ptr += sizeof(scalar);
+            }
+        }
+    } else {
+        const std::size_t packed_size =
+            (header.n_cells * header.activation_bits + 7) / 8;
+        if (packed_size > static_cast<std::size_t>(end - ptr)) {
+            throw std::runtime_error("Truncated compressed cell data");
+        }
+        bit_reader bits(ptr, ptr + packed_size);
+        for (auto& items : result.get_items()) {
+            for (cell& c : items) {
+                c.activation = static_cast<scalar>(
+                    header.activation_min +
+                    static_cast<double>(bits.read(header.activation_bits)) *
+                        header.activation_step);
+            }
+        }
+        ptr += packed_size;
+    }
+
+    // Decode the times.
+    if ((header.flags & constant_time_flag) != 0) {
+        for (auto& items : result.get_items()) {
+            for (cell& c : items) {
+                c.time = static_cast<scalar>(header.time);
+            }
+        }
+    } else {
+        if (header.n_cells * header.scalar_size >
+            static_cast<std::size_t>(end - ptr)) {
+            throw std::runtime_error("Truncated compressed cell data");
+        }
+        if (header.scalar_size != sizeof(scalar)) {
+            throw std::runtime_error(
+                "Compressed cell times were written with a different scalar "
+                "type");
+        }
+        for (auto& items : result.get_items()) {
+            for (cell& c : items) {
+                std::memcpy(&(c.time), ptr, sizeof(scalar));
+                ptr += sizeof(scalar);
+            }
+        }
+    }
+
+    return result;
+}
+
+}  // namespace traccc::io
@@ -0,0 +1,28 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// DFE include(s).
+#include <dfe/dfe_namedtuple.hpp>
+
+namespace traccc::io::csv {
+
+/// Type to read information into about one point of a magnetic field map
+struct field_value {
+
+    /// Position of the point in [mm]
+    float x = 0., y = 0., z = 0.;
+    /// Field at the point in [T]
+    float bx = 0., by = 0., bz = 0.;
+
+    // x,y,z,bx,by,bz
+    DFE_NAMEDTUPLE(field_value, x, y, z, bx, by, bz);
+
+};  // struct field_value
+
+}  // namespace traccc::io::csv
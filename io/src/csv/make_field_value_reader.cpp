@@ -0,0 +1,19 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "make_field_value_reader.hpp"
+
+namespace traccc::io::csv {
+
+dfe::NamedTupleCsvReader<field_value> make_field_value_reader(
+    std::string_view filename) {
+
+    return {filename.data(), {"x", "y", "z", "bx", "by", "bz"}};
+}
+
+}  // namespace traccc::io::csv
@@ -0,0 +1,29 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "field_value.hpp"
+
+// DFE include(s).
+#include <dfe/dfe_io_dsv.hpp>
+
+// System include(s).
+#include <string_view>
+
+namespace traccc::io::csv {
+
+/// Set up an object for reading a CSV file containing a magnetic field map
+///
+/// @param filename The name of the file to read
+/// @return An object that can read the specified CSV file
+///
+dfe::NamedTupleCsvReader<field_value> make_field_value_reader(
+    std::string_view filename);
+
+}  // namespace traccc::io::csv
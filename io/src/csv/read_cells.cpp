@@ -118,6 +118,7 @@ cell_container_types::host read_cells(std::string_view filename,
             assert(binning_data.size() >= 2);
             module.pixel = {binning_data[0].min, binning_data[1].min,
                             binning_data[0].step, binning_data[1].step};
+            module.threshold = geo_it->threshold;
         }
     }
 
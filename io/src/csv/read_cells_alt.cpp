@@ -66,6 +66,7 @@ traccc::cell_module get_module(traccc::io::csv::cell c,
         assert(binning_data.size() >= 2);
         result.pixel = {binning_data[0].min, binning_data[1].min,
                         binning_data[0].step, binning_data[1].step};
+        result.threshold = geo_it->threshold;
     }
 
     return result;
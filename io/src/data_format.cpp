@@ -25,6 +25,9 @@ std::ostream& operator<<(std::ostream& out, data_format format) {
         case data_format::json:
             out << "json";
             break;
+        case data_format::compressed:
+            out << "compressed";
+            break;
         default:
             out << "?!?unknown?!?";
             break;
@@ -0,0 +1,272 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/detector_snapshot.hpp"
+
+#include "algebra_tag.hpp"
+#include "traccc/io/utils.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// POSIX include(s).
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+/// Identifier at the start of every snapshot file
+constexpr char snapshot_magic[8] = {'T', 'R', 'C', 'C', 'D', 'E', 'T', '\0'};
+
+/// Alignment of the payload blocks inside of the snapshot file
+constexpr std::size_t snapshot_alignment = 64;
+
+/// Header at the start of every snapshot file
+struct snapshot_header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t module_size;
+    traccc::io::details::algebra_tag algebra;
+    std::uint64_t n_modules;
+    std::uint64_t ids_offset;
+    std::uint64_t modules_offset;
+};
+
+/// Round a file offset up to the payload alignment
+std::uint64_t align_offset(std::uint64_t offset) {
+    return (offset + snapshot_alignment - 1) / snapshot_alignment *
+           snapshot_alignment;
+}
+
+}  // namespace
+
+namespace traccc::io {
+
+detector_snapshot::detector_snapshot(std::string_view filename) {
+
+    // Make sure that the chosen types work.
+    static_assert(std::is_standard_layout_v<cell_module>,
+                  "Module description type must have standard layout.");
+
+    // Construct the full file name.
+    const std::string full_filename = data_directory() + std::string(filename);
+
+    // Open the file, and get its size.
+    const int fd = ::open(full_filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Could not open detector snapshot file: " +
+                                 full_filename);
+    }
+    struct stat file_stat;
+    if (::fstat(fd, &file_stat) != 0) {
+        ::close(fd);
+        throw std::runtime_error("Could not stat detector snapshot file: " +
+                                 full_filename);
+    }
+    m_mapping_size = static_cast<std::size_t>(file_stat.st_size);
+    if (m_mapping_size < sizeof(snapshot_header)) {
+        ::close(fd);
+        throw std::runtime_error("Detector snapshot file is too small: " +
+                                 full_filename);
+    }
+
+    // Map the whole file into memory. The file descriptor is not needed
+    // after this anymore.
+    void* mapping =
+        ::mmap(nullptr, m_mapping_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        throw std::runtime_error("Could not map detector snapshot file: " +
+                                 full_filename);
+    }
+    m_mapping = mapping;
+
+    // Validate the header of the file.
+    snapshot_header header;
+    std::memcpy(&header, m_mapping, sizeof(snapshot_header));
+    if (std::memcmp(header.magic, snapshot_magic, sizeof(snapshot_magic)) !=
+        0) {
+        unmap();
+        throw std::runtime_error("Not a detector snapshot file: " +
+                                 full_filename);
+    }
+    if (header.version != format_version) {
+        unmap();
+        throw std::runtime_error(
+            "Unsupported detector snapshot version " +
+            std::to_string(header.version) + " in file: " + full_filename);
+    }
+    if ((header.module_size != sizeof(cell_module)) ||
+        (header.algebra != details::current_algebra_tag())) {
+        unmap();
+        throw std::runtime_error(
+            "Detector snapshot file was written with a different algebra "
+            "configuration: " +
+            full_filename);
+    }
+    if ((header.ids_offset + header.n_modules * sizeof(geometry_id) >
+         m_mapping_size) ||
+        (header.modules_offset + header.n_modules * sizeof(cell_module) >
+         m_mapping_size)) {
+        unmap();
+        throw std::runtime_error("Detector snapshot file is truncated: " +
+                                 full_filename);
+    }
+
+    // Set up the views into the payload.
+    const char* base = static_cast<const char*>(m_mapping);
+    m_size = header.n_modules;
+    m_ids = reinterpret_cast<const geometry_id*>(base + header.ids_offset);
+    m_modules =
+        reinterpret_cast<const cell_module*>(base + header.modules_offset);
+}
+
+detector_snapshot::~detector_snapshot() {
+
+    unmap();
+}
+
+detector_snapshot::detector_snapshot(detector_snapshot&& parent) noexcept
+    : m_mapping(parent.m_mapping),
+      m_mapping_size(parent.m_mapping_size),
+      m_size(parent.m_size),
+      m_ids(parent.m_ids),
+      m_modules(parent.m_modules) {
+
+    parent.m_mapping = nullptr;
+    parent.m_mapping_size = 0;
+    parent.m_size = 0;
+    parent.m_ids = nullptr;
+    parent.m_modules = nullptr;
+}
+
+detector_snapshot& detector_snapshot::operator=(
+    detector_snapshot&& rhs) noexcept {
+
+    if (this != &rhs) {
+        unmap();
+        std::swap(m_mapping, rhs.m_mapping);
+        std::swap(m_mapping_size, rhs.m_mapping_size);
+        std::swap(m_size, rhs.m_size);
+        std::swap(m_ids, rhs.m_ids);
+        std::swap(m_modules, rhs.m_modules);
+    }
+    return *this;
+}
+
+const cell_module* detector_snapshot::find(geometry_id module) const {
+
+    const geometry_id* end = m_ids + m_size;
+    const geometry_id* it = std::lower_bound(m_ids, end, module);
+    if ((it == end) || (*it != module)) {
+        return nullptr;
+    }
+    return m_modules + (it - m_ids);
+}
+
+const cell_module& detector_snapshot::at(geometry_id module) const {
+
+    const cell_module* result = find(module);
+    if (result == nullptr) {
+        throw std::out_of_range(
+            "Could not find geometry ID " + std::to_string(module) +
+            " in the detector snapshot");
+    }
+    return *result;
+}
+
+void detector_snapshot::unmap() {
+
+    if (m_mapping != nullptr) {
+        ::munmap(m_mapping, m_mapping_size);
+    }
+    m_mapping = nullptr;
+    m_mapping_size = 0;
+    m_size = 0;
+    m_ids = nullptr;
+    m_modules = nullptr;
+}
+
+void write_detector_snapshot(std::string_view filename,
+                             const std::map<geometry_id, transform3>& surfaces,
+                             const digitization_config& dconfig) {
+
+    // Set up the module descriptions. The std::map makes sure that they
+    // would be sorted by geometry ID.
+    std::vector<geometry_id> ids;
+    ids.reserve(surfaces.size());
+    std::vector<cell_module> modules;
+    modules.reserve(surfaces.size());
+    for (const auto& [id, placement] : surfaces) {
+
+        ids.push_back(id);
+        cell_module& module = modules.emplace_back();
+        module.module = id;
+        module.placement = placement;
+
+        // Set the pixel segmentation of the module.
+        const digitization_config::Iterator geo_it = dconfig.find(id);
+        if (geo_it == dconfig.end()) {
+            throw std::runtime_error(
+                "Could not find digitization config for geometry ID " +
+                std::to_string(id));
+        }
+        const auto& binning_data = geo_it->segmentation.binningData();
+        assert(binning_data.size() >= 2);
+        module.pixel = {binning_data[0].min, binning_data[1].min,
+                        binning_data[0].step, binning_data[1].step};
+
+        // Set the activation threshold of the module.
+        module.threshold = geo_it->threshold;
+    }
+
+    // Set up the file header.
+    snapshot_header header;
+    std::memcpy(header.magic, snapshot_magic, sizeof(snapshot_magic));
+    header.version = detector_snapshot::format_version;
+    header.module_size = sizeof(cell_module);
+    header.algebra = details::current_algebra_tag();
+    header.n_modules = ids.size();
+    header.ids_offset = align_offset(sizeof(snapshot_header));
+    header.modules_offset =
+        align_offset(header.ids_offset + ids.size() * sizeof(geometry_id));
+
+    // Open the output file. Relying on exceptions for the error handling.
+    const std::string full_filename = data_directory() + std::string(filename);
+    std::ofstream out_file(full_filename, std::ios::binary);
+    out_file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+
+    // Helper for writing zeroes up to a given file offset.
+    const auto pad_to = [&out_file](std::uint64_t offset) {
+        static const char zeroes[snapshot_alignment] = {};
+        const std::uint64_t pos = static_cast<std::uint64_t>(out_file.tellp());
+        assert(pos <= offset);
+        out_file.write(zeroes, static_cast<std::streamsize>(offset - pos));
+    };
+
+    // Write the header and the payload blocks.
+    out_file.write(reinterpret_cast<const char*>(&header),
+                   sizeof(snapshot_header));
+    pad_to(header.ids_offset);
+    out_file.write(reinterpret_cast<const char*>(ids.data()),
+                   ids.size() * sizeof(geometry_id));
+    pad_to(header.modules_offset);
+    out_file.write(reinterpret_cast<const char*>(modules.data()),
+                   modules.size() * sizeof(cell_module));
+}
+
+}  // namespace traccc::io
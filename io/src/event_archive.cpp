@@ -0,0 +1,386 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/event_archive.hpp"
+
+#include "algebra_tag.hpp"
+#include "read_binary.hpp"
+#include "traccc/io/utils.hpp"
+#include "write_binary.hpp"
+
+// System include(s).
+#include <cerrno>
+#include <cstring>
+#include <istream>
+#include <stdexcept>
+#include <streambuf>
+#include <utility>
+
+// POSIX include(s).
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+/// Identifier at the start and at the end of every archive file
+constexpr char archive_magic[8] = {'T', 'R', 'C', 'C', 'E', 'V', 'T', 'A'};
+
+/// Header at the start of every archive file
+struct archive_header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t module_size;
+    std::uint32_t cell_size;
+    std::uint32_t spacepoint_size;
+    std::uint32_t measurement_size;
+    std::uint32_t track_parameters_size;
+    std::uint32_t track_candidate_size;
+    std::uint32_t padding;
+    traccc::io::details::algebra_tag algebra;
+};
+
+/// Footer at the end of every archive file
+struct archive_footer {
+    std::uint64_t index_offset;
+    std::uint64_t n_events;
+    char magic[8];
+};
+
+/// Input stream buffer reading from a block of memory, without copying it
+class memory_buffer : public std::streambuf {
+    public:
+    memory_buffer(char* data, std::size_t size) {
+        setg(data, data, data + size);
+    }
+};
+
+/// Decode a container from a block of memory read from the archive
+template <typename container_t>
+container_t decode(std::vector<char>& block, vecmem::memory_resource* mr) {
+
+    memory_buffer buffer(block.data(), block.size());
+    std::istream in(&buffer);
+    container_t result =
+        traccc::io::details::read_binary_container<container_t>(in, mr);
+    if (!in) {
+        throw std::runtime_error("Corrupt block in event archive");
+    }
+    return result;
+}
+
+/// Read a block of a file at a given offset
+void pread_all(int fd, void* data, std::size_t size, std::uint64_t offset,
+               const std::string& filename) {
+
+    char* ptr = static_cast<char*>(data);
+    while (size > 0) {
+        const ssize_t n = ::pread(fd, ptr, size, static_cast<off_t>(offset));
+        if (n <= 0) {
+            if ((n < 0) && (errno == EINTR)) {
+                continue;
+            }
+            throw std::runtime_error("Could not read from event archive: " +
+                                     filename);
+        }
+        ptr += n;
+        size -= static_cast<std::size_t>(n);
+        offset += static_cast<std::uint64_t>(n);
+    }
+}
+
+}  // namespace
+
+namespace traccc::io {
+
+event_archive::event_archive(std::string_view filename)
+    : m_filename(data_directory() + filename.data()) {
+
+    // Open the file, and get its size.
+    m_fd = ::open(m_filename.c_str(), O_RDONLY);
+    if (m_fd < 0) {
+        throw std::runtime_error("Could not open event archive: " +
+                                 m_filename);
+    }
+    struct stat file_stat;
+    if (::fstat(m_fd, &file_stat) != 0) {
+        ::close(m_fd);
+        throw std::runtime_error("Could not stat event archive: " +
+                                 m_filename);
+    }
+    const std::uint64_t file_size =
+        static_cast<std::uint64_t>(file_stat.st_size);
+
+    try {
+        if (file_size < sizeof(archive_header) + sizeof(archive_footer)) {
+            throw std::runtime_error("Event archive is too small: " +
+                                     m_filename);
+        }
+
+        // Validate the header of the file.
+        archive_header header;
+        pread_all(m_fd, &header, sizeof(header), 0, m_filename);
+        if (std::memcmp(header.magic, archive_magic, sizeof(archive_magic)) !=
+            0) {
+            throw std::runtime_error("Not an event archive: " + m_filename);
+        }
+        if (header.version != format_version) {
+            throw std::runtime_error(
+                "Unsupported event archive version " +
+                std::to_string(header.version) + " in file: " + m_filename);
+        }
+        if ((header.module_size != sizeof(cell_module)) ||
+            (header.cell_size != sizeof(cell)) ||
+            (header.spacepoint_size != sizeof(spacepoint)) ||
+            (header.measurement_size != sizeof(measurement)) ||
+            (header.track_parameters_size != sizeof(bound_track_parameters)) ||
+            (header.track_candidate_size != sizeof(track_candidate)) ||
+            (header.algebra != details::current_algebra_tag())) {
+            throw std::runtime_error(
+                "Event archive was written with a different algebra "
+                "configuration: " +
+                m_filename);
+        }
+
+        // Read the footer and the index.
+        archive_footer footer;
+        pread_all(m_fd, &footer, sizeof(footer),
+                  file_size - sizeof(archive_footer), m_filename);
+        if ((std::memcmp(footer.magic, archive_magic, sizeof(archive_magic)) !=
+             0) ||
+            (footer.index_offset +
+                 footer.n_events * sizeof(event_archive_entry) !=
+             file_size - sizeof(archive_footer))) {
+            throw std::runtime_error(
+                "Event archive is truncated, or was not closed: " +
+                m_filename);
+        }
+        m_index.resize(footer.n_events);
+        pread_all(m_fd, m_index.data(),
+                  m_index.size() * sizeof(event_archive_entry),
+                  footer.index_offset, m_filename);
+
+        // Make sure that all blocks are inside of the file.
+        for (const event_archive_entry& e : m_index) {
+            if ((e.cells_offset + e.cells_size > footer.index_offset) ||
+                (e.spacepoints_offset + e.spacepoints_size >
+                 footer.index_offset) ||
+                (e.measurements_offset + e.measurements_size >
+                 footer.index_offset) ||
+                (e.track_candidates_offset + e.track_candidates_size >
+                 footer.index_offset)) {
+                throw std::runtime_error("Corrupt index in event archive: " +
+                                         m_filename);
+            }
+        }
+    } catch (...) {
+        ::close(m_fd);
+        throw;
+    }
+}
+
+event_archive::~event_archive() {
+
+    if (m_fd >= 0) {
+        ::close(m_fd);
+    }
+}
+
+event_archive::event_archive(event_archive&& parent) noexcept
+    : m_filename(std::move(parent.m_filename)),
+      m_fd(parent.m_fd),
+      m_index(std::move(parent.m_index)) {
+
+    parent.m_fd = -1;
+}
+
+event_archive& event_archive::operator=(event_archive&& rhs) noexcept {
+
+    if (this != &rhs) {
+        std::swap(m_filename, rhs.m_filename);
+        std::swap(m_fd, rhs.m_fd);
+        std::swap(m_index, rhs.m_index);
+    }
+    return *this;
+}
+
+cell_container_types::host event_archive::read_cells(
+    std::size_t index, vecmem::memory_resource* mr) const {
+
+    const event_archive_entry& e = entry(index);
+    if (e.cells_size == 0) {
+        throw std::runtime_error("No cells were archived for event " +
+                                 std::to_string(e.event));
+    }
+    std::vector<char> block = read_block(e.cells_offset, e.cells_size);
+    return decode<cell_container_types::host>(block, mr);
+}
+
+alt_cell_reader_output_t event_archive::read_cells_alt(
+    std::size_t index, vecmem::memory_resource* mr) const {
+
+    // Read the cells in the "regular" format.
+    const cell_container_types::host cells = read_cells(index, mr);
+
+    // Flatten them into the "alt" format.
+    cell_module_collection_types::host modules(0, mr);
+    modules.assign(cells.get_headers().begin(), cells.get_headers().end());
+    alt_cell_collection_types::host alt_cells(0, mr);
+    alt_cells.reserve(cells.total_size());
+    for (std::size_t i = 0; i < cells.size(); ++i) {
+        for (const cell& c : cells.get_items()[i]) {
+            alt_cells.push_back({c, static_cast<alt_cell::link_type>(i)});
+        }
+    }
+    return {std::move(alt_cells), std::move(modules)};
+}
+
+spacepoint_container_types::host event_archive::read_spacepoints(
+    std::size_t index, vecmem::memory_resource* mr) const {
+
+    const event_archive_entry& e = entry(index);
+    if (e.spacepoints_size == 0) {
+        throw std::runtime_error("No spacepoints were archived for event " +
+                                 std::to_string(e.event));
+    }
+    std::vector<char> block =
+        read_block(e.spacepoints_offset, e.spacepoints_size);
+    return decode<spacepoint_container_types::host>(block, mr);
+}
+
+measurement_container_types::host event_archive::read_measurements(
+    std::size_t index, vecmem::memory_resource* mr) const {
+
+    const event_archive_entry& e = entry(index);
+    if (e.measurements_size == 0) {
+        throw std::runtime_error("No measurements were archived for event " +
+                                 std::to_string(e.event));
+    }
+    std::vector<char> block =
+        read_block(e.measurements_offset, e.measurements_size);
+    return decode<measurement_container_types::host>(block, mr);
+}
+
+track_candidate_container_types::host event_archive::read_track_candidates(
+    std::size_t index, vecmem::memory_resource* mr) const {
+
+    const event_archive_entry& e = entry(index);
+    if (e.track_candidates_size == 0) {
+        throw std::runtime_error(
+            "No track candidates were archived for event " +
+            std::to_string(e.event));
+    }
+    std::vector<char> block =
+        read_block(e.track_candidates_offset, e.track_candidates_size);
+    return decode<track_candidate_container_types::host>(block, mr);
+}
+
+std::vector<char> event_archive::read_block(std::uint64_t offset,
+                                            std::uint64_t size) const {
+
+    std::vector<char> result(size);
+    pread_all(m_fd, result.data(), result.size(), offset, m_filename);
+    return result;
+}
+
+event_archive_writer::event_archive_writer(std::string_view filename) {
+
+    // Open the output file. Relying on exceptions for the error handling.
+    const std::string full_filename = data_directory() + filename.data();
+    m_file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    m_file.open(full_filename, std::ios::binary);
+
+    // Write the file header.
+    archive_header header;
+    std::memcpy(header.magic, archive_magic, sizeof(archive_magic));
+    header.version = event_archive::format_version;
+    header.module_size = sizeof(cell_module);
+    header.cell_size = sizeof(cell);
+    header.spacepoint_size = sizeof(spacepoint);
+    header.measurement_size = sizeof(measurement);
+    header.track_parameters_size = sizeof(bound_track_parameters);
+    header.track_candidate_size = sizeof(track_candidate);
+    header.padding = 0;
+    header.algebra = details::current_algebra_tag();
+    m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+}
+
+event_archive_writer::~event_archive_writer() {
+
+    // Write the index, if it was not written yet. Errors can not be
+    // reported from a destructor.
+    try {
+        close();
+    } catch (const std::exception&) {
+    }
+}
+
+void event_archive_writer::add(
+    std::size_t event, const cell_container_types::host& cells,
+    const spacepoint_container_types::host* spacepoints,
+    const measurement_container_types::host* measurements) {
+
+    if (!m_file.is_open()) {
+        throw std::logic_error("Event archive was already closed");
+    }
+
+    // Helper writing one container, and recording its location.
+    const auto write_block = [this](const auto& container,
+                                    std::uint64_t& offset,
+                                    std::uint64_t& size) {
+        offset = static_cast<std::uint64_t>(m_file.tellp());
+        details::write_binary_container(m_file, container);
+        size = static_cast<std::uint64_t>(m_file.tellp()) - offset;
+    };
+
+    event_archive_entry& e = m_index.emplace_back();
+    e.event = event;
+    write_block(cells, e.cells_offset, e.cells_size);
+    if (spacepoints != nullptr) {
+        write_block(*spacepoints, e.spacepoints_offset, e.spacepoints_size);
+    }
+    if (measurements != nullptr) {
+        write_block(*measurements, e.measurements_offset,
+                    e.measurements_size);
+    }
+}
+
+void event_archive_writer::add(
+    std::size_t event,
+    const track_candidate_container_types::host& track_candidates) {
+
+    if (!m_file.is_open()) {
+        throw std::logic_error("Event archive was already closed");
+    }
+
+    event_archive_entry& e = m_index.emplace_back();
+    e.event = event;
+    e.track_candidates_offset = static_cast<std::uint64_t>(m_file.tellp());
+    details::write_binary_container(m_file, track_candidates);
+    e.track_candidates_size = static_cast<std::uint64_t>(m_file.tellp()) -
+                              e.track_candidates_offset;
+}
+
+void event_archive_writer::close() {
+
+    if (!m_file.is_open()) {
+        return;
+    }
+
+    // Write the index and the footer.
+    archive_footer footer;
+    footer.index_offset = static_cast<std::uint64_t>(m_file.tellp());
+    footer.n_events = m_index.size();
+    std::memcpy(footer.magic, archive_magic, sizeof(archive_magic));
+    m_file.write(reinterpret_cast<const char*>(m_index.data()),
+                 m_index.size() * sizeof(event_archive_entry));
+    m_file.write(reinterpret_cast<const char*>(&footer), sizeof(footer));
+    m_file.close();
+}
+
+}  // namespace traccc::io
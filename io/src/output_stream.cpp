@@ -0,0 +1,220 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/output_stream.hpp"
+
+// System include(s).
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace traccc::io {
+
+// Make sure that the written types can be written as raw memory.
+static_assert(std::is_standard_layout_v<seed>,
+              "Seed type must have standard layout.");
+static_assert(std::is_standard_layout_v<bound_track_parameters>,
+              "Track parameter type must have standard layout.");
+static_assert(std::is_standard_layout_v<
+                  track_state_container_types::host::header_type>,
+              "Fitter info type must have standard layout.");
+static_assert(
+    std::is_standard_layout_v<track_state_container_types::host::item_type>,
+    "Track state type must have standard layout.");
+
+output_stream::output_stream(std::string_view filename,
+                             std::size_t buffer_size)
+    : m_file(std::string(filename), std::ios::binary | std::ios::app),
+      m_buffer_size(buffer_size) {
+
+    if (!m_file) {
+        throw std::runtime_error("Could not open output file " +
+                                 std::string(filename));
+    }
+    m_active.reserve(m_buffer_size);
+    m_writing.reserve(m_buffer_size);
+    m_writer = std::thread([this]() { write_loop(); });
+}
+
+output_stream::~output_stream() {
+
+    // Write out everything that is still in memory, ignoring any errors.
+    // There is no way to report them from a destructor.
+    try {
+        flush();
+    } catch (const std::exception&) {
+    }
+
+    // Stop the writer thread.
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    m_writer.join();
+}
+
+void output_stream::write(std::size_t event,
+                          const seed_collection_types::host& seeds) {
+
+    output_record_header header;
+    header.type = output_record_type::seeds;
+    header.event = event;
+    header.n_items = seeds.size();
+    header.item_size = sizeof(seed);
+    append(header, {{seeds.data(), seeds.size() * sizeof(seed)}});
+}
+
+void output_stream::write(
+    std::size_t event,
+    const bound_track_parameters_collection_types::host& params) {
+
+    output_record_header header;
+    header.type = output_record_type::track_parameters;
+    header.event = event;
+    header.n_items = params.size();
+    header.item_size = sizeof(bound_track_parameters);
+    append(header,
+           {{params.data(), params.size() * sizeof(bound_track_parameters)}});
+}
+
+void output_stream::write(std::size_t event,
+                          const track_state_container_types::host& states) {
+
+    using header_type = track_state_container_types::host::header_type;
+    using item_type = track_state_container_types::host::item_type;
+
+    output_record_header header;
+    header.type = output_record_type::track_states;
+    header.event = event;
+    header.n_items = states.size();
+    header.item_size = sizeof(item_type);
+
+    // Collect the number of states on each track.
+    std::vector<std::uint64_t> item_sizes;
+    item_sizes.reserve(states.size());
+    for (const auto& track : states.get_items()) {
+        item_sizes.push_back(track.size());
+    }
+
+    // Collect the memory blocks making up the record.
+    std::vector<chunk> chunks;
+    chunks.reserve(states.size() + 2);
+    chunks.emplace_back(item_sizes.data(),
+                        item_sizes.size() * sizeof(std::uint64_t));
+    chunks.emplace_back(states.get_headers().data(),
+                        states.size() * sizeof(header_type));
+    for (const auto& track : states.get_items()) {
+        chunks.emplace_back(track.data(), track.size() * sizeof(item_type));
+    }
+    append(header, chunks);
+}
+
+void output_stream::flush() {
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (!m_active.empty()) {
+        swap_buffers(lock);
+    }
+    m_cv.wait(lock, [this]() { return !m_pending; });
+    check_error();
+    m_file.flush();
+}
+
+std::size_t output_stream::bytes_written() const {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_bytes;
+}
+
+void output_stream::append(const output_record_header& header,
+                           const std::vector<chunk>& chunks) {
+
+    // Calculate the full size of the record.
+    output_record_header full_header = header;
+    full_header.size = 0;
+    for (const chunk& c : chunks) {
+        full_header.size += c.second;
+    }
+    const std::size_t record_size = sizeof(full_header) + full_header.size;
+
+    // Make room for the record in the active buffer, if needed. Records
+    // larger than the buffer are written out in one go.
+    std::unique_lock<std::mutex> lock(m_mutex);
+    check_error();
+    if (!m_active.empty() &&
+        (m_active.size() + record_size > m_buffer_size)) {
+        swap_buffers(lock);
+    }
+
+    // Copy the record into the buffer.
+    std::size_t offset = m_active.size();
+    m_active.resize(offset + record_size);
+    std::memcpy(m_active.data() + offset, &full_header, sizeof(full_header));
+    offset += sizeof(full_header);
+    for (const chunk& c : chunks) {
+        if (c.second > 0) {
+            std::memcpy(m_active.data() + offset, c.first, c.second);
+        }
+        offset += c.second;
+    }
+    m_bytes += record_size;
+
+    // Hand the buffer over right away if it is full.
+    if (m_active.size() >= m_buffer_size) {
+        swap_buffers(lock);
+    }
+}
+
+void output_stream::swap_buffers(std::unique_lock<std::mutex>& lock) {
+
+    // Wait for the writer thread to finish with the previous buffer.
+    m_cv.wait(lock, [this]() { return !m_pending; });
+    check_error();
+
+    // Give it the active buffer.
+    m_active.swap(m_writing);
+    m_pending = true;
+    m_cv.notify_all();
+}
+
+void output_stream::check_error() const {
+
+    if (m_failed) {
+        throw std::runtime_error("Failed to write to the output stream");
+    }
+}
+
+void output_stream::write_loop() {
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+
+        // Wait for something to do.
+        m_cv.wait(lock, [this]() { return m_pending || m_stop; });
+        if (!m_pending) {
+            return;
+        }
+
+        // Write out the buffer, without blocking the producers.
+        lock.unlock();
+        m_file.write(m_writing.data(),
+                     static_cast<std::streamsize>(m_writing.size()));
+        const bool failed = !m_file;
+        m_writing.clear();
+        lock.lock();
+
+        // Signal that the buffer can be reused.
+        m_failed = m_failed || failed;
+        m_pending = false;
+        m_cv.notify_all();
+    }
+}
+
+}  // namespace traccc::io
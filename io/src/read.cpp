@@ -8,15 +8,47 @@
 // Local include(s).
 #include "traccc/io/read.hpp"
 
+#include "traccc/io/batch_reader.hpp"
+#include "traccc/io/detector_snapshot.hpp"
 #include "traccc/io/read_cells.hpp"
 #include "traccc/io/read_digitization_config.hpp"
 #include "traccc/io/read_geometry.hpp"
 
+// System include(s).
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 // OpenMP include(s).
 #ifdef _OPENMP
 #include <omp.h>
 #endif
 
+namespace {
+
+/// Check whether files of a given format can be read with batched I/O
+bool use_batch_reader(traccc::data_format format) {
+
+    return ((format == traccc::data_format::binary) ||
+            (format == traccc::data_format::compressed));
+}
+
+/// Get the names of the cell files of all events
+std::vector<std::string> cells_filenames(std::size_t events,
+                                         std::string_view directory,
+                                         traccc::data_format format) {
+
+    std::vector<std::string> result;
+    result.reserve(events);
+    for (std::size_t event = 0; event < events; ++event) {
+        result.push_back(
+            traccc::io::get_cells_filename(event, directory, format));
+    }
+    return result;
+}
+
+}  // namespace
+
 namespace traccc::io {
 
 demonstrator_input read(std::size_t events, std::string_view directory,
@@ -32,6 +64,18 @@ demonstrator_input read(std::size_t events, std::string_view directory,
     // Construct the result object.
     demonstrator_input result{events, mr};
 
+    // Read the binary files with batched I/O, decoding each event on a pool
+    // of threads as soon as its file arrived.
+    if (use_batch_reader(format)) {
+        const batch_reader reader;
+        reader.read(cells_filenames(events, directory, format),
+                    [&](std::size_t event, const char *data, std::size_t size) {
+                        result[event] = io::read_cells(data, size, format,
+                                                       &geom, &digi_cfg, mr);
+                    });
+        return result;
+    }
+
     // Read in the cell data for all events. In parallel if possible.
 #pragma omp parallel for
     for (std::size_t event = 0; event < events; ++event) {
@@ -43,4 +87,81 @@ demonstrator_input read(std::size_t events, std::string_view directory,
     return result;
 }
 
+demonstrator_input read(std::size_t events, std::string_view directory,
+                        std::string_view detector_snapshot_file,
+                        data_format format, vecmem::memory_resource *mr) {
+
+    // Map the detector description into memory.
+    const detector_snapshot detector{detector_snapshot_file};
+
+    // Construct the result object.
+    demonstrator_input result{events, mr};
+
+    // Read the binary files with batched I/O, decoding each event on a pool
+    // of threads as soon as its file arrived.
+    if (use_batch_reader(format)) {
+        const batch_reader reader;
+        reader.read(cells_filenames(events, directory, format),
+                    [&](std::size_t event, const char *data, std::size_t size) {
+                        result[event] =
+                            io::read_cells(data, size, detector, format, mr);
+                    });
+        return result;
+    }
+
+    // Read in the cell data for all events. In parallel if possible.
+#pragma omp parallel for
+    for (std::size_t event = 0; event < events; ++event) {
+        result[event] = io::read_cells(event, directory, detector, format, mr);
+    }
+
+    // Return the container.
+    return result;
+}
+
+demonstrator_input read(std::size_t events, const event_archive &archive,
+                        vecmem::memory_resource *mr) {
+
+    // Make sure that the archive has enough events.
+    if (events > archive.size()) {
+        throw std::invalid_argument(
+            "Requested " + std::to_string(events) +
+            " events from an archive of " + std::to_string(archive.size()));
+    }
+
+    // Construct the result object.
+    demonstrator_input result{events, mr};
+
+    // Read in the cell data for all events. In parallel if possible.
+#pragma omp parallel for
+    for (std::size_t event = 0; event < events; ++event) {
+        result[event] = archive.read_cells(event, mr);
+    }
+
+    // Return the container.
+    return result;
+}
+
+alt_demonstrator_input read_alt(std::size_t events,
+                                const event_archive &archive,
+                                vecmem::memory_resource *mr) {
+
+    // Make sure that the archive has enough events.
+    if (events > archive.size()) {
+        throw std::invalid_argument(
+            "Requested " + std::to_string(events) +
+            " events from an archive of " + std::to_string(archive.size()));
+    }
+
+    // Read in the cell data for all events.
+    alt_demonstrator_input result;
+    result.reserve(events);
+    for (std::size_t event = 0; event < events; ++event) {
+        result.push_back(archive.read_cells_alt(event, mr));
+    }
+
+    // Return the container.
+    return result;
+}
+
 }  // namespace traccc::io
@@ -12,20 +12,23 @@
 
 // System include(s).
 #include <cstddef>
+#include <cstring>
 #include <fstream>
+#include <istream>
+#include <stdexcept>
 #include <string_view>
 #include <type_traits>
 #include <vector>
 
 namespace traccc::io::details {
 
-/// Function for reading a container from a binary file
+/// Function for reading a container from a binary stream
 ///
-/// @param filename The full input filename
+/// @param in_file The stream to read the container from
 /// @param mr Is the memory resource to create the result container with
 ///
 template <typename container_t>
-container_t read_binary_container(std::string_view filename,
+container_t read_binary_container(std::istream& in_file,
                                   vecmem::memory_resource* mr = nullptr) {
 
     // Make sure that the chosen types work.
@@ -34,9 +37,6 @@ container_t read_binary_container(std::string_view filename,
     static_assert(std::is_standard_layout_v<typename container_t::item_type>,
                   "Container item type must be standard layout.");
 
-    // Open the input file.
-    std::ifstream in_file(filename.data(), std::ios::binary);
-
     // Read the size of the header vector.
     std::size_t headers_size;
     in_file.read(reinterpret_cast<char*>(&headers_size), sizeof(std::size_t));
@@ -66,4 +66,85 @@ container_t read_binary_container(std::string_view filename,
     return result;
 }
 
+/// Function for reading a container from a binary file
+///
+/// @param filename The full input filename
+/// @param mr Is the memory resource to create the result container with
+///
+template <typename container_t>
+container_t read_binary_container(std::string_view filename,
+                                  vecmem::memory_resource* mr = nullptr) {
+
+    // Open the input file.
+    std::ifstream in_file(filename.data(), std::ios::binary);
+
+    // Read the container from it.
+    return read_binary_container<container_t>(in_file, mr);
+}
+
+/// Function for reading a container from a memory buffer
+///
+/// The buffer is expected to hold the same bytes as a file written by
+/// @c traccc::io::details::write_binary_container.
+///
+/// @param data The beginning of the buffer
+/// @param size The size of the buffer in bytes
+/// @param mr Is the memory resource to create the result container with
+///
+template <typename container_t>
+container_t read_binary_container(const char* data, std::size_t size,
+                                  vecmem::memory_resource* mr = nullptr) {
+
+    // Make sure that the chosen types work.
+    static_assert(std::is_standard_layout_v<typename container_t::header_type>,
+                  "Container header type must be standard layout.");
+    static_assert(std::is_standard_layout_v<typename container_t::item_type>,
+                  "Container item type must be standard layout.");
+
+    // Helper function copying the next bytes from the buffer.
+    std::size_t offset = 0;
+    auto copy = [&](void* ptr, std::size_t bytes) {
+        if (bytes > size - offset) {
+            throw std::runtime_error("Truncated binary container");
+        }
+        if (bytes > 0) {
+            std::memcpy(ptr, data + offset, bytes);
+        }
+        offset += bytes;
+    };
+
+    // Read the size of the header vector.
+    std::size_t headers_size = 0;
+    copy(&headers_size, sizeof(std::size_t));
+    if (headers_size > (size - offset) / sizeof(std::size_t)) {
+        throw std::runtime_error("Truncated binary container");
+    }
+
+    // Read the sizes of the item vector.
+    std::vector<std::size_t> items_size(headers_size);
+    copy(items_size.data(), headers_size * sizeof(std::size_t));
+
+    // Create the result container, and set it to the correct (outer) size right
+    // away.
+    container_t result(headers_size, mr);
+
+    // Read the header payload into memory.
+    copy(result.get_headers().data(),
+         headers_size * sizeof(typename container_t::header_type));
+
+    // Read the items in multiple steps.
+    for (std::size_t i = 0; i < headers_size; ++i) {
+        if (items_size.at(i) >
+            (size - offset) / sizeof(typename container_t::item_type)) {
+            throw std::runtime_error("Truncated binary container");
+        }
+        result.get_items().at(i).resize(items_size.at(i));
+        copy(result.get_items().at(i).data(),
+             items_size.at(i) * sizeof(typename container_t::item_type));
+    }
+
+    // Return the newly created container.
+    return result;
+}
+
 }  // namespace traccc::io::details
@@ -10,30 +10,122 @@
 
 #include "csv/read_cells.hpp"
 #include "read_binary.hpp"
+#include "traccc/io/cell_compression.hpp"
 #include "traccc/io/utils.hpp"
 
+// System include(s).
+#include <cassert>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+/// Set up the module descriptions of cells read without them
+void set_modules(traccc::cell_container_types::host& cells,
+                 const traccc::geometry* geom,
+                 const traccc::digitization_config* dconfig) {
+
+    for (traccc::cell_module& module : cells.get_headers()) {
+
+        // Find/set the 3D position of the detector module.
+        if (geom != nullptr) {
+            if (!geom->contains(module.module)) {
+                throw std::runtime_error(
+                    "Could not find placement for geometry ID " +
+                    std::to_string(module.module));
+            }
+            module.placement = (*geom)[module.module];
+        }
+
+        // Find/set the digitization configuration of the detector module.
+        if (dconfig != nullptr) {
+            const traccc::digitization_config::Iterator geo_it =
+                dconfig->find(module.module);
+            if (geo_it == dconfig->end()) {
+                throw std::runtime_error(
+                    "Could not find digitization config for geometry ID " +
+                    std::to_string(module.module));
+            }
+            const auto& binning_data = geo_it->segmentation.binningData();
+            assert(binning_data.size() >= 2);
+            module.pixel = {binning_data[0].min, binning_data[1].min,
+                            binning_data[0].step, binning_data[1].step};
+            module.threshold = geo_it->threshold;
+        }
+    }
+}
+
+/// Set up the module descriptions of cells from a detector snapshot
+void set_modules(traccc::cell_container_types::host& cells,
+                 const traccc::io::detector_snapshot& detector) {
+
+    for (traccc::cell_module& module : cells.get_headers()) {
+        const traccc::cell_module* desc = detector.find(module.module);
+        if (desc == nullptr) {
+            throw std::runtime_error(
+                "Could not find module description for geometry ID " +
+                std::to_string(module.module));
+        }
+        module = *desc;
+    }
+}
+
+/// Read a compressed cell file, and set up its module descriptions
+traccc::cell_container_types::host read_compressed_cells(
+    std::string_view filename, const traccc::geometry* geom,
+    const traccc::digitization_config* dconfig,
+    vecmem::memory_resource* mr) {
+
+    // Read the whole file into memory.
+    std::ifstream in_file(std::string(filename), std::ios::binary);
+    if (!in_file) {
+        throw std::runtime_error("Could not open compressed cell file: " +
+                                 std::string(filename));
+    }
+    const std::vector<char> data{std::istreambuf_iterator<char>(in_file),
+                                 std::istreambuf_iterator<char>()};
+
+    // Decode the cells.
+    return traccc::io::read_cells(data.data(), data.size(),
+                                  traccc::data_format::compressed, geom,
+                                  dconfig, mr);
+}
+
+}  // namespace
+
 namespace traccc::io {
 
-cell_container_types::host read_cells(std::size_t event,
-                                      std::string_view directory,
-                                      data_format format, const geometry* geom,
-                                      const digitization_config* dconfig,
-                                      vecmem::memory_resource* mr) {
+std::string get_cells_filename(std::size_t event, std::string_view directory,
+                               data_format format) {
 
     switch (format) {
         case data_format::csv:
-            return read_cells(data_directory() + directory.data() +
-                                  get_event_filename(event, "-cells.csv"),
-                              format, geom, dconfig, mr);
+            return data_directory() + directory.data() +
+                   get_event_filename(event, "-cells.csv");
         case data_format::binary:
-            return read_cells(data_directory() + directory.data() +
-                                  get_event_filename(event, "-cells.dat"),
-                              format, geom, dconfig, mr);
+            return data_directory() + directory.data() +
+                   get_event_filename(event, "-cells.dat");
+        case data_format::compressed:
+            return data_directory() + directory.data() +
+                   get_event_filename(event, "-cells.cdat");
         default:
             throw std::invalid_argument("Unsupported data format");
     }
 }
 
+cell_container_types::host read_cells(std::size_t event,
+                                      std::string_view directory,
+                                      data_format format, const geometry* geom,
+                                      const digitization_config* dconfig,
+                                      vecmem::memory_resource* mr) {
+
+    return read_cells(get_cells_filename(event, directory, format), format,
+                      geom, dconfig, mr);
+}
+
 cell_container_types::host read_cells(std::string_view filename,
                                       data_format format, const geometry* geom,
                                       const digitization_config* dconfig,
@@ -45,9 +137,66 @@ cell_container_types::host read_cells(std::string_view filename,
         case data_format::binary:
             return details::read_binary_container<cell_container_types::host>(
                 filename, mr);
+        case data_format::compressed:
+            return read_compressed_cells(filename, geom, dconfig, mr);
         default:
             throw std::invalid_argument("Unsupported data format");
     }
 }
 
+cell_container_types::host read_cells(std::size_t event,
+                                      std::string_view directory,
+                                      const detector_snapshot& detector,
+                                      data_format format,
+                                      vecmem::memory_resource* mr) {
+
+    // Read the cells without any geometry information.
+    cell_container_types::host result =
+        read_cells(event, directory, format, nullptr, nullptr, mr);
+
+    // Set up the module descriptions from the snapshot.
+    set_modules(result, detector);
+
+    // Return the prepared object.
+    return result;
+}
+
+cell_container_types::host read_cells(const char* data, std::size_t size,
+                                      data_format format, const geometry* geom,
+                                      const digitization_config* dconfig,
+                                      vecmem::memory_resource* mr) {
+
+    switch (format) {
+        case data_format::binary:
+            return details::read_binary_container<cell_container_types::host>(
+                data, size, mr);
+        case data_format::compressed: {
+            // The module descriptions are not stored in compressed files.
+            cell_container_types::host result =
+                decompress_cells(data, size, mr);
+            set_modules(result, geom, dconfig);
+            return result;
+        }
+        default:
+            throw std::invalid_argument(
+                "Unsupported data format for reading from memory");
+    }
+}
+
+cell_container_types::host read_cells(const char* data, std::size_t size,
+                                      const detector_snapshot& detector,
+                                      data_format format,
+                                      vecmem::memory_resource* mr) {
+
+    // Read the cells without any geometry information.
+    cell_container_types::host result =
+        read_cells(data, size, format, nullptr, nullptr, mr);
+
+    // Set up the module descriptions from the snapshot.
+    set_modules(result, detector);
+
+    // Return the prepared object.
+    return result;
+}
+
 }  // namespace traccc::io
@@ -9,9 +9,41 @@
 #include "traccc/io/read_cells_alt.hpp"
 
 #include "csv/read_cells_alt.hpp"
-#include "read_binary.hpp"
+#include "traccc/io/read_cells.hpp"
 #include "traccc/io/utils.hpp"
 
+// System include(s).
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+/// Flatten the cells of a cell container into an alt_cell collection
+///
+/// The cells of every module are expected to be sorted by their second
+/// channel identifier already, as the readers of the container leave them.
+///
+/// @param cells The cells to flatten
+/// @param result The (AoS or SoA) host collection to fill
+/// @param modules The module collection to fill
+///
+template <typename cell_collection_t>
+void flatten_cells(const traccc::cell_container_types::host& cells,
+                   cell_collection_t& result,
+                   traccc::cell_module_collection_types::host& modules) {
+
+    modules.assign(cells.get_headers().begin(), cells.get_headers().end());
+    result.reserve(cells.total_size());
+    for (std::size_t i = 0; i < cells.size(); ++i) {
+        for (const traccc::cell& c : cells.get_items()[i]) {
+            result.push_back(
+                {c, static_cast<traccc::alt_cell::link_type>(i)});
+        }
+    }
+}
+
+}  // namespace
+
 namespace traccc::io {
 
 alt_cell_reader_output_t read_cells_alt(std::size_t event,
@@ -21,14 +53,8 @@ alt_cell_reader_output_t read_cells_alt(std::size_t event,
                                         const digitization_config* dconfig,
                                         vecmem::memory_resource* mr) {
 
-    switch (format) {
-        case data_format::csv:
-            return read_cells_alt(data_directory() + directory.data() +
-                                      get_event_filename(event, "-cells.csv"),
-                                  format, geom, dconfig, mr);
-        default:
-            throw std::invalid_argument("Unsupported data format");
-    }
+    return read_cells_alt(get_cells_filename(event, directory, format), format,
+                          geom, dconfig, mr);
 }
 
 alt_cell_reader_output_t read_cells_alt(std::string_view filename,
@@ -40,10 +66,54 @@ alt_cell_reader_output_t read_cells_alt(std::string_view filename,
     switch (format) {
         case data_format::csv:
             return csv::read_cells_alt(filename, geom, dconfig, mr);
+        case data_format::binary:
+        case data_format::compressed: {
+            alt_cell_reader_output_t result{
+                alt_cell_collection_types::host(0, mr),
+                cell_module_collection_types::host(0, mr)};
+            flatten_cells(read_cells(filename, format, geom, dconfig, mr),
+                          result.cells, result.modules);
+            return result;
+        }
+        default:
+            throw std::invalid_argument("Unsupported data format");
+    }
+}
 
+alt_cell_soa_reader_output_t read_cells_alt_soa(
+    std::size_t event, std::string_view directory, data_format format,
+    const geometry* geom, const digitization_config* dconfig,
+    vecmem::memory_resource* mr) {
+
+    return read_cells_alt_soa(get_cells_filename(event, directory, format),
+                              format, geom, dconfig, mr);
+}
+
+alt_cell_soa_reader_output_t read_cells_alt_soa(
+    std::string_view filename, data_format format, const geometry* geom,
+    const digitization_config* dconfig, vecmem::memory_resource* mr) {
+
+    alt_cell_soa_reader_output_t result{
+        alt_cell_soa_types::host{mr},
+        cell_module_collection_types::host(0, mr)};
+    switch (format) {
+        case data_format::csv: {
+            // The CSV reader sorts the cells of the modules in its own way.
+            const alt_cell_reader_output_t aos =
+                csv::read_cells_alt(filename, geom, dconfig, mr);
+            result.cells = make_alt_cell_soa(aos.cells, mr);
+            result.modules = aos.modules;
+            break;
+        }
+        case data_format::binary:
+        case data_format::compressed:
+            flatten_cells(read_cells(filename, format, geom, dconfig, mr),
+                          result.cells, result.modules);
+            break;
         default:
             throw std::invalid_argument("Unsupported data format");
     }
+    return result;
 }
 
 }  // namespace traccc::io
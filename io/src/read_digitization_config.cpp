@@ -31,10 +31,14 @@ void from_json(const nlohmann::json& json, module_digitization_config& cfg) {
     // Names/keywords used in the JSON file.
     static const char* geometric = "geometric";
     static const char* segmentation = "segmentation";
+    static const char* threshold = "threshold";
 
     // Read the object, if possible.
     if (json.find(geometric) != json.end()) {
         from_json(json[geometric][segmentation], cfg.segmentation);
+        if (json[geometric].find(threshold) != json[geometric].end()) {
+            cfg.threshold = json[geometric][threshold].get<scalar>();
+        }
     }
 }
 
@@ -0,0 +1,131 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/read_field_map.hpp"
+
+#include "csv/make_field_value_reader.hpp"
+#include "traccc/io/utils.hpp"
+
+// Acts include(s).
+#include <Acts/Definitions/Units.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace traccc::io {
+
+namespace {
+
+/// Relative tolerance on the regularity of the grid spacing
+constexpr float spacing_tolerance = 1e-3f;
+
+/// Find the (regularly spaced) grid points along one axis
+///
+/// @param coordinates The coordinates of all points of the file along the
+///                    axis, sorted in place
+/// @param filename The name of the file, for the error messages
+/// @return The number of distinct grid points along the axis
+///
+unsigned int find_axis(std::vector<float>& coordinates,
+                       const std::string& filename) {
+
+    std::sort(coordinates.begin(), coordinates.end());
+    coordinates.erase(std::unique(coordinates.begin(), coordinates.end()),
+                      coordinates.end());
+    if (coordinates.size() < 2) {
+        throw std::runtime_error("Field map in " + filename +
+                                 " needs at least two points along every "
+                                 "axis");
+    }
+    const float step = (coordinates.back() - coordinates.front()) /
+                       static_cast<float>(coordinates.size() - 1);
+    for (std::size_t i = 1; i < coordinates.size(); ++i) {
+        if (std::abs(coordinates[i] - coordinates[i - 1] - step) >
+            spacing_tolerance * step) {
+            throw std::runtime_error("Field map in " + filename +
+                                     " is not on a regular grid");
+        }
+    }
+    return static_cast<unsigned int>(coordinates.size());
+}
+
+/// @return The index of a coordinate along an axis
+unsigned int axis_index(float value, float min, float step) {
+    return static_cast<unsigned int>(std::lround((value - min) / step));
+}
+
+}  // namespace
+
+field_map read_field_map(std::string_view filename) {
+
+    // Construct the full file name.
+    const std::string full_filename = data_directory() + filename.data();
+
+    // Read all points of the file.
+    auto reader = csv::make_field_value_reader(full_filename);
+    std::vector<csv::field_value> points;
+    csv::field_value point;
+    while (reader.read(point)) {
+        points.push_back(point);
+    }
+
+    // Set up the grid from the coordinates of the points.
+    std::array<std::vector<float>, 3> axes;
+    for (std::vector<float>& axis : axes) {
+        axis.reserve(points.size());
+    }
+    for (const csv::field_value& p : points) {
+        axes[0].push_back(p.x);
+        axes[1].push_back(p.y);
+        axes[2].push_back(p.z);
+    }
+    std::array<scalar, 3> min, max, step;
+    std::array<unsigned int, 3> n_points;
+    for (unsigned int i = 0; i < 3; ++i) {
+        n_points[i] = find_axis(axes[i], full_filename);
+        min[i] = axes[i].front();
+        max[i] = axes[i].back();
+        step[i] = (max[i] - min[i]) / static_cast<scalar>(n_points[i] - 1);
+    }
+
+    // Put the field values onto the grid, converting them to native units.
+    const std::size_t size = static_cast<std::size_t>(n_points[0]) *
+                             n_points[1] * n_points[2];
+    if (points.size() != size) {
+        throw std::runtime_error("Field map in " + full_filename +
+                                 " does not cover its full grid");
+    }
+    std::vector<field_map::value_type> values(size);
+    std::vector<bool> filled(size, false);
+    const scalar tesla = static_cast<scalar>(Acts::UnitConstants::T);
+    for (const csv::field_value& p : points) {
+        const std::size_t i =
+            (static_cast<std::size_t>(axis_index(p.x, min[0], step[0])) *
+                 n_points[1] +
+             axis_index(p.y, min[1], step[1])) *
+                n_points[2] +
+            axis_index(p.z, min[2], step[2]);
+        if (filled[i]) {
+            throw std::runtime_error("Field map in " + full_filename +
+                                     " holds the same point twice");
+        }
+        filled[i] = true;
+        values[i] = {p.bx * tesla, p.by * tesla, p.bz * tesla};
+    }
+
+    return {min, max, n_points, std::move(values)};
+}
+
+}  // namespace traccc::io
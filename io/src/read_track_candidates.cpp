@@ -0,0 +1,47 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/read_track_candidates.hpp"
+
+#include "read_binary.hpp"
+#include "traccc/io/utils.hpp"
+
+// System include(s).
+#include <stdexcept>
+
+namespace traccc::io {
+
+track_candidate_container_types::host read_track_candidates(
+    std::size_t event, std::string_view directory, data_format format,
+    vecmem::memory_resource* mr) {
+
+    switch (format) {
+        case data_format::binary:
+            return read_track_candidates(
+                data_directory() + directory.data() +
+                    get_event_filename(event, "-track_candidates.dat"),
+                format, mr);
+        default:
+            throw std::invalid_argument("Unsupported data format");
+    }
+}
+
+track_candidate_container_types::host read_track_candidates(
+    std::string_view filename, data_format format,
+    vecmem::memory_resource* mr) {
+
+    switch (format) {
+        case data_format::binary:
+            return details::read_binary_container<
+                track_candidate_container_types::host>(filename, mr);
+        default:
+            throw std::invalid_argument("Unsupported data format");
+    }
+}
+
+}  // namespace traccc::io
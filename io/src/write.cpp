@@ -11,11 +11,17 @@
 #include "traccc/io/utils.hpp"
 #include "write_binary.hpp"
 
+// System include(s).
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
 namespace traccc::io {
 
 void write(std::size_t event, std::string_view directory,
            traccc::data_format format,
-           traccc::cell_container_types::const_view cells) {
+           traccc::cell_container_types::const_view cells,
+           const cell_compression_config& compression) {
 
     switch (format) {
         case data_format::binary:
@@ -24,6 +30,15 @@ void write(std::size_t event, std::string_view directory,
                     get_event_filename(event, "-cells.dat"),
                 traccc::cell_container_types::const_device{cells});
             break;
+        case data_format::compressed: {
+            const std::vector<char> data = compress_cells(cells, compression);
+            std::ofstream out_file(data_directory() + directory.data() +
+                                       get_event_filename(event, "-cells.cdat"),
+                                   std::ios::binary);
+            out_file.write(data.data(),
+                           static_cast<std::streamsize>(data.size()));
+            break;
+        }
         default:
             throw std::invalid_argument("Unsupported data format");
     }
@@ -62,4 +77,21 @@ void write(std::size_t event, std::string_view directory,
     }
 }
 
+void write(std::size_t event, std::string_view directory,
+           traccc::data_format format,
+           track_candidate_container_types::const_view track_candidates) {
+
+    switch (format) {
+        case data_format::binary:
+            details::write_binary_container(
+                data_directory() + directory.data() +
+                    get_event_filename(event, "-track_candidates.dat"),
+                traccc::track_candidate_container_types::const_device{
+                    track_candidates});
+            break;
+        default:
+            throw std::invalid_argument("Unsupported data format");
+    }
+}
+
 }  // namespace traccc::io
@@ -9,19 +9,20 @@
 
 // System include(s).
 #include <fstream>
+#include <ostream>
 #include <string_view>
 #include <type_traits>
 #include <vector>
 
 namespace traccc::io::details {
 
-/// Function for writing a container into a binary file
+/// Function for writing a container into a binary stream
 ///
-/// @param filename is the output filename which includes the path
+/// @param out_file is the stream to write the container to
 /// @param container is the traccc container to write
 ///
 template <typename container_t>
-void write_binary_container(std::string_view filename,
+void write_binary_container(std::ostream& out_file,
                             const container_t& container) {
 
     // Make sure that the chosen types work.
@@ -30,9 +31,6 @@ void write_binary_container(std::string_view filename,
     static_assert(std::is_standard_layout_v<typename container_t::item_type>,
                   "Container item type must have standard layout.");
 
-    // Open the output file.
-    std::ofstream out_file(filename.data(), std::ios::binary);
-
     // Write the size of the header vector.
     const std::size_t headers_size = container.size();
     out_file.write(reinterpret_cast<const char*>(&headers_size),
@@ -62,4 +60,20 @@ void write_binary_container(std::string_view filename,
     }
 }
 
+/// Function for writing a container into a binary file
+///
+/// @param filename is the output filename which includes the path
+/// @param container is the traccc container to write
+///
+template <typename container_t>
+void write_binary_container(std::string_view filename,
+                            const container_t& container) {
+
+    // Open the output file.
+    std::ofstream out_file(filename.data(), std::ios::binary);
+
+    // Write the container into it.
+    write_binary_container(out_file, container);
+}
+
 }  // namespace traccc::io::details
@@ -0,0 +1,74 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/performance/timing_info.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace traccc::performance {
+
+/// Helper type used for energy information storage (in Joules)
+using energy_info_pair = std::pair<std::string, double>;
+
+/// Struct for storing energy measurements collected by timers
+///
+/// The energy is measured the same way as the time, with
+/// @c traccc::performance::timer objects that were given an energy meter.
+///
+struct energy_info {
+
+    /// The low level data.
+    std::vector<energy_info_pair> data;
+
+    /// Add energy used by a given component
+    ///
+    /// @param name The name of the component
+    /// @param joules The energy used by the component
+    ///
+    void add(std::string_view name, double joules);
+
+    /// Get the energy used by a given component
+    ///
+    /// @param name The name of the component
+    /// @return The energy (in Joules) used by the component in question
+    ///
+    double get_energy(std::string_view name) const;
+
+};  // struct energy_info
+
+/// Printout helper for @c traccc::performance::energy_info
+std::ostream& operator<<(std::ostream& out, const energy_info& info);
+
+/// Convenience type for printing energy efficiency information
+struct energy_efficiency {
+
+    /// Constructor with a "timer name", energy use and processing time
+    energy_efficiency(std::size_t events, const energy_info& ei,
+                      const timing_info& ti, std::string_view timer_name);
+
+    /// The timer name
+    std::string m_timer_name;
+    /// The Joules per event value
+    double m_perEvent;
+    /// The average power (in Watts)
+    double m_power;
+
+};  // struct energy_efficiency
+
+/// Printout operator
+std::ostream& operator<<(std::ostream& out, const energy_efficiency& eff);
+
+}  // namespace traccc::performance
@@ -0,0 +1,76 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace traccc::performance {
+
+/// Reader of the Linux powercap (RAPL) energy counters of the host
+///
+/// The energy used by the CPU packages, and by the memory attached to them
+/// (where the hardware reports it separately), is summed up. The counters
+/// are only a few tens of bits wide, and wrap around every few minutes
+/// under load. The meter accounts for this, as long as it is read more
+/// often than that.
+///
+/// When the powercap interface is not available (not a Linux host, no RAPL
+/// support, or the counters are not readable by the current user), the
+/// meter reports itself as unavailable, and always returns zero.
+///
+/// The meter can be read from multiple threads at the same time.
+///
+class energy_meter {
+
+    public:
+    /// Constructor, finding the energy counters of the host
+    ///
+    /// @param powercap_dir The directory of the powercap interface
+    ///
+    energy_meter(const std::string& powercap_dir = "/sys/class/powercap");
+
+    /// Check whether any energy counters could be found
+    bool available() const;
+
+    /// Get the names of the energy counters in use
+    std::vector<std::string> domains() const;
+
+    /// Get the energy used since the construction of the meter
+    ///
+    /// @return The energy used, in Joules
+    ///
+    double read();
+
+    private:
+    /// A single energy counter
+    struct domain {
+        /// The name of the domain, as reported by the kernel
+        std::string name;
+        /// The file holding the counter value (in micro-Joules)
+        std::string counter_file;
+        /// The value after which the counter wraps around
+        std::uint64_t max_range = 0;
+        /// The value read last time
+        std::uint64_t last = 0;
+    };
+
+    /// The counters in use
+    std::vector<domain> m_domains;
+    /// Energy accumulated since the construction of the meter (in
+    /// micro-Joules)
+    std::uint64_t m_total = 0;
+    /// Mutex protecting the reading of the counters
+    std::mutex m_mutex;
+
+};  // class energy_meter
+
+}  // namespace traccc::performance
@@ -0,0 +1,82 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace traccc::performance {
+
+/// Memory resource keeping track of the highest number of bytes in use
+///
+/// All (de)allocations are forwarded to an upstream resource. Unlike
+/// @c traccc::performance::instrumented_memory_resource, this resource only
+/// keeps two atomic counters, and the sizes of the largest allocations. So
+/// it is cheap enough to be used in every job, to record the memory needed
+/// by each event.
+///
+class high_water_memory_resource : public vecmem::memory_resource {
+
+    public:
+    /// The number of the largest allocations that are remembered
+    static constexpr std::size_t n_largest = 32;
+
+    /// Constructor on top of an upstream memory resource
+    ///
+    /// @param upstream The resource to perform the actual allocations with
+    ///
+    explicit high_water_memory_resource(vecmem::memory_resource& upstream);
+
+    /// Get the upstream memory resource
+    vecmem::memory_resource& upstream() const;
+
+    /// Number of bytes currently allocated through the resource
+    std::size_t current() const;
+    /// Highest number of bytes allocated since the last reset
+    std::size_t peak() const;
+
+    /// Sizes of the largest allocations since the last reset, in
+    /// decreasing order
+    std::vector<std::size_t> largest() const;
+
+    /// Reset the high-water mark to the currently allocated number of bytes,
+    /// and forget the sizes of the allocations made so far
+    void reset_peak();
+
+    private:
+    /// Allocate memory through the upstream resource
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    /// Deallocate memory through the upstream resource
+    void do_deallocate(void* ptr, std::size_t bytes,
+                       std::size_t alignment) override;
+    /// Compare the resource to another one
+    bool do_is_equal(const memory_resource& other) const noexcept override;
+
+    /// The upstream memory resource
+    vecmem::memory_resource& m_upstream;
+    /// The number of bytes currently allocated
+    std::atomic_size_t m_current{0};
+    /// The highest number of bytes allocated since the last reset
+    std::atomic_size_t m_peak{0};
+
+    /// Mutex protecting the list of the largest allocations
+    mutable std::mutex m_largest_mutex;
+    /// The largest allocation sizes since the last reset, in decreasing order
+    std::vector<std::size_t> m_largest;
+    /// Size that an allocation needs to exceed to be put into the list
+    std::atomic_size_t m_largest_threshold{0};
+
+};  // class high_water_memory_resource
+
+}  // namespace traccc::performance
@@ -0,0 +1,93 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/performance/memory_profile.hpp"
+#include "traccc/performance/memory_scope.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace traccc::performance {
+
+/// Memory resource recording allocation statistics per algorithm stage
+///
+/// All (de)allocations are forwarded to an upstream resource. Every
+/// allocation is attributed to the @c traccc::performance::memory_scope that
+/// is active on the allocating thread, and is accounted for in that stage
+/// even if it gets deallocated from a different scope. The resource can be
+/// used from multiple threads at the same time.
+///
+class instrumented_memory_resource : public vecmem::memory_resource {
+
+    public:
+    /// Name of the stage collecting allocations made outside of any scope
+    static constexpr std::string_view unscoped_name = "(unscoped)";
+
+    /// Constructor on top of an upstream memory resource
+    ///
+    /// @param upstream The resource to perform the actual allocations with
+    ///
+    explicit instrumented_memory_resource(vecmem::memory_resource& upstream);
+
+    /// Get the allocation statistics collected so far
+    memory_profile profile() const;
+
+    /// Reset the allocation statistics
+    ///
+    /// Allocations that are alive at the time of the call are still
+    /// accounted for in the current and peak number of bytes of their stage.
+    ///
+    void reset();
+
+    private:
+    /// Allocate memory through the upstream resource
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    /// Deallocate memory through the upstream resource
+    void do_deallocate(void* ptr, std::size_t bytes,
+                       std::size_t alignment) override;
+    /// Compare the resource to another one
+    bool do_is_equal(const memory_resource& other) const noexcept override;
+
+    /// Find (or create) the statistics of a given stage
+    ///
+    /// @param stage_name The name of the stage
+    /// @return The index of the stage in @c m_profile
+    ///
+    std::size_t stage_index(std::string_view stage_name);
+
+    /// Book-keeping information for a live allocation
+    struct allocation_info {
+        /// Index of the stage in @c m_profile
+        std::size_t stage_index;
+        /// Size of the allocation
+        std::size_t bytes;
+        /// Time of the allocation
+        std::chrono::steady_clock::time_point start;
+    };
+
+    /// The upstream memory resource
+    vecmem::memory_resource& m_upstream;
+    /// Mutex protecting the statistics
+    mutable std::mutex m_mutex;
+    /// The live allocations
+    std::unordered_map<void*, allocation_info> m_allocations;
+    /// The collected statistics
+    memory_profile m_profile;
+
+};  // class instrumented_memory_resource
+
+}  // namespace traccc::performance
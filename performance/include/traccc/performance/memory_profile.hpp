@@ -0,0 +1,83 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <array>
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace traccc::performance {
+
+/// Allocation statistics of a single algorithm stage
+struct memory_stage_profile {
+
+    /// Number of bins in the allocation lifetime histogram
+    static constexpr std::size_t n_lifetime_bins = 24;
+
+    /// Number of allocations made
+    std::size_t n_allocations = 0;
+    /// Number of deallocations made
+    std::size_t n_deallocations = 0;
+    /// Total number of bytes allocated
+    std::size_t allocated_bytes = 0;
+    /// Number of bytes currently allocated
+    std::size_t current_bytes = 0;
+    /// Highest number of bytes allocated at the same time
+    std::size_t peak_bytes = 0;
+    /// Size of the largest single allocation
+    std::size_t largest_allocation = 0;
+
+    /// Histogram of the allocation lifetimes
+    ///
+    /// Bin 0 counts the allocations that lived for less than 1 us, bin i the
+    /// ones that lived for [2^(i-1), 2^i) us. The last bin also counts all
+    /// longer lived allocations.
+    ///
+    std::array<std::size_t, n_lifetime_bins> lifetime_histogram{};
+
+};  // struct memory_stage_profile
+
+/// Helper type used for the memory profile storage
+using memory_profile_pair = std::pair<std::string, memory_stage_profile>;
+
+/// Allocation statistics collected by
+/// @c traccc::performance::instrumented_memory_resource
+///
+struct memory_profile {
+
+    /// The low level data, one entry per algorithm stage
+    std::vector<memory_profile_pair> data;
+
+    /// Get the statistics of a given stage
+    ///
+    /// @param stage_name The name of the stage
+    /// @return The allocation statistics of the stage in question
+    ///
+    const memory_stage_profile& get(std::string_view stage_name) const;
+
+    /// Add the statistics of another profile to this one
+    ///
+    /// Used to combine the profiles of resources used by different threads.
+    /// The peak values are summed up, as a conservative estimate for
+    /// resources that were used concurrently.
+    ///
+    /// @param other The profile to add to this one
+    ///
+    void add(const memory_profile& other);
+
+};  // struct memory_profile
+
+/// Printout helper for @c traccc::performance::memory_profile
+std::ostream& operator<<(std::ostream& out, const memory_profile& profile);
+
+}  // namespace traccc::performance
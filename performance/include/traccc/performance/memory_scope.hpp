@@ -0,0 +1,53 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <string>
+#include <string_view>
+
+namespace traccc::performance {
+
+/// Object marking the algorithm stage that memory allocations belong to
+///
+/// The scope is active from construction to destruction, on the thread that
+/// created it. Scopes may be nested, in which case the innermost one is used
+/// by @c traccc::performance::instrumented_memory_resource to attribute the
+/// allocations to.
+///
+class memory_scope {
+
+    public:
+    /// Activate a new scope
+    /// @param scope_name name identifying the algorithm stage
+    explicit memory_scope(std::string_view scope_name);
+
+    /// Deactivate the scope, re-activating the enclosing one
+    ~memory_scope();
+
+    /// The object is not copyable
+    memory_scope(const memory_scope&) = delete;
+    /// The object is not copy-assignable
+    memory_scope& operator=(const memory_scope&) = delete;
+
+    /// Get the name of the scope active on the current thread
+    ///
+    /// @return The name of the innermost active scope, or an empty string if
+    ///         there is no active scope
+    ///
+    static std::string_view current();
+
+    private:
+    /// Name of the scope
+    std::string m_name;
+    /// The enclosing scope on the same thread
+    const memory_scope* m_parent;
+
+};  // class memory_scope
+
+}  // namespace traccc::performance
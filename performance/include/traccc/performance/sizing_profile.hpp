@@ -0,0 +1,130 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace traccc::performance {
+
+/// High-water mark of a single buffer type
+struct sizing_entry {
+
+    /// Highest size seen, divided by the number of cells of the event
+    double size_per_cell = 0.;
+    /// Highest size seen
+    std::size_t max_size = 0;
+};
+
+/// Type of a single named sizing entry
+using sizing_pair = std::pair<std::string, sizing_entry>;
+
+/// High-water marks of buffer sizes, as seen while processing events
+///
+/// The sizes are recorded relative to the number of cells in the events,
+/// so that they can be used to estimate the buffer sizes needed for events
+/// of a different size. Profiles can be saved to, and read back from text
+/// files, to pre-size memory caches at the start of later jobs.
+///
+struct sizing_profile {
+
+    /// Name of the entry describing the peak host memory use of an event
+    static constexpr std::string_view host_memory_name = "host_memory";
+    /// Name of the entry describing the peak device memory use of an event
+    static constexpr std::string_view device_memory_name = "device_memory";
+
+    /// The recorded entries
+    std::vector<sizing_pair> data;
+
+    /// Record the size of a buffer used while processing an event
+    ///
+    /// @param name The name of the buffer type
+    /// @param n_cells The number of cells in the event
+    /// @param size The size of the buffer
+    ///
+    void record(std::string_view name, std::size_t n_cells, std::size_t size);
+
+    /// Estimate the size of a buffer type for an event
+    ///
+    /// @param name The name of the buffer type
+    /// @param n_cells The number of cells in the event
+    /// @param margin Fractional safety margin to add to the estimate
+    /// @return The estimated size, or 0 for unknown buffer types
+    ///
+    std::size_t estimate(std::string_view name, std::size_t n_cells,
+                         double margin = 0.1) const;
+
+    /// Record the sizes of the largest allocations made for an event
+    ///
+    /// Every allocation is stored as a separate entry, named after the
+    /// memory type and the rank of the allocation by size.
+    ///
+    /// @param name The name of the memory type
+    /// @param n_cells The number of cells in the event
+    /// @param sizes The sizes of the allocations, in decreasing order
+    ///
+    void record_allocations(std::string_view name, std::size_t n_cells,
+                            const std::vector<std::size_t>& sizes);
+
+    /// Estimate the sizes of the largest allocations made for an event
+    ///
+    /// Falls back to a single allocation of the total memory size of
+    /// @c name, for profiles without individual allocation sizes.
+    ///
+    /// @param name The name of the memory type
+    /// @param n_cells The number of cells in the event
+    /// @param margin Fractional safety margin to add to the estimates
+    /// @return The estimated sizes, in decreasing order
+    ///
+    std::vector<std::size_t> estimate_allocations(std::string_view name,
+                                                  std::size_t n_cells,
+                                                  double margin = 0.1) const;
+
+    /// Merge the high-water marks of another profile into this one
+    void add(const sizing_profile& other);
+
+    /// Read a profile from a text file, and merge it into this one
+    ///
+    /// @param filename The file to read
+    ///
+    void read(const std::string& filename);
+
+    /// Write the profile into a text file
+    ///
+    /// @param filename The file to write
+    ///
+    void write(const std::string& filename) const;
+
+};  // struct sizing_profile
+
+/// Pre-allocate memory in a (caching) memory resource
+///
+/// Every size is allocated separately, and all of the memory is deallocated
+/// again once everything was allocated. So a caching resource like
+/// @c vecmem::binary_page_memory_resource would hold on to blocks of the
+/// same sizes as the ones that the events need, and serve subsequent
+/// allocations without going upstream.
+///
+/// @param mr The memory resource to pre-allocate memory in
+/// @param sizes The sizes of the allocations to make
+///
+void preallocate(vecmem::memory_resource& mr,
+                 const std::vector<std::size_t>& sizes);
+
+/// Printout helper for @c traccc::performance::sizing_profile
+std::ostream& operator<<(std::ostream& out, const sizing_profile& profile);
+
+}  // namespace traccc::performance
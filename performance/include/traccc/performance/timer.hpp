@@ -8,6 +8,8 @@
 #pragma once
 
 // Project include(s).
+#include "traccc/performance/energy_info.hpp"
+#include "traccc/performance/energy_meter.hpp"
 #include "traccc/performance/timing_info.hpp"
 
 // System include(s).
@@ -30,6 +32,15 @@ class timer {
     /// @param t_info shared_ptr to timing_info where to store timings
     timer(const std::string_view timer_name, timing_info& t_info);
 
+    /// Start time and energy measurement
+    /// @param timer_name name to be printed out identifying what is measured
+    /// @param t_info timing_info where to store timings
+    /// @param e_info energy_info where to store the energy used
+    /// @param meter energy meter to use (no energy is measured if it is
+    ///              @c nullptr, or if it is not available)
+    timer(const std::string_view timer_name, timing_info& t_info,
+          energy_info& e_info, energy_meter* meter);
+
     /// End time measurement
     ~timer();
 
@@ -42,6 +53,13 @@ class timer {
 
     /// Shared ptr to timing info where to store elapsed time
     timing_info& m_timing_info;
+
+    /// Energy info where to store the energy used (if measured)
+    energy_info* m_energy_info = nullptr;
+    /// Energy meter to use (if any)
+    energy_meter* m_meter = nullptr;
+    /// Energy meter reading at construct time
+    double m_start_energy = 0.;
 };  // class timer
 
 }  // namespace traccc::performance
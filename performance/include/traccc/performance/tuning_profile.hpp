@@ -0,0 +1,118 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace traccc::performance {
+
+/// Values of the tunable parameters of a job, by parameter name
+using tuning_values = std::map<std::string, std::size_t>;
+
+/// Candidate values of the tunable parameters, to sweep over
+using tuning_space =
+    std::vector<std::pair<std::string, std::vector<std::size_t> > >;
+
+/// Best tuning values found for different hosts and backends
+///
+/// Every entry is identified by a key made out of the name of the host and
+/// the name of the backend (see @c traccc::performance::tuning_key), so a
+/// single file can hold the tuned values of multiple machines. Profiles can
+/// be saved to, and read back from text files.
+///
+struct tuning_profile {
+
+    /// The tuned values, by host/backend key
+    std::map<std::string, tuning_values> data;
+
+    /// Find the tuned values for a host/backend key
+    ///
+    /// @param key The host/backend key to look for
+    /// @return The tuned values, or @c nullptr if there are none for the key
+    ///
+    const tuning_values* find(const std::string& key) const;
+
+    /// Read a profile from a text file, and merge it into this one
+    ///
+    /// Entries read from the file replace the existing ones with the same
+    /// key.
+    ///
+    /// @param filename The file to read
+    ///
+    void read(const std::string& filename);
+
+    /// Write the profile into a text file
+    ///
+    /// @param filename The file to write
+    ///
+    void write(const std::string& filename) const;
+
+};  // struct tuning_profile
+
+/// Construct the key identifying a backend on the current host
+///
+/// @param backend The name of the backend (any characters that could not be
+///                used in a tuning profile file are replaced)
+/// @return The key to use in @c traccc::performance::tuning_profile
+///
+std::string tuning_key(std::string_view backend);
+
+/// Function measuring the throughput of a job with some tuning values
+///
+/// It should return the throughput (in events per second), or throw an
+/// exception if the values can not be used on the current host/device.
+///
+using tuning_measurement = std::function<double(const tuning_values&)>;
+
+/// The result of a calibration sweep
+struct tuning_result {
+
+    /// The values giving the best throughput
+    tuning_values best;
+    /// The best throughput measured (in events per second)
+    double throughput = 0.;
+    /// The number of configurations measured
+    std::size_t measurements = 0;
+};
+
+/// Run a calibration sweep over the tunable parameters of a job
+///
+/// The parameters are tuned one at a time, in the order of the tuning
+/// space, keeping the best values found so far for all other parameters.
+/// This needs far fewer measurements than trying all combinations of the
+/// candidate values, and works well as long as the parameters are (mostly)
+/// independent of each other. Configurations that can not be used on the
+/// host/device are skipped.
+///
+/// @param start The values to start from (also used for parameters not in
+///              the tuning space)
+/// @param space The candidate values of the tunable parameters
+/// @param measure Function measuring the throughput of a configuration
+/// @param log Stream to print the measurements to (if not @c nullptr)
+/// @return The best configuration found
+///
+tuning_result autotune(const tuning_values& start, const tuning_space& space,
+                       const tuning_measurement& measure,
+                       std::ostream* log = nullptr);
+
+/// Printout helper for @c traccc::performance::tuning_values
+///
+/// @param values The values to print
+/// @return The values in a "name1=value1 name2=value2 ..." format
+///
+std::string to_string(const tuning_values& values);
+
+}  // namespace traccc::performance
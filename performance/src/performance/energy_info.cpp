@@ -0,0 +1,79 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/energy_info.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+
+namespace traccc::performance {
+
+void energy_info::add(std::string_view name, double joules) {
+
+    auto it = std::find_if(
+        data.begin(), data.end(),
+        [&name](const energy_info_pair& element) {
+            return element.first == name;
+        });
+    if (it == data.end()) {
+        data.push_back({std::string(name), joules});
+    } else {
+        it->second += joules;
+    }
+}
+
+double energy_info::get_energy(std::string_view name) const {
+
+    auto it = std::find_if(
+        data.begin(), data.end(),
+        [&name](const energy_info_pair& element) {
+            return element.first == name;
+        });
+    if (it == data.end()) {
+        throw std::invalid_argument("Unknown component name received");
+    }
+    return it->second;
+}
+
+std::ostream& operator<<(std::ostream& out, const energy_info& info) {
+
+    for (std::size_t i = 0; i < info.data.size(); ++i) {
+        const energy_info_pair& ei = info.data.at(i);
+        out << std::setw(30) << std::right << ei.first << "  " << ei.second
+            << " J";
+        if ((i + 1) < info.data.size()) {
+            out << "\n";
+        }
+    }
+    return out;
+}
+
+energy_efficiency::energy_efficiency(std::size_t events, const energy_info& ei,
+                                     const timing_info& ti,
+                                     std::string_view timer_name)
+    : m_timer_name(timer_name) {
+
+    const double energy = ei.get_energy(timer_name);
+    const double seconds =
+        std::chrono::duration<double>(ti.get_time(timer_name)).count();
+    m_perEvent = energy / static_cast<double>(events);
+    m_power = (seconds > 0.) ? (energy / seconds) : 0.;
+}
+
+std::ostream& operator<<(std::ostream& out, const energy_efficiency& eff) {
+
+    out << std::setw(30) << std::right << eff.m_timer_name << "  "
+        << eff.m_perEvent << " J/event, " << eff.m_power << " W";
+    return out;
+}
+
+}  // namespace traccc::performance
@@ -0,0 +1,108 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/energy_meter.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+
+namespace traccc::performance {
+
+namespace {
+
+/// Prefix of the names of the RAPL zones in the powercap directory
+const std::string zone_prefix = "intel-rapl:";
+
+/// Read a single value from a (sysfs) file
+template <typename T>
+bool read_value(const std::string& filename, T& value) {
+
+    std::ifstream file(filename);
+    return static_cast<bool>(file >> value);
+}
+
+}  // namespace
+
+energy_meter::energy_meter(const std::string& powercap_dir) {
+
+    namespace fs = std::filesystem;
+
+    // Collect the zones of the RAPL interface, in a reproducible order.
+    std::error_code ec;
+    std::vector<std::string> zones;
+    for (fs::directory_iterator it(powercap_dir, ec), end; (!ec) && (it != end);
+         it.increment(ec)) {
+        const std::string zone = it->path().filename().string();
+        if (zone.compare(0, zone_prefix.size(), zone_prefix) == 0) {
+            zones.push_back(zone);
+        }
+    }
+    std::sort(zones.begin(), zones.end());
+
+    // Use the CPU packages, and the memory attached to them. The package
+    // counters do not include the memory, while the platform ("psys") and
+    // core counters overlap with the package ones.
+    for (const std::string& zone : zones) {
+        const std::string zone_dir = powercap_dir + "/" + zone;
+        domain d;
+        if (!read_value(zone_dir + "/name", d.name)) {
+            continue;
+        }
+        const bool top_level =
+            (zone.find(':', zone_prefix.size()) == std::string::npos);
+        if ((top_level && (d.name.compare(0, 7, "package") != 0)) ||
+            ((!top_level) && (d.name != "dram"))) {
+            continue;
+        }
+        d.counter_file = zone_dir + "/energy_uj";
+        if (!read_value(d.counter_file, d.last)) {
+            // Typically the counters are only readable by root.
+            continue;
+        }
+        read_value(zone_dir + "/max_energy_range_uj", d.max_range);
+        m_domains.push_back(d);
+    }
+}
+
+bool energy_meter::available() const {
+
+    return (!m_domains.empty());
+}
+
+std::vector<std::string> energy_meter::domains() const {
+
+    std::vector<std::string> result;
+    for (const domain& d : m_domains) {
+        result.push_back(d.name);
+    }
+    return result;
+}
+
+double energy_meter::read() {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (domain& d : m_domains) {
+        std::uint64_t value = 0;
+        if (!read_value(d.counter_file, value)) {
+            continue;
+        }
+        if (value >= d.last) {
+            m_total += value - d.last;
+        } else if (d.max_range > d.last) {
+            // The counter wrapped around since the last reading.
+            m_total += (d.max_range - d.last) + value;
+        }
+        d.last = value;
+    }
+    return static_cast<double>(m_total) * 1e-6;
+}
+
+}  // namespace traccc::performance
@@ -0,0 +1,94 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/high_water_memory_resource.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <functional>
+
+namespace traccc::performance {
+
+high_water_memory_resource::high_water_memory_resource(
+    vecmem::memory_resource& upstream)
+    : m_upstream(upstream) {}
+
+vecmem::memory_resource& high_water_memory_resource::upstream() const {
+
+    return m_upstream;
+}
+
+std::size_t high_water_memory_resource::current() const {
+
+    return m_current.load();
+}
+
+std::size_t high_water_memory_resource::peak() const {
+
+    return m_peak.load();
+}
+
+std::vector<std::size_t> high_water_memory_resource::largest() const {
+
+    std::lock_guard<std::mutex> lock(m_largest_mutex);
+    return m_largest;
+}
+
+void high_water_memory_resource::reset_peak() {
+
+    m_peak.store(m_current.load());
+    std::lock_guard<std::mutex> lock(m_largest_mutex);
+    m_largest.clear();
+    m_largest_threshold.store(0);
+}
+
+void* high_water_memory_resource::do_allocate(std::size_t bytes,
+                                              std::size_t alignment) {
+
+    // Perform the allocation. Let exceptions from the upstream resource
+    // propagate to the caller.
+    void* result = m_upstream.allocate(bytes, alignment);
+
+    // Update the counters.
+    const std::size_t current = m_current.fetch_add(bytes) + bytes;
+    std::size_t peak = m_peak.load();
+    while ((current > peak) && (!m_peak.compare_exchange_weak(peak, current))) {
+    }
+
+    // Remember the size, if it is one of the largest ones. Most allocations
+    // are rejected without taking the lock.
+    if (bytes > m_largest_threshold.load()) {
+        std::lock_guard<std::mutex> lock(m_largest_mutex);
+        m_largest.insert(std::upper_bound(m_largest.begin(), m_largest.end(),
+                                          bytes, std::greater<std::size_t>()),
+                         bytes);
+        if (m_largest.size() > n_largest) {
+            m_largest.pop_back();
+        }
+        if (m_largest.size() == n_largest) {
+            m_largest_threshold.store(m_largest.back());
+        }
+    }
+
+    return result;
+}
+
+void high_water_memory_resource::do_deallocate(void* ptr, std::size_t bytes,
+                                               std::size_t alignment) {
+
+    m_current.fetch_sub(bytes);
+    m_upstream.deallocate(ptr, bytes, alignment);
+}
+
+bool high_water_memory_resource::do_is_equal(
+    const memory_resource& other) const noexcept {
+
+    return (this == &other);
+}
+
+}  // namespace traccc::performance
@@ -0,0 +1,119 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/instrumented_memory_resource.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <string>
+
+namespace traccc::performance {
+
+instrumented_memory_resource::instrumented_memory_resource(
+    vecmem::memory_resource& upstream)
+    : m_upstream(upstream) {}
+
+memory_profile instrumented_memory_resource::profile() const {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_profile;
+}
+
+void instrumented_memory_resource::reset() {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (memory_profile_pair& mp : m_profile.data) {
+        const std::size_t current_bytes = mp.second.current_bytes;
+        mp.second = {};
+        mp.second.current_bytes = current_bytes;
+        mp.second.peak_bytes = current_bytes;
+    }
+}
+
+void* instrumented_memory_resource::do_allocate(std::size_t bytes,
+                                                std::size_t alignment) {
+
+    // Perform the allocation. Let exceptions from the upstream resource
+    // propagate to the caller.
+    void* result = m_upstream.allocate(bytes, alignment);
+    const auto now = std::chrono::steady_clock::now();
+
+    // Find the stage before taking the lock, the scope is thread local.
+    std::string_view stage_name = memory_scope::current();
+    if (stage_name.empty()) {
+        stage_name = unscoped_name;
+    }
+
+    // Record the allocation.
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const std::size_t index = stage_index(stage_name);
+    memory_stage_profile& stage = m_profile.data[index].second;
+    ++stage.n_allocations;
+    stage.allocated_bytes += bytes;
+    stage.current_bytes += bytes;
+    stage.peak_bytes = std::max(stage.peak_bytes, stage.current_bytes);
+    stage.largest_allocation = std::max(stage.largest_allocation, bytes);
+    m_allocations[result] = {index, bytes, now};
+
+    return result;
+}
+
+void instrumented_memory_resource::do_deallocate(void* ptr, std::size_t bytes,
+                                                 std::size_t alignment) {
+
+    const auto now = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_allocations.find(ptr);
+        if (it != m_allocations.end()) {
+
+            memory_stage_profile& stage =
+                m_profile.data[it->second.stage_index].second;
+            ++stage.n_deallocations;
+            stage.current_bytes -= std::min(stage.current_bytes, bytes);
+
+            // Fill the lifetime histogram.
+            const auto lifetime =
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    now - it->second.start)
+                    .count();
+            std::size_t bin = 0;
+            while ((bin + 1 < memory_stage_profile::n_lifetime_bins) &&
+                   (lifetime >= (1l << bin))) {
+                ++bin;
+            }
+            ++stage.lifetime_histogram[bin];
+
+            m_allocations.erase(it);
+        }
+    }
+
+    m_upstream.deallocate(ptr, bytes, alignment);
+}
+
+bool instrumented_memory_resource::do_is_equal(
+    const memory_resource& other) const noexcept {
+
+    return (this == &other);
+}
+
+std::size_t instrumented_memory_resource::stage_index(
+    std::string_view stage_name) {
+
+    auto it = std::find_if(m_profile.data.begin(), m_profile.data.end(),
+                           [&stage_name](const memory_profile_pair& element) {
+                               return element.first == stage_name;
+                           });
+    if (it != m_profile.data.end()) {
+        return static_cast<std::size_t>(it - m_profile.data.begin());
+    }
+    m_profile.data.push_back({std::string(stage_name), {}});
+    return m_profile.data.size() - 1;
+}
+
+}  // namespace traccc::performance
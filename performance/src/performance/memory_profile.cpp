@@ -0,0 +1,98 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/memory_profile.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+
+namespace traccc::performance {
+
+const memory_stage_profile& memory_profile::get(
+    std::string_view stage_name) const {
+
+    auto it = std::find_if(data.begin(), data.end(),
+                           [&stage_name](const memory_profile_pair& element) {
+                               return element.first == stage_name;
+                           });
+    if (it == data.end()) {
+        throw std::invalid_argument("Unknown stage name received");
+    }
+    return it->second;
+}
+
+void memory_profile::add(const memory_profile& other) {
+
+    for (const memory_profile_pair& mp : other.data) {
+
+        // Find the stage in this profile, or create it.
+        auto it = std::find_if(data.begin(), data.end(),
+                               [&mp](const memory_profile_pair& element) {
+                                   return element.first == mp.first;
+                               });
+        if (it == data.end()) {
+            data.push_back(mp);
+            continue;
+        }
+
+        // Add up the statistics.
+        memory_stage_profile& stage = it->second;
+        stage.n_allocations += mp.second.n_allocations;
+        stage.n_deallocations += mp.second.n_deallocations;
+        stage.allocated_bytes += mp.second.allocated_bytes;
+        stage.current_bytes += mp.second.current_bytes;
+        stage.peak_bytes += mp.second.peak_bytes;
+        stage.largest_allocation =
+            std::max(stage.largest_allocation, mp.second.largest_allocation);
+        for (std::size_t bin = 0; bin < stage.lifetime_histogram.size();
+             ++bin) {
+            stage.lifetime_histogram[bin] += mp.second.lifetime_histogram[bin];
+        }
+    }
+}
+
+std::ostream& operator<<(std::ostream& out, const memory_profile& profile) {
+
+    static constexpr double MB = 1024. * 1024.;
+
+    for (std::size_t i = 0; i < profile.data.size(); ++i) {
+        const memory_profile_pair& mp = profile.data.at(i);
+        const memory_stage_profile& stage = mp.second;
+        out << std::setw(30) << std::right << mp.first << "  "
+            << stage.n_allocations << " allocation(s), " << std::fixed
+            << std::setprecision(2) << (stage.allocated_bytes / MB)
+            << " MB total, " << (stage.peak_bytes / MB) << " MB peak, "
+            << (stage.largest_allocation / MB) << " MB largest\n"
+            << std::setw(30) << "" << "  lifetimes:";
+        for (std::size_t bin = 0; bin < stage.lifetime_histogram.size();
+             ++bin) {
+            if (stage.lifetime_histogram[bin] == 0) {
+                continue;
+            }
+            if (bin == 0) {
+                out << " <1us";
+            } else if ((bin + 1) == stage.lifetime_histogram.size()) {
+                out << " >=" << (1ul << (bin - 1)) << "us";
+            } else {
+                out << " " << (1ul << (bin - 1)) << "-" << (1ul << bin)
+                    << "us";
+            }
+            out << ":" << stage.lifetime_histogram[bin];
+        }
+        out << std::defaultfloat;
+        if ((i + 1) < profile.data.size()) {
+            out << "\n";
+        }
+    }
+    return out;
+}
+
+}  // namespace traccc::performance
@@ -0,0 +1,39 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/memory_scope.hpp"
+
+namespace {
+
+/// The innermost active scope of the current thread
+thread_local const traccc::performance::memory_scope* current_scope = nullptr;
+
+}  // namespace
+
+namespace traccc::performance {
+
+memory_scope::memory_scope(std::string_view scope_name)
+    : m_name(scope_name), m_parent(current_scope) {
+
+    current_scope = this;
+}
+
+memory_scope::~memory_scope() {
+
+    current_scope = m_parent;
+}
+
+std::string_view memory_scope::current() {
+
+    if (current_scope == nullptr) {
+        return {};
+    }
+    return current_scope->m_name;
+}
+
+}  // namespace traccc::performance
@@ -0,0 +1,205 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/sizing_profile.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace traccc::performance {
+
+namespace {
+
+/// Header line identifying sizing profile files
+const std::string file_header = "# traccc sizing profile v1";
+
+/// Find an entry in a profile
+template <typename VECTOR>
+auto find_entry(VECTOR& data, std::string_view name) {
+
+    return std::find_if(
+        data.begin(), data.end(),
+        [&name](const sizing_pair& element) { return element.first == name; });
+}
+
+/// Name of the entry of one of the largest allocations of a memory type
+std::string allocation_name(std::string_view name, std::size_t rank) {
+
+    return std::string(name) + "_allocation_" + std::to_string(rank);
+}
+
+}  // namespace
+
+void sizing_profile::record(std::string_view name, std::size_t n_cells,
+                            std::size_t size) {
+
+    auto it = find_entry(data, name);
+    if (it == data.end()) {
+        data.push_back({std::string(name), {}});
+        it = data.end() - 1;
+    }
+    sizing_entry& entry = it->second;
+    entry.max_size = std::max(entry.max_size, size);
+    if (n_cells > 0) {
+        entry.size_per_cell =
+            std::max(entry.size_per_cell, static_cast<double>(size) /
+                                              static_cast<double>(n_cells));
+    }
+}
+
+std::size_t sizing_profile::estimate(std::string_view name,
+                                     std::size_t n_cells, double margin) const {
+
+    auto it = find_entry(data, name);
+    if (it == data.end()) {
+        return 0;
+    }
+    const double size = (n_cells > 0)
+                            ? it->second.size_per_cell *
+                                  static_cast<double>(n_cells)
+                            : static_cast<double>(it->second.max_size);
+    return static_cast<std::size_t>(std::ceil(size * (1. + margin)));
+}
+
+void sizing_profile::record_allocations(
+    std::string_view name, std::size_t n_cells,
+    const std::vector<std::size_t>& sizes) {
+
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        record(allocation_name(name, i), n_cells, sizes[i]);
+    }
+}
+
+std::vector<std::size_t> sizing_profile::estimate_allocations(
+    std::string_view name, std::size_t n_cells, double margin) const {
+
+    std::vector<std::size_t> result;
+    for (std::size_t i = 0;; ++i) {
+        const std::string entry = allocation_name(name, i);
+        if (find_entry(data, entry) == data.end()) {
+            break;
+        }
+        result.push_back(estimate(entry, n_cells, margin));
+    }
+    if (result.empty()) {
+        const std::size_t total = estimate(name, n_cells, margin);
+        if (total > 0) {
+            result.push_back(total);
+        }
+    }
+    // Entries merged from different profiles may not be ordered anymore.
+    std::sort(result.begin(), result.end(), std::greater<std::size_t>());
+    return result;
+}
+
+void sizing_profile::add(const sizing_profile& other) {
+
+    for (const sizing_pair& element : other.data) {
+        auto it = find_entry(data, element.first);
+        if (it == data.end()) {
+            data.push_back(element);
+            continue;
+        }
+        it->second.size_per_cell =
+            std::max(it->second.size_per_cell, element.second.size_per_cell);
+        it->second.max_size =
+            std::max(it->second.max_size, element.second.max_size);
+    }
+}
+
+void sizing_profile::read(const std::string& filename) {
+
+    std::ifstream file(filename);
+    if (!file.good()) {
+        throw std::runtime_error("Could not open sizing profile file: " +
+                                 filename);
+    }
+
+    std::string line;
+    if (!std::getline(file, line) || (line != file_header)) {
+        throw std::invalid_argument("Not a sizing profile file: " + filename);
+    }
+
+    sizing_profile result;
+    while (std::getline(file, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        std::istringstream fields(line);
+        sizing_pair element;
+        if (!(fields >> element.first >> element.second.size_per_cell >>
+              element.second.max_size)) {
+            throw std::invalid_argument("Invalid line in sizing profile " +
+                                        filename + ": " + line);
+        }
+        result.data.push_back(std::move(element));
+    }
+
+    add(result);
+}
+
+void sizing_profile::write(const std::string& filename) const {
+
+    std::ofstream file(filename);
+    if (!file.good()) {
+        throw std::runtime_error("Could not create sizing profile file: " +
+                                 filename);
+    }
+
+    file << file_header << "\n" << std::setprecision(17);
+    for (const sizing_pair& element : data) {
+        file << element.first << " " << element.second.size_per_cell << " "
+             << element.second.max_size << "\n";
+    }
+}
+
+void preallocate(vecmem::memory_resource& mr,
+                 const std::vector<std::size_t>& sizes) {
+
+    std::vector<std::pair<void*, std::size_t>> blocks;
+    blocks.reserve(sizes.size());
+    try {
+        for (std::size_t size : sizes) {
+            if (size > 0) {
+                blocks.emplace_back(mr.allocate(size), size);
+            }
+        }
+    } catch (...) {
+        for (const auto& [ptr, size] : blocks) {
+            mr.deallocate(ptr, size);
+        }
+        throw;
+    }
+    for (const auto& [ptr, size] : blocks) {
+        mr.deallocate(ptr, size);
+    }
+}
+
+std::ostream& operator<<(std::ostream& out, const sizing_profile& profile) {
+
+    for (std::size_t i = 0; i < profile.data.size(); ++i) {
+        const sizing_pair& element = profile.data[i];
+        out << std::setw(30) << std::right << element.first << "  "
+            << element.second.max_size << " max, " << std::fixed
+            << std::setprecision(2) << element.second.size_per_cell
+            << " per cell";
+        if (i + 1 < profile.data.size()) {
+            out << "\n";
+        }
+    }
+    return out;
+}
+
+}  // namespace traccc::performance
@@ -30,6 +30,18 @@ timer::timer(const std::string_view timer_name, timing_info& t_info)
 #endif  // TRACCC_HAVE_NVTX
 }
 
+/// Start time and energy measurement
+timer::timer(const std::string_view timer_name, timing_info& t_info,
+             energy_info& e_info, energy_meter* meter)
+    : timer(timer_name, t_info) {
+
+    if ((meter != nullptr) && meter->available()) {
+        m_energy_info = &e_info;
+        m_meter = meter;
+        m_start_energy = m_meter->read();
+    }
+}
+
 /// End time measurement
 timer::~timer() {
 #ifdef TRACCC_HAVE_NVTX
@@ -48,6 +60,10 @@ timer::~timer() {
     } else {
         pos->second += totalTime;
     }
+
+    if (m_meter != nullptr) {
+        m_energy_info->add(m_name, m_meter->read() - m_start_energy);
+    }
 }
 
 }  // namespace traccc::performance
@@ -0,0 +1,169 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/tuning_profile.hpp"
+
+// System include(s).
+#include <cctype>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+// POSIX include(s).
+#include <unistd.h>
+
+namespace traccc::performance {
+
+namespace {
+
+/// Header line identifying tuning profile files
+const std::string file_header = "# traccc tuning profile v1";
+
+}  // namespace
+
+const tuning_values* tuning_profile::find(const std::string& key) const {
+
+    auto it = data.find(key);
+    return ((it == data.end()) ? nullptr : &(it->second));
+}
+
+void tuning_profile::read(const std::string& filename) {
+
+    std::ifstream file(filename);
+    if (!file.good()) {
+        throw std::runtime_error("Could not open tuning profile file: " +
+                                 filename);
+    }
+
+    std::string line;
+    if (!std::getline(file, line) || (line != file_header)) {
+        throw std::invalid_argument("Not a tuning profile file: " + filename);
+    }
+
+    while (std::getline(file, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        std::istringstream fields(line);
+        std::string key, field;
+        fields >> key;
+        tuning_values values;
+        while (fields >> field) {
+            const std::size_t pos = field.find('=');
+            std::size_t value = 0;
+            std::istringstream value_stream(
+                (pos == std::string::npos) ? "" : field.substr(pos + 1));
+            if ((pos == 0) || !(value_stream >> value)) {
+                throw std::invalid_argument("Invalid line in tuning profile " +
+                                            filename + ": " + line);
+            }
+            values[field.substr(0, pos)] = value;
+        }
+        data[key] = std::move(values);
+    }
+}
+
+void tuning_profile::write(const std::string& filename) const {
+
+    std::ofstream file(filename);
+    if (!file.good()) {
+        throw std::runtime_error("Could not create tuning profile file: " +
+                                 filename);
+    }
+
+    file << file_header << "\n";
+    for (const auto& [key, values] : data) {
+        file << key << " " << to_string(values) << "\n";
+    }
+}
+
+std::string tuning_key(std::string_view backend) {
+
+    char host[256] = {0};
+    if (gethostname(host, sizeof(host) - 1) != 0) {
+        std::snprintf(host, sizeof(host), "unknown");
+    }
+
+    std::string result = std::string(host) + "/" + std::string(backend);
+    for (char& c : result) {
+        if (std::isspace(static_cast<unsigned char>(c)) || (c == '=')) {
+            c = '_';
+        }
+    }
+    return result;
+}
+
+tuning_result autotune(const tuning_values& start, const tuning_space& space,
+                       const tuning_measurement& measure, std::ostream* log) {
+
+    tuning_result result{start, 0., 0};
+    bool found = false;
+
+    // Helper measuring one configuration, and remembering it if it is the
+    // best one so far.
+    auto try_values = [&](const tuning_values& values) {
+        double throughput = 0.;
+        try {
+            throughput = measure(values);
+        } catch (const std::exception& ex) {
+            if (log != nullptr) {
+                (*log) << "  " << to_string(values) << " : skipped ("
+                       << ex.what() << ")" << std::endl;
+            }
+            return;
+        }
+        ++result.measurements;
+        if (log != nullptr) {
+            (*log) << "  " << to_string(values) << " : " << throughput
+                   << " events/s" << std::endl;
+        }
+        if (!found || (throughput > result.throughput)) {
+            result.best = values;
+            result.throughput = throughput;
+            found = true;
+        }
+    };
+
+    // Measure the starting configuration, and then tune the parameters one
+    // by one.
+    try_values(start);
+    for (const auto& [name, candidates] : space) {
+        const tuning_values current = result.best;
+        for (std::size_t candidate : candidates) {
+            auto it = current.find(name);
+            if (found && (it != current.end()) && (it->second == candidate)) {
+                continue;
+            }
+            tuning_values values = current;
+            values[name] = candidate;
+            try_values(values);
+        }
+    }
+
+    if (!found) {
+        throw std::runtime_error(
+            "None of the configurations could be used in the autotuning");
+    }
+    return result;
+}
+
+std::string to_string(const tuning_values& values) {
+
+    std::ostringstream out;
+    bool first = true;
+    for (const auto& [name, value] : values) {
+        out << (first ? "" : " ") << name << "=" << value;
+        first = false;
+    }
+    return out.str();
+}
+
+}  // namespace traccc::performance
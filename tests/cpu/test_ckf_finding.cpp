@@ -0,0 +1,155 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "tests/seed_generator.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/finding/finding_algorithm.hpp"
+#include "traccc/fitting/fitting_algorithm.hpp"
+#include "traccc/io/event_map2.hpp"
+
+// Test include(s).
+#include "tests/kalman_fitting_test.hpp"
+
+// detray include(s).
+#include "detray/detectors/create_telescope_detector.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace traccc;
+
+namespace {
+
+/// Combinatorial Kalman filter test with the telescope geometry
+class CkfFindingTests : public KalmanFittingTests {};
+
+}  // namespace
+
+// Tracks found from truth seeds must pick up the measurements of the particles
+// that the seeds were made from
+TEST_P(CkfFindingTests, Run) {
+
+    // Test Parameters
+    const scalar p0 = std::get<0>(GetParam());
+    const scalar phi0 = std::get<1>(GetParam());
+
+    // Input path
+    const std::string full_path = "detray_simulation/telescope/kf_validation/" +
+                                  std::to_string(p0) + "_GeV_" +
+                                  std::to_string(phi0) + "_phi/";
+
+    /*****************************
+     * Build a telescope geometry
+     *****************************/
+
+    // Memory resource
+    vecmem::host_memory_resource host_mr;
+
+    const host_detector_type det = create_telescope_detector(
+        host_mr,
+        b_field_t(b_field_t::backend_t::configuration_t{B[0], B[1], B[2]}),
+        plane_positions, traj, std::numeric_limits<scalar>::infinity(),
+        std::numeric_limits<scalar>::infinity(), mat, thickness);
+
+    /**********************
+     * Run track finding
+     **********************/
+
+    // Seed generator
+    seed_generator<rk_stepper_type, host_navigator_type> sg(det, stddevs);
+
+    // Finding and fitting algorithms
+    using host_finding_type =
+        finding_algorithm<rk_stepper_type, host_navigator_type>;
+    fitting_algorithm<host_fitter_type> fitting;
+
+    // The measurements are given on modules with their own identifiers, which
+    // the algorithm has to map to the surfaces of the detector
+    constexpr geometry_id module_offset = 1000u;
+    measurement_table::surface_map surfaces;
+    host_finding_type finding({}, surfaces);
+
+    std::size_t n_events = 5;
+
+    // Iterate over events
+    for (std::size_t i_evt = 0; i_evt < n_events; i_evt++) {
+        // Event map
+        traccc::event_map2 evt_map(i_evt, full_path, full_path, full_path);
+
+        // Group all measurements of the event by surface
+        std::map<geometry_id, vecmem::vector<measurement>> meas_map;
+        for (const auto& [ptc, meas_links] : evt_map.ptc_meas_map) {
+            for (const auto& meas_link : meas_links) {
+                meas_map[meas_link.surface_link].push_back(meas_link.meas);
+            }
+        }
+        measurement_container_types::host measurements(&host_mr);
+        for (auto& [surface_link, meas] : meas_map) {
+            cell_module module;
+            module.module = module_offset + surface_link;
+            surfaces[module.module] = surface_link;
+            measurements.push_back(std::move(module), std::move(meas));
+        }
+
+        // Run the finding for each seed separately, to be able to compare
+        // to the truth
+        std::size_t n_particles = 0;
+        std::size_t n_matched = 0;
+        for (const auto& [ptc, meas_links] : evt_map.ptc_meas_map) {
+
+            free_track_parameters vertex(ptc.pos, ptc.time, ptc.mom,
+                                         ptc.charge);
+            bound_track_parameters_collection_types::host seeds(&host_mr);
+            seeds.push_back(sg(vertex));
+
+            const track_candidate_container_types::host track_candidates =
+                finding(det, measurements, seeds);
+            ++n_particles;
+            if (track_candidates.size() == 0) {
+                continue;
+            }
+
+            // Compare the best candidate to the truth
+            const auto& best = track_candidates[0].items;
+            bool matched = (best.size() == meas_links.size());
+            for (std::size_t i = 0; matched && (i < best.size()); ++i) {
+                matched =
+                    (best[i].surface_link == meas_links[i].surface_link) &&
+                    (best[i].meas == meas_links[i].meas);
+            }
+            if (matched) {
+                ++n_matched;
+
+                // The found track must be possible to fit
+                const auto track_states = fitting(det, track_candidates);
+                ASSERT_EQ(track_states.size(), track_candidates.size());
+                EXPECT_EQ(track_states[0].items.size(), best.size());
+            }
+        }
+
+        // n_trakcs = 100
+        ASSERT_EQ(n_particles, 100u);
+        EXPECT_GE(n_matched, 90u);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    CkfFindingValidation, CkfFindingTests,
+    ::testing::Values(std::make_tuple(1 * detray::unit<scalar>::GeV, 0),
+                      std::make_tuple(10 * detray::unit<scalar>::GeV, 0),
+                      std::make_tuple(100 * detray::unit<scalar>::GeV, 0)));
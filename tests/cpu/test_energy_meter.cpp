@@ -0,0 +1,99 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/performance/energy_info.hpp"
+#include "traccc/performance/energy_meter.hpp"
+#include "traccc/performance/timer.hpp"
+#include "traccc/performance/timing_info.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace {
+
+/// Helper writing a single value into a file
+template <typename T>
+void write_value(const std::filesystem::path& filename, const T& value) {
+
+    std::ofstream file(filename);
+    file << value << "\n";
+}
+
+/// Helper creating a fake RAPL zone
+void make_zone(const std::filesystem::path& dir, const std::string& name,
+               std::uint64_t energy, std::uint64_t max_range) {
+
+    std::filesystem::create_directories(dir);
+    write_value(dir / "name", name);
+    write_value(dir / "energy_uj", energy);
+    write_value(dir / "max_energy_range_uj", max_range);
+}
+
+}  // namespace
+
+// Only the package and memory counters must be used, with their wrap-around
+// taken into account.
+TEST(performance, energy_meter) {
+
+    const std::filesystem::path dir =
+        std::filesystem::temp_directory_path() / "traccc_test_powercap";
+    std::filesystem::remove_all(dir);
+    make_zone(dir / "intel-rapl:0", "package-0", 1000000, 10000000);
+    make_zone(dir / "intel-rapl:0:0", "core", 500000, 10000000);
+    make_zone(dir / "intel-rapl:0:1", "dram", 2000000, 10000000);
+    make_zone(dir / "intel-rapl:1", "psys", 7000000, 10000000);
+
+    traccc::performance::energy_meter meter(dir.string());
+    ASSERT_TRUE(meter.available());
+    EXPECT_EQ(meter.domains().size(), 2u);
+    EXPECT_DOUBLE_EQ(meter.read(), 0.);
+
+    // 2 J used by the package, 1 J by the memory.
+    write_value(dir / "intel-rapl:0" / "energy_uj", 3000000);
+    write_value(dir / "intel-rapl:0:0" / "energy_uj", 2500000);
+    write_value(dir / "intel-rapl:0:1" / "energy_uj", 3000000);
+    write_value(dir / "intel-rapl:1" / "energy_uj", 9000000);
+    EXPECT_DOUBLE_EQ(meter.read(), 3.);
+
+    // The package counter wraps around, after using another 8 J.
+    write_value(dir / "intel-rapl:0" / "energy_uj", 1000000);
+    EXPECT_DOUBLE_EQ(meter.read(), 11.);
+
+    // Energy measured through a timer scope.
+    traccc::performance::timing_info times;
+    traccc::performance::energy_info energies;
+    {
+        traccc::performance::timer t{"Stage", times, energies, &meter};
+        write_value(dir / "intel-rapl:0:1" / "energy_uj", 3500000);
+    }
+    EXPECT_DOUBLE_EQ(energies.get_energy("Stage"), 0.5);
+
+    std::filesystem::remove_all(dir);
+}
+
+// A missing interface must not lead to any failure.
+TEST(performance, energy_meter_unavailable) {
+
+    traccc::performance::energy_meter meter("/non/existent/powercap");
+    EXPECT_FALSE(meter.available());
+    EXPECT_DOUBLE_EQ(meter.read(), 0.);
+
+    traccc::performance::timing_info times;
+    traccc::performance::energy_info energies;
+    {
+        traccc::performance::timer t{"Stage", times, energies, &meter};
+    }
+    EXPECT_TRUE(energies.data.empty());
+    EXPECT_EQ(times.data.size(), 1u);
+}
@@ -0,0 +1,138 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/field/constant_field.hpp"
+#include "traccc/field/field_map.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <array>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/// Field that is linear in the position, reproduced exactly by trilinear
+/// interpolation
+std::array<traccc::scalar, 3> linear_field(traccc::scalar x, traccc::scalar y,
+                                           traccc::scalar z) {
+    return {0.5f * x + 1.f, -0.25f * y + 0.1f * z, 2.f + z};
+}
+
+/// Set up a field map holding the linear field on a grid
+traccc::field_map make_linear_map() {
+
+    const std::array<traccc::scalar, 3> min = {-10.f, -20.f, -30.f};
+    const std::array<traccc::scalar, 3> max = {10.f, 20.f, 30.f};
+    const std::array<unsigned int, 3> n_points = {5, 3, 7};
+    std::vector<traccc::field_map::value_type> values;
+    for (unsigned int ix = 0; ix < n_points[0]; ++ix) {
+        for (unsigned int iy = 0; iy < n_points[1]; ++iy) {
+            for (unsigned int iz = 0; iz < n_points[2]; ++iz) {
+                values.push_back(linear_field(
+                    min[0] + 5.f * static_cast<traccc::scalar>(ix),
+                    min[1] + 20.f * static_cast<traccc::scalar>(iy),
+                    min[2] + 10.f * static_cast<traccc::scalar>(iz)));
+            }
+        }
+    }
+    return {min, max, n_points, std::move(values)};
+}
+
+}  // namespace
+
+// The constant field is the same everywhere.
+TEST(field_map, constant_field) {
+
+    const traccc::constant_field field({1.f, 2.f, 3.f});
+    traccc::constant_field::cache_type cache;
+    const traccc::vector3 b = field.at(100.f, -5.f, 7.f, cache);
+    EXPECT_FLOAT_EQ(b[0], 1.f);
+    EXPECT_FLOAT_EQ(b[1], 2.f);
+    EXPECT_FLOAT_EQ(b[2], 3.f);
+}
+
+// Trilinear interpolation reproduces a field linear in the position, with
+// and without re-using the interpolation cell.
+TEST(field_map, interpolation) {
+
+    const traccc::field_map map = make_linear_map();
+    const traccc::field_map_view view = map.view();
+
+    traccc::field_map_view::cache_type cache;
+    for (traccc::scalar x = -9.f; x < 10.f; x += 0.7f) {
+        for (traccc::scalar y = -19.f; y < 20.f; y += 3.1f) {
+            for (traccc::scalar z = -29.f; z < 30.f; z += 4.3f) {
+                const std::array<traccc::scalar, 3> ref =
+                    linear_field(x, y, z);
+                const traccc::vector3 cached = view.at(x, y, z, cache);
+                const traccc::vector3 uncached = view.at(x, y, z);
+                for (unsigned int i = 0; i < 3; ++i) {
+                    EXPECT_NEAR(cached[i], ref[i], 1e-4f);
+                    EXPECT_FLOAT_EQ(cached[i], uncached[i]);
+                }
+            }
+        }
+    }
+}
+
+// Lookups inside the cached cell do not reload it, while the ones outside
+// of it do.
+TEST(field_map, cache) {
+
+    const traccc::field_map map = make_linear_map();
+    const traccc::field_map_view view = map.view();
+
+    traccc::field_map_view::cache_type cache;
+    view.at(1.f, 1.f, 1.f, cache);
+    ASSERT_TRUE(cache.valid);
+    EXPECT_FLOAT_EQ(cache.lower[0], 0.f);
+    EXPECT_FLOAT_EQ(cache.upper[0], 5.f);
+
+    view.at(4.f, 2.f, 3.f, cache);
+    EXPECT_FLOAT_EQ(cache.lower[0], 0.f);
+
+    view.at(6.f, 2.f, 3.f, cache);
+    EXPECT_FLOAT_EQ(cache.lower[0], 5.f);
+    EXPECT_FLOAT_EQ(cache.upper[0], 10.f);
+
+    // The field map with its own cache gives the same values.
+    const traccc::cached_field_map cached(view);
+    const traccc::vector3 b1 = cached.at(6.f, 2.f, 3.f);
+    const traccc::vector3 b2 = view.at(6.f, 2.f, 3.f);
+    for (unsigned int i = 0; i < 3; ++i) {
+        EXPECT_FLOAT_EQ(b1[i], b2[i]);
+    }
+}
+
+// Positions outside of the grid see the field on its boundary.
+TEST(field_map, clamping) {
+
+    const traccc::field_map map = make_linear_map();
+    const traccc::field_map_view view = map.view();
+
+    const traccc::vector3 outside = view.at(50.f, -100.f, 0.f);
+    const std::array<traccc::scalar, 3> ref = linear_field(10.f, -20.f, 0.f);
+    for (unsigned int i = 0; i < 3; ++i) {
+        EXPECT_NEAR(outside[i], ref[i], 1e-4f);
+    }
+}
+
+// Field maps need a consistent grid.
+TEST(field_map, invalid_grid) {
+
+    EXPECT_THROW(traccc::field_map({0.f, 0.f, 0.f}, {1.f, 1.f, 1.f},
+                                   {1, 2, 2}, {}),
+                 std::invalid_argument);
+    EXPECT_THROW(traccc::field_map({0.f, 0.f, 0.f}, {1.f, 1.f, 1.f},
+                                   {2, 2, 2}, {{0.f, 0.f, 1.f}}),
+                 std::invalid_argument);
+}
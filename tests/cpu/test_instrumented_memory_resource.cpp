@@ -0,0 +1,82 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/performance/instrumented_memory_resource.hpp"
+#include "traccc/performance/memory_scope.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// Allocations must be attributed to the innermost active scope.
+TEST(performance, instrumented_memory_resource) {
+
+    vecmem::host_memory_resource host_mr;
+    traccc::performance::instrumented_memory_resource mr{host_mr};
+
+    // Allocate some memory outside of any scope.
+    void* unscoped = mr.allocate(100);
+
+    {
+        traccc::performance::memory_scope outer{"Outer"};
+        vecmem::vector<int> vec1(1000, &mr);
+        {
+            traccc::performance::memory_scope inner{"Inner"};
+            vecmem::vector<int> vec2(500, &mr);
+            vecmem::vector<int> vec3(200, &mr);
+            EXPECT_EQ(traccc::performance::memory_scope::current(), "Inner");
+        }
+        EXPECT_EQ(traccc::performance::memory_scope::current(), "Outer");
+    }
+    EXPECT_TRUE(traccc::performance::memory_scope::current().empty());
+
+    // Check the collected statistics.
+    traccc::performance::memory_profile profile = mr.profile();
+    ASSERT_EQ(profile.data.size(), 3u);
+
+    const auto& unscoped_stage = profile.get(
+        traccc::performance::instrumented_memory_resource::unscoped_name);
+    EXPECT_EQ(unscoped_stage.n_allocations, 1u);
+    EXPECT_EQ(unscoped_stage.current_bytes, 100u);
+
+    const auto& outer_stage = profile.get("Outer");
+    EXPECT_EQ(outer_stage.n_allocations, 1u);
+    EXPECT_EQ(outer_stage.n_deallocations, 1u);
+    EXPECT_EQ(outer_stage.allocated_bytes, 1000 * sizeof(int));
+    EXPECT_EQ(outer_stage.current_bytes, 0u);
+
+    const auto& inner_stage = profile.get("Inner");
+    EXPECT_EQ(inner_stage.n_allocations, 2u);
+    EXPECT_EQ(inner_stage.allocated_bytes, 700 * sizeof(int));
+    EXPECT_EQ(inner_stage.peak_bytes, 700 * sizeof(int));
+    EXPECT_EQ(inner_stage.largest_allocation, 500 * sizeof(int));
+    std::size_t n_lifetimes = 0;
+    for (std::size_t count : inner_stage.lifetime_histogram) {
+        n_lifetimes += count;
+    }
+    EXPECT_EQ(n_lifetimes, 2u);
+
+    // Resetting the statistics must keep the live allocations.
+    mr.reset();
+    profile = mr.profile();
+    EXPECT_EQ(profile.get("Inner").n_allocations, 0u);
+    EXPECT_EQ(profile
+                  .get(traccc::performance::instrumented_memory_resource::
+                           unscoped_name)
+                  .current_bytes,
+              100u);
+    mr.deallocate(unscoped, 100);
+    EXPECT_EQ(mr.profile()
+                  .get(traccc::performance::instrumented_memory_resource::
+                           unscoped_name)
+                  .current_bytes,
+              0u);
+}
@@ -8,7 +8,9 @@
 // Project include(s).
 #include "tests/seed_generator.hpp"
 #include "traccc/edm/track_state.hpp"
+#include "traccc/field/field_map.hpp"
 #include "traccc/fitting/fitting_algorithm.hpp"
+#include "traccc/fitting/fitting_output.hpp"
 #include "traccc/resolution/fitting_performance_writer.hpp"
 
 // Test include(s).
@@ -25,10 +27,33 @@
 #include <gtest/gtest.h>
 
 // System include(s).
+#include <algorithm>
 #include <climits>
+#include <cmath>
+#include <type_traits>
+#include <vector>
 
 using namespace traccc;
 
+namespace {
+
+/// Check that two track parameters are identical
+void expect_same_params(const bound_track_parameters& lhs,
+                        const bound_track_parameters& rhs) {
+
+    EXPECT_EQ(lhs.surface_link(), rhs.surface_link());
+    for (unsigned int i = 0; i < e_bound_size; ++i) {
+        EXPECT_EQ(getter::element(lhs.vector(), i, 0),
+                  getter::element(rhs.vector(), i, 0));
+        for (unsigned int j = 0; j < e_bound_size; ++j) {
+            EXPECT_EQ(getter::element(lhs.covariance(), i, j),
+                      getter::element(rhs.covariance(), i, j));
+        }
+    }
+}
+
+}  // namespace
+
 // This defines the local frame test suite
 TEST_P(KalmanFittingTests, Run) {
 
@@ -71,6 +96,12 @@ TEST_P(KalmanFittingTests, Run) {
     // Fitting algorithm object
     fitting_algorithm<host_fitter_type> fitting;
 
+    // Fitting algorithm objects returning less of the fitted tracks
+    fitting_algorithm<host_fitter_type, fitting_output::smoothed>
+        smoothed_fitting;
+    fitting_algorithm<host_fitter_type, fitting_output::summary>
+        summary_fitting;
+
     std::size_t n_events = 100;
 
     // Iterate over events
@@ -91,6 +122,12 @@ TEST_P(KalmanFittingTests, Run) {
         // Iterator over tracks
         const std::size_t n_tracks = track_states.size();
 
+        // Run the fitting with the trimmed outputs
+        auto smoothed_states = smoothed_fitting(det, track_candidates);
+        auto summaries = summary_fitting(det, track_candidates);
+        ASSERT_EQ(smoothed_states.size(), track_states.size());
+        ASSERT_EQ(summaries.size(), track_states.size());
+
         // n_trakcs = 100
         ASSERT_EQ(n_tracks, 100);
         for (std::size_t i_trk = 0; i_trk < n_tracks; i_trk++) {
@@ -99,6 +136,33 @@ TEST_P(KalmanFittingTests, Run) {
             ASSERT_EQ(track_states_per_track.size(),
                       plane_positions.size() - 2);
 
+            // The track summary
+            const auto& fit_info = track_states[i_trk].header;
+            EXPECT_FLOAT_EQ(
+                fit_info.ndf,
+                static_cast<scalar>(2 * track_states_per_track.size() - 5));
+            EXPECT_GE(fit_info.p_val, 0.f);
+            EXPECT_LE(fit_info.p_val, 1.f);
+            expect_same_params(fit_info.fit_params,
+                               track_states_per_track[0].smoothed());
+
+            // The trimmed outputs must hold the same results.
+            const auto& smoothed_per_track = smoothed_states[i_trk].items;
+            ASSERT_EQ(smoothed_per_track.size(),
+                      track_states_per_track.size());
+            for (std::size_t i_st = 0; i_st < smoothed_per_track.size();
+                 i_st++) {
+                const auto& full = track_states_per_track[i_st];
+                const auto& lean = smoothed_per_track[i_st];
+                expect_same_params(lean.smoothed, full.smoothed());
+                EXPECT_EQ(lean.smoothed_chi2, full.smoothed_chi2());
+            }
+            EXPECT_EQ(smoothed_states[i_trk].header.chi2, fit_info.chi2);
+            EXPECT_TRUE(summaries[i_trk].items.empty());
+            EXPECT_EQ(summaries[i_trk].header.chi2, fit_info.chi2);
+            expect_same_params(summaries[i_trk].header.fit_params,
+                               fit_info.fit_params);
+
             fit_performance_writer.write(track_states_per_track, det, evt_map);
         }
     }
@@ -114,6 +178,80 @@ TEST_P(KalmanFittingTests, Run) {
     pull_value_tests(writer_cfg.file_path, pull_names);
 }
 
+// Fitting in a field map must give the same results as fitting in the
+// (covfie) field of the detector, if the map holds the same field.
+TEST_P(KalmanFittingTests, FieldMap) {
+
+    // Test Parameters
+    const scalar p0 = std::get<0>(GetParam());
+    const scalar phi0 = std::get<1>(GetParam());
+
+    // Input path
+    const std::string full_path = "detray_simulation/telescope/kf_validation/" +
+                                  std::to_string(p0) + "_GeV_" +
+                                  std::to_string(phi0) + "_phi/";
+
+    // Build the telescope geometry.
+    vecmem::host_memory_resource host_mr;
+    const host_detector_type det = create_telescope_detector(
+        host_mr,
+        b_field_t(b_field_t::backend_t::configuration_t{B[0], B[1], B[2]}),
+        plane_positions, traj, std::numeric_limits<scalar>::infinity(),
+        std::numeric_limits<scalar>::infinity(), mat, thickness);
+
+    // Describe the same field with a map. Positions outside of the grid see
+    // its boundary, so a single cell is enough for a uniform field.
+    const field_map map({-1000.f, -1000.f, -1000.f}, {1000.f, 1000.f, 1000.f},
+                        {2, 2, 2},
+                        std::vector<field_map::value_type>(
+                            8, field_map::value_type{B[0], B[1], B[2]}));
+    const cached_field_map field(map.view());
+
+    // The fitter using the field map can not take its field from the
+    // detector.
+    using field_map_stepper_type =
+        detray::rk_stepper<cached_field_map, transform3,
+                           detray::constrained_step<>>;
+    using field_map_fitter_type =
+        kalman_fitter<field_map_stepper_type, host_navigator_type>;
+    static_assert(!std::is_default_constructible_v<
+                  fitting_algorithm<field_map_fitter_type>>);
+
+    // Fit the truth tracks of a few events in both fields.
+    seed_generator<rk_stepper_type, host_navigator_type> sg(det, stddevs);
+    fitting_algorithm<host_fitter_type> fitting;
+    fitting_algorithm<field_map_fitter_type> field_map_fitting(field);
+
+    for (std::size_t i_evt = 0; i_evt < 10; i_evt++) {
+
+        traccc::event_map2 evt_map(i_evt, full_path, full_path, full_path);
+        traccc::track_candidate_container_types::host track_candidates =
+            evt_map.generate_truth_candidates(sg, host_mr);
+
+        const auto track_states = fitting(det, track_candidates);
+        const auto field_map_states = field_map_fitting(det, track_candidates);
+        ASSERT_EQ(field_map_states.size(), track_states.size());
+
+        for (std::size_t i_trk = 0; i_trk < track_states.size(); i_trk++) {
+
+            const auto& fit_info = track_states[i_trk].header;
+            const auto& field_map_info = field_map_states[i_trk].header;
+            ASSERT_EQ(field_map_states[i_trk].items.size(),
+                      track_states[i_trk].items.size());
+            EXPECT_FLOAT_EQ(field_map_info.ndf, fit_info.ndf);
+            EXPECT_NEAR(field_map_info.chi2, fit_info.chi2,
+                        1e-3f * std::max(1.f, fit_info.chi2));
+            for (unsigned int i = 0; i < e_bound_size; ++i) {
+                const scalar ref =
+                    getter::element(fit_info.fit_params.vector(), i, 0);
+                EXPECT_NEAR(
+                    getter::element(field_map_info.fit_params.vector(), i, 0),
+                    ref, 1e-4f * std::max(1.f, std::abs(ref)));
+            }
+        }
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(
     KalmanFitValidation, KalmanFittingTests,
     ::testing::Values(std::make_tuple(1 * detray::unit<scalar>::GeV, 0),
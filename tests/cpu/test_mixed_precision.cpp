@@ -0,0 +1,166 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/track_parametrization.hpp"
+#include "traccc/edm/track_state.hpp"
+#include "traccc/fitting/kalman_filter/gain_matrix_updater.hpp"
+#include "traccc/io/read_geometry.hpp"
+#include "traccc/io/read_spacepoints.hpp"
+#include "traccc/seeding/seeding_algorithm.hpp"
+#include "traccc/seeding/track_params_estimation_helper.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace {
+
+/// Matrix operator of the algebra plugin
+using matrix_operator = traccc::transform3::matrix_actor;
+
+/// Stand-in for a detray mask, providing the projection matrix of a 2D
+/// measurement on a planar surface
+struct planar_mask {
+    template <matrix_operator::size_ty SIZE>
+    matrix_operator::matrix_type<2, SIZE> projection_matrix() const {
+        auto result = matrix_operator().template zero<2, SIZE>();
+        matrix_operator().element(result, 0, 0) = 1.;
+        matrix_operator().element(result, 1, 1) = 1.;
+        return result;
+    }
+};
+
+/// Stand-in for the propagator state used by the Kalman updater
+struct propagation_state {
+    struct {
+        traccc::bound_track_parameters _bound_params;
+    } _stepping;
+};
+
+}  // namespace
+
+// The parameters estimated in the fitting precision must be physically
+// equivalent to the ones estimated in the storage precision, on the seeds of
+// a ttbar event.
+TEST(mixed_precision, parameter_estimation_ttbar) {
+
+    // Memory resource used in the test.
+    vecmem::host_memory_resource host_mr;
+
+    // Read the spacepoints of one event, and find seeds on them.
+    auto surface_transforms =
+        traccc::io::read_geometry("tml_detector/trackml-detector.csv");
+    const traccc::spacepoint_container_types::host spacepoints =
+        traccc::io::read_spacepoints(0, "tml_full/ttbar_mu200/",
+                                     surface_transforms,
+                                     traccc::data_format::csv, &host_mr);
+    traccc::seeding_algorithm sa(host_mr);
+    const traccc::seeding_algorithm::output_type seeds = sa(spacepoints);
+    ASSERT_GT(seeds.size(), 0u);
+
+    // Estimate the parameters of all seeds in both precisions.
+    const traccc::vector3 bfield{0, 0, 2};
+    std::size_t n_qop_outliers = 0;
+    for (const traccc::seed& seed : seeds) {
+        const traccc::bound_vector single =
+            traccc::seed_to_bound_vector<traccc::scalar>(
+                spacepoints, seed, bfield, traccc::PION_MASS_MEV);
+        const traccc::bound_vector mixed = traccc::seed_to_bound_vector(
+            spacepoints, seed, bfield, traccc::PION_MASS_MEV);
+
+        // The local positions are taken from the measurements directly.
+        EXPECT_EQ(matrix_operator().element(single, traccc::e_bound_loc0, 0),
+                  matrix_operator().element(mixed, traccc::e_bound_loc0, 0));
+        EXPECT_EQ(matrix_operator().element(single, traccc::e_bound_loc1, 0),
+                  matrix_operator().element(mixed, traccc::e_bound_loc1, 0));
+
+        // The direction must agree well within the seed resolution.
+        EXPECT_NEAR(matrix_operator().element(single, traccc::e_bound_phi, 0),
+                    matrix_operator().element(mixed, traccc::e_bound_phi, 0),
+                    1e-2);
+        EXPECT_NEAR(
+            matrix_operator().element(single, traccc::e_bound_theta, 0),
+            matrix_operator().element(mixed, traccc::e_bound_theta, 0), 1e-2);
+
+        // The curvature of very straight seeds is sensitive to the
+        // precision, so only the bulk of the seeds is required to agree.
+        const traccc::scalar qop_single =
+            matrix_operator().element(single, traccc::e_bound_qoverp, 0);
+        const traccc::scalar qop_mixed =
+            matrix_operator().element(mixed, traccc::e_bound_qoverp, 0);
+        if (std::abs(qop_single - qop_mixed) > 1e-2 * std::abs(qop_mixed)) {
+            ++n_qop_outliers;
+        }
+    }
+    EXPECT_LT(n_qop_outliers, seeds.size() / 100 + 1);
+}
+
+// The Kalman update in the fitting precision must agree with the one done in
+// the storage precision.
+TEST(mixed_precision, kalman_update) {
+
+    // Set up a measurement and a predicted state.
+    traccc::measurement meas;
+    meas.local = traccc::point2{1.5, -0.8};
+    meas.variance = traccc::variance2{0.0025, 0.0025};
+    traccc::bound_track_parameters predicted;
+    traccc::bound_vector vec = matrix_operator().template zero<6, 1>();
+    matrix_operator().element(vec, traccc::e_bound_loc0, 0) = 1.52;
+    matrix_operator().element(vec, traccc::e_bound_loc1, 0) = -0.75;
+    matrix_operator().element(vec, traccc::e_bound_phi, 0) = 0.3;
+    matrix_operator().element(vec, traccc::e_bound_theta, 0) = 1.2;
+    matrix_operator().element(vec, traccc::e_bound_qoverp, 0) = -0.1;
+    predicted.set_vector(vec);
+    traccc::bound_covariance cov =
+        matrix_operator()
+            .template zero<traccc::e_bound_size, traccc::e_bound_size>();
+    for (unsigned int i = 0; i < traccc::e_bound_size; ++i) {
+        matrix_operator().element(cov, i, i) = 0.01f;
+    }
+    predicted.set_covariance(cov);
+
+    // Run the update in both precisions.
+    const std::array<planar_mask, 1> masks{};
+    traccc::track_state<traccc::transform3> state_single(
+        traccc::track_candidate{0u, meas});
+    traccc::track_state<traccc::transform3> state_mixed(
+        traccc::track_candidate{0u, meas});
+    propagation_state propagation_single, propagation_mixed;
+    propagation_single._stepping._bound_params = predicted;
+    propagation_mixed._stepping._bound_params = predicted;
+    traccc::gain_matrix_updater<traccc::transform3, traccc::transform3>{}(
+        masks, 0u, state_single, propagation_single);
+    traccc::gain_matrix_updater<traccc::transform3>{}(masks, 0u, state_mixed,
+                                                      propagation_mixed);
+
+    // Compare the results.
+    for (unsigned int i = 0; i < traccc::e_bound_size; ++i) {
+        EXPECT_NEAR(
+            matrix_operator().element(state_single.filtered().vector(), i, 0),
+            matrix_operator().element(state_mixed.filtered().vector(), i, 0),
+            1e-5);
+        for (unsigned int j = 0; j < traccc::e_bound_size; ++j) {
+            EXPECT_NEAR(matrix_operator().element(
+                            state_single.filtered().covariance(), i, j),
+                        matrix_operator().element(
+                            state_mixed.filtered().covariance(), i, j),
+                        1e-6);
+        }
+    }
+    EXPECT_NEAR(state_single.filtered_chi2(), state_mixed.filtered_chi2(),
+                1e-3 * state_mixed.filtered_chi2() + 1e-5);
+}
@@ -0,0 +1,175 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/io/read_geometry.hpp"
+#include "traccc/io/read_spacepoints.hpp"
+#include "traccc/seeding/detail/seeding_budget.hpp"
+#include "traccc/seeding/seed_finding.hpp"
+#include "traccc/seeding/spacepoint_binning.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+/// Set up the seed finder and grid configurations used by the test
+void setup_configs(traccc::seedfinder_config& config,
+                   traccc::spacepoint_grid_config& grid_config) {
+
+    traccc::seedfinder_config config_copy = config.toInternalUnits();
+    config.highland = 13.6 * std::sqrt(config_copy.radLengthPerSeed) *
+                      (1 + 0.038 * std::log(config_copy.radLengthPerSeed));
+    float maxScatteringAngle = config.highland / config_copy.minPt;
+    config.maxScatteringAngle2 = maxScatteringAngle * maxScatteringAngle;
+    config.pTPerHelixRadius = 300. * config_copy.bFieldInZ;
+    config.minHelixDiameter2 =
+        std::pow(config_copy.minPt * 2 / config.pTPerHelixRadius, 2);
+    config.pT2perRadius =
+        std::pow(config.highland / config.pTPerHelixRadius, 2);
+
+    grid_config.bFieldInZ = config.bFieldInZ;
+    grid_config.minPt = config.minPt;
+    grid_config.rMax = config.rMax;
+    grid_config.zMax = config.zMax;
+    grid_config.zMin = config.zMin;
+    grid_config.deltaRMax = config.deltaRMax;
+    grid_config.cotThetaMax = config.cotThetaMax;
+    grid_config.impactMax = config.impactMax;
+    grid_config.phiMax = config.phiMax;
+    grid_config.phiMin = config.phiMin;
+    grid_config.phiBinDeflectionCoverage = config.phiBinDeflectionCoverage;
+}
+
+}  // namespace
+
+// Seed finding with a work budget must tighten its cuts, or cap the doublets
+// of the middle spacepoints, when an event is over budget.
+TEST(seeding, work_budget) {
+
+    // Memory resource used in the test.
+    vecmem::host_memory_resource host_mr;
+
+    // Read the spacepoints of one event.
+    auto surface_transforms =
+        traccc::io::read_geometry("tml_detector/trackml-detector.csv");
+    traccc::spacepoint_container_types::host spacepoints =
+        traccc::io::read_spacepoints(0, "tml_full/ttbar_mu200/",
+                                     surface_transforms,
+                                     traccc::data_format::csv, &host_mr);
+
+    // Set up the algorithms.
+    traccc::seedfinder_config config;
+    traccc::spacepoint_grid_config grid_config;
+    setup_configs(config, grid_config);
+    traccc::spacepoint_binning sb(config, grid_config, host_mr);
+    const traccc::sp_grid grid = sb(spacepoints);
+
+    // Without a budget nothing should be done to the seed finding.
+    traccc::seed_finding sf_full(config, traccc::seedfilter_config());
+    const traccc::seed_finding::output_type full_seeds =
+        sf_full(spacepoints, grid);
+    traccc::seeding_budget_report full_report;
+    const traccc::seed_finding::output_type full_seeds_report =
+        sf_full(spacepoints, grid, full_report);
+    EXPECT_EQ(full_report.tightening_steps, 0u);
+    EXPECT_EQ(full_report.capped_spMs, 0u);
+    EXPECT_FALSE(full_report.exceeded);
+    EXPECT_EQ(full_report.initial_doublets, full_report.final_doublets);
+    EXPECT_EQ(full_seeds.size(), full_seeds_report.size());
+    ASSERT_GT(full_report.initial_doublets, 0u);
+    ASSERT_GT(full_report.initial_triplet_candidates, 0u);
+
+    // With a budget of half the doublets, the cuts should get tightened.
+    traccc::seeding_budget budget;
+    budget.max_doublets = full_report.initial_doublets / 2;
+    budget.tightening_factor = 0.5;
+    budget.max_tightening_steps = 10;
+    traccc::seed_finding sf_tight(config, traccc::seedfilter_config(),
+                                  budget);
+    traccc::seeding_budget_report tight_report;
+    const traccc::seed_finding::output_type tight_seeds =
+        sf_tight(spacepoints, grid, tight_report);
+    EXPECT_GT(tight_report.tightening_steps, 0u);
+    EXPECT_FALSE(tight_report.exceeded);
+    EXPECT_LE(tight_report.final_doublets, budget.max_doublets);
+    EXPECT_LT(tight_report.deltaRMax, full_report.deltaRMax);
+    EXPECT_LT(tight_report.impactMax, full_report.impactMax);
+    EXPECT_EQ(tight_report.capped_spMs, 0u);
+    EXPECT_LE(tight_seeds.size(), full_seeds.size());
+
+    // Without tightening steps the doublets should be capped instead.
+    budget.max_tightening_steps = 0;
+    budget.max_doublets_per_spM = 2;
+    traccc::seed_finding sf_capped(config, traccc::seedfilter_config(),
+                                   budget);
+    traccc::seeding_budget_report capped_report;
+    const traccc::seed_finding::output_type capped_seeds =
+        sf_capped(spacepoints, grid, capped_report);
+    EXPECT_EQ(capped_report.tightening_steps, 0u);
+    EXPECT_FALSE(capped_report.exceeded);
+    EXPECT_LE(capped_report.final_doublets, budget.max_doublets);
+    EXPECT_GT(capped_report.capped_spMs, 0u);
+    EXPECT_LT(capped_seeds.size(), full_seeds.size());
+
+    // The triplet candidates should be limited the same way.
+    traccc::seeding_budget triplet_budget;
+    triplet_budget.max_triplet_candidates =
+        full_report.initial_triplet_candidates / 2;
+    triplet_budget.max_tightening_steps = 0;
+    triplet_budget.max_doublets_per_spM = 2;
+    traccc::seed_finding sf_triplets(config, traccc::seedfilter_config(),
+                                     triplet_budget);
+    traccc::seeding_budget_report triplet_report;
+    sf_triplets(spacepoints, grid, triplet_report);
+    EXPECT_FALSE(triplet_report.exceeded);
+    EXPECT_LE(triplet_report.final_triplet_candidates,
+              triplet_budget.max_triplet_candidates);
+    EXPECT_GT(triplet_report.capped_spMs, 0u);
+}
+
+// A budget that cannot be met must be reported, or result in an exception
+// if no report was asked for.
+TEST(seeding, work_budget_exceeded) {
+
+    // Memory resource used in the test.
+    vecmem::host_memory_resource host_mr;
+
+    // Read the spacepoints of one event.
+    auto surface_transforms =
+        traccc::io::read_geometry("tml_detector/trackml-detector.csv");
+    traccc::spacepoint_container_types::host spacepoints =
+        traccc::io::read_spacepoints(0, "tml_full/ttbar_mu200/",
+                                     surface_transforms,
+                                     traccc::data_format::csv, &host_mr);
+
+    // Set up the algorithms, with a budget of a single doublet.
+    traccc::seedfinder_config config;
+    traccc::spacepoint_grid_config grid_config;
+    setup_configs(config, grid_config);
+    traccc::spacepoint_binning sb(config, grid_config, host_mr);
+    const traccc::sp_grid grid = sb(spacepoints);
+    traccc::seeding_budget budget;
+    budget.max_doublets = 1;
+    budget.max_tightening_steps = 1;
+    budget.max_doublets_per_spM = 2;
+    traccc::seed_finding sf(config, traccc::seedfilter_config(), budget);
+
+    traccc::seeding_budget_report report;
+    sf(spacepoints, grid, report);
+    EXPECT_TRUE(report.exceeded);
+    EXPECT_EQ(report.tightening_steps, 1u);
+    EXPECT_GT(report.final_doublets, budget.max_doublets);
+    EXPECT_THROW(sf(spacepoints, grid), std::runtime_error);
+}
@@ -0,0 +1,119 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/edm/internal_spacepoint.hpp"
+#include "traccc/io/read_geometry.hpp"
+#include "traccc/io/read_spacepoints.hpp"
+#include "traccc/seeding/detail/seeding_roi.hpp"
+#include "traccc/seeding/seeding_algorithm.hpp"
+#include "traccc/seeding/seeding_roi_helper.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace {
+
+/// Regular axis with the same interface as the axes of the spacepoint grid
+struct test_axis {
+    traccc::scalar min;
+    traccc::scalar max;
+    unsigned int n_bins;
+
+    unsigned int bins() const { return n_bins; }
+    unsigned int bin(traccc::scalar value) const {
+        const int b = static_cast<int>(
+            std::floor((value - min) / (max - min) * n_bins));
+        return static_cast<unsigned int>(
+            std::clamp(b, 0, static_cast<int>(n_bins) - 1));
+    }
+};
+
+}  // namespace
+
+// Seeding in regions of interest must give the same seeds as the full
+// seeding, filtered on the middle spacepoints of the seeds.
+TEST(seeding, roi_restricted) {
+
+    // Memory resource used in the test.
+    vecmem::host_memory_resource host_mr;
+
+    // Read the spacepoints of one event.
+    auto surface_transforms =
+        traccc::io::read_geometry("tml_detector/trackml-detector.csv");
+    traccc::spacepoint_container_types::host spacepoints =
+        traccc::io::read_spacepoints(0, "tml_full/ttbar_mu200/",
+                                     surface_transforms,
+                                     traccc::data_format::csv, &host_mr);
+
+    // Set up two regions, one of them wrapping around in phi.
+    traccc::seeding_roi_collection_types::host rois{&host_mr};
+    rois.push_back({0.5, 1.5, 0.2, 0.8, -100., 100.});
+    rois.push_back({-1., 0., 3., -3., -200., 50.});
+
+    // Run the full and the restricted seeding.
+    traccc::seeding_algorithm sa(host_mr);
+    const traccc::seeding_algorithm::output_type full_seeds = sa(spacepoints);
+    const traccc::seeding_algorithm::output_type roi_seeds =
+        sa(spacepoints, rois);
+
+    // Filter the full seeds on their middle spacepoints.
+    traccc::seed_collection_types::host expected_seeds{&host_mr};
+    for (const traccc::seed& seed : full_seeds) {
+        const traccc::internal_spacepoint<traccc::spacepoint> spM(
+            spacepoints, seed.spM_link, {0., 0.});
+        if (traccc::is_in_any_roi(rois, spM)) {
+            expected_seeds.push_back(seed);
+        }
+    }
+
+    // Compare the two results.
+    ASSERT_GT(expected_seeds.size(), 0u);
+    ASSERT_LT(expected_seeds.size(), full_seeds.size());
+    ASSERT_EQ(expected_seeds.size(), roi_seeds.size());
+    for (std::size_t i = 0; i < roi_seeds.size(); ++i) {
+        EXPECT_EQ(expected_seeds[i].spB_link, roi_seeds[i].spB_link);
+        EXPECT_EQ(expected_seeds[i].spM_link, roi_seeds[i].spM_link);
+        EXPECT_EQ(expected_seeds[i].spT_link, roi_seeds[i].spT_link);
+        EXPECT_FLOAT_EQ(expected_seeds[i].weight, roi_seeds[i].weight);
+    }
+}
+
+// A region wrapping around in phi, with both of its ends in the same phi
+// bin, covers all phi bins.
+TEST(seeding, roi_wrap_in_one_bin) {
+
+    const traccc::seedfinder_config config;
+    const test_axis phi_axis{-M_PI, M_PI, 10};
+    const test_axis z_axis{-1000., 1000., 4};
+
+    std::vector<traccc::seeding_roi> rois(1);
+    rois[0].phi_min = 0.11f;
+    rois[0].phi_max = 0.1f;
+    ASSERT_EQ(phi_axis.bin(rois[0].phi_min), phi_axis.bin(rois[0].phi_max));
+
+    const std::vector<char> bins = traccc::seeding_roi_helper::middle_bins(
+        config.toInternalUnits(), phi_axis, z_axis, rois);
+    EXPECT_EQ(std::count(bins.begin(), bins.end(), 1),
+              static_cast<std::ptrdiff_t>(bins.size()));
+
+    // Without the wrap-around only that one bin is covered.
+    std::swap(rois[0].phi_min, rois[0].phi_max);
+    const std::vector<char> one_bin = traccc::seeding_roi_helper::middle_bins(
+        config.toInternalUnits(), phi_axis, z_axis, rois);
+    EXPECT_EQ(std::count(one_bin.begin(), one_bin.end(), 1),
+              static_cast<std::ptrdiff_t>(z_axis.bins()));
+}
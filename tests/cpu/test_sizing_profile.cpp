@@ -0,0 +1,126 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/performance/high_water_memory_resource.hpp"
+#include "traccc/performance/sizing_profile.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// The high-water mark must follow the live allocations.
+TEST(performance, high_water_memory_resource) {
+
+    vecmem::host_memory_resource host_mr;
+    traccc::performance::high_water_memory_resource mr{host_mr};
+
+    {
+        vecmem::vector<int> vec1(1000, &mr);
+        {
+            vecmem::vector<int> vec2(500, &mr);
+        }
+        EXPECT_EQ(mr.current(), 1000 * sizeof(int));
+        EXPECT_EQ(mr.peak(), 1500 * sizeof(int));
+
+        const std::vector<std::size_t> largest = mr.largest();
+        ASSERT_EQ(largest.size(), 2u);
+        EXPECT_EQ(largest[0], 1000 * sizeof(int));
+        EXPECT_EQ(largest[1], 500 * sizeof(int));
+
+        mr.reset_peak();
+        EXPECT_EQ(mr.peak(), 1000 * sizeof(int));
+        EXPECT_TRUE(mr.largest().empty());
+    }
+    EXPECT_EQ(mr.current(), 0u);
+
+    // Only the largest allocations are remembered.
+    for (std::size_t i = 1; i <= 2 * mr.n_largest; ++i) {
+        vecmem::vector<char> vec(i, &mr);
+    }
+    const std::vector<std::size_t> largest = mr.largest();
+    ASSERT_EQ(largest.size(), mr.n_largest);
+    EXPECT_EQ(largest.front(), 2 * mr.n_largest);
+    EXPECT_EQ(largest.back(), mr.n_largest + 1);
+}
+
+// Estimates must scale with the event size, and survive a round trip
+// through a file.
+TEST(performance, sizing_profile) {
+
+    traccc::performance::sizing_profile profile;
+    profile.record("buffer", 100, 1000);
+    profile.record("buffer", 200, 1500);
+    EXPECT_EQ(profile.estimate("buffer", 1000, 0.), 10000u);
+    EXPECT_EQ(profile.estimate("buffer", 1000, 0.5), 15000u);
+    EXPECT_EQ(profile.estimate("buffer", 0, 0.), 1500u);
+    EXPECT_EQ(profile.estimate("unknown", 1000), 0u);
+
+    // Merge in a second profile.
+    traccc::performance::sizing_profile other;
+    other.record("buffer", 100, 2000);
+    other.record("other_buffer", 10, 10);
+    profile.add(other);
+    EXPECT_EQ(profile.data.size(), 2u);
+    EXPECT_EQ(profile.estimate("buffer", 1000, 0.), 20000u);
+
+    // Write the profile to a file, and read it back.
+    const std::string filename = "test_sizing_profile.txt";
+    profile.write(filename);
+    traccc::performance::sizing_profile read_back;
+    read_back.read(filename);
+    std::remove(filename.c_str());
+    ASSERT_EQ(read_back.data.size(), profile.data.size());
+    for (std::size_t i = 0; i < profile.data.size(); ++i) {
+        EXPECT_EQ(read_back.data[i].first, profile.data[i].first);
+        EXPECT_DOUBLE_EQ(read_back.data[i].second.size_per_cell,
+                         profile.data[i].second.size_per_cell);
+        EXPECT_EQ(read_back.data[i].second.max_size,
+                  profile.data[i].second.max_size);
+    }
+
+    // Reading a non-existent file must fail.
+    EXPECT_THROW(read_back.read("non_existent_sizing_profile.txt"),
+                 std::runtime_error);
+}
+
+// Every profiled allocation must be made separately, at the same time.
+TEST(performance, sizing_profile_allocations) {
+
+    traccc::performance::sizing_profile profile;
+    profile.record_allocations("memory", 100, {4000, 1000, 100});
+    profile.record_allocations("memory", 100, {3000, 2000});
+    const std::vector<std::size_t> sizes =
+        profile.estimate_allocations("memory", 200, 0.);
+    ASSERT_EQ(sizes.size(), 3u);
+    EXPECT_EQ(sizes[0], 8000u);
+    EXPECT_EQ(sizes[1], 4000u);
+    EXPECT_EQ(sizes[2], 200u);
+
+    // Profiles with just the total size give a single allocation.
+    traccc::performance::sizing_profile total;
+    total.record("memory", 100, 5000);
+    EXPECT_EQ(total.estimate_allocations("memory", 100, 0.),
+              std::vector<std::size_t>{5000u});
+    EXPECT_TRUE(total.estimate_allocations("unknown", 100).empty());
+
+    vecmem::host_memory_resource host_mr;
+    traccc::performance::high_water_memory_resource mr{host_mr};
+    traccc::performance::preallocate(mr, sizes);
+    EXPECT_EQ(mr.peak(), 12200u);
+    EXPECT_EQ(mr.current(), 0u);
+    EXPECT_EQ(mr.largest(), sizes);
+}
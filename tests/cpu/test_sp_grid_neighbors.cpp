@@ -0,0 +1,88 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_grid_neighbors.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <vector>
+
+namespace {
+
+/// Compare the neighbour bin table of a grid shape with the bins that the
+/// grid axes would give for the bin centres
+void check_neighbors(unsigned int n_phi, unsigned int n_z,
+                     const traccc::darray<unsigned long, 2>& scope) {
+
+    // Memory resource used in the test.
+    vecmem::host_memory_resource host_mr;
+
+    // Set up the axes of the grid.
+    const traccc::scalar phi_min = -3.f, phi_max = 3.f;
+    const traccc::scalar z_min = -1000.f, z_max = 1000.f;
+    const detray::axis::circular<> phi_axis{n_phi, phi_min, phi_max, host_mr};
+    const detray::axis::regular<> z_axis{n_z, z_min, z_max, host_mr};
+
+    // Build the table.
+    const traccc::sp_grid_neighbors table =
+        traccc::make_sp_grid_neighbors(n_phi, n_z, scope, &host_mr);
+    ASSERT_EQ(table.offsets.size(), n_phi * n_z + 1);
+    const traccc::sp_grid_neighbors_device neighbors(traccc::get_data(table));
+
+    for (unsigned int z_bin = 0; z_bin < n_z; ++z_bin) {
+        const traccc::scalar z =
+            z_min + (z_bin + 0.5f) * (z_max - z_min) / n_z;
+        for (unsigned int phi_bin = 0; phi_bin < n_phi; ++phi_bin) {
+            const traccc::scalar phi =
+                phi_min + (phi_bin + 0.5f) * (phi_max - phi_min) / n_phi;
+
+            // The bins that the doublet finding used to visit.
+            std::vector<unsigned int> expected;
+            for (auto phi_nb : phi_axis.zone(phi, scope)) {
+                for (auto z_nb : z_axis.zone(z, scope)) {
+                    expected.push_back(phi_nb + z_nb * n_phi);
+                }
+            }
+
+            // The bins in the table.
+            const unsigned int bin = phi_bin + z_bin * n_phi;
+            ASSERT_EQ(neighbors.size(bin), expected.size());
+            for (unsigned int i = 0; i < expected.size(); ++i) {
+                EXPECT_EQ(neighbors.neighbor(bin, i), expected[i]);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+// The neighbourhoods must be the same that the grid axes provide, including
+// the wrap-around of the Phi axis and the edges of the Z axis.
+TEST(seeding, sp_grid_neighbors) {
+
+    check_neighbors(10, 8, {1, 1});
+    check_neighbors(25, 3, {2, 1});
+    check_neighbors(3, 1, {1, 1});
+}
+
+// Without an explicit memory resource the table is built in the default one,
+// which is what the host seed finding relies on.
+TEST(seeding, sp_grid_neighbors_default_resource) {
+
+    const traccc::sp_grid_neighbors table =
+        traccc::make_sp_grid_neighbors(10, 8, {1, 1});
+    ASSERT_EQ(table.offsets.size(), 10u * 8u + 1u);
+    EXPECT_EQ(table.offsets.back(), table.bins.size());
+}
@@ -0,0 +1,229 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/edm/internal_spacepoint.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/io/read_geometry.hpp"
+#include "traccc/io/read_spacepoints.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/seeding/detail/static_seeding_config.hpp"
+#include "traccc/seeding/doublet_finding_helper.hpp"
+#include "traccc/seeding/seed_finding.hpp"
+#include "traccc/seeding/spacepoint_binning.hpp"
+#include "traccc/seeding/static_seed_finding.hpp"
+#include "traccc/seeding/triplet_finding_helper.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+
+/// The compile time configuration tested
+using static_config_type = traccc::static_seedfinder_config<>;
+
+}  // namespace
+
+// The compile time helpers must agree with the standard library.
+TEST(seeding, constexpr_math) {
+
+    for (double x : {0.05, 0.5, 1., 2., 1234.5}) {
+        EXPECT_NEAR(traccc::details::constexpr_sqrt(x), std::sqrt(x),
+                    1e-12 * std::sqrt(x));
+        EXPECT_NEAR(traccc::details::constexpr_log(x), std::log(x), 1e-12);
+    }
+}
+
+// The compile time configuration must describe the same setup as the default
+// runtime configuration.
+TEST(seeding, static_seedfinder_config) {
+
+    // The derived values, calculated the way the seeding algorithms do it.
+    traccc::seedfinder_config config;
+    traccc::seedfinder_config config_copy = config.toInternalUnits();
+    const traccc::scalar highland =
+        13.6 * std::sqrt(config_copy.radLengthPerSeed) *
+        (1 + 0.038 * std::log(config_copy.radLengthPerSeed));
+    const traccc::scalar maxScatteringAngle = highland / config_copy.minPt;
+    const traccc::scalar pTPerHelixRadius = 300. * config_copy.bFieldInZ;
+
+    EXPECT_FLOAT_EQ(static_config_type::highland, highland);
+    EXPECT_FLOAT_EQ(static_config_type::maxScatteringAngle2,
+                    maxScatteringAngle * maxScatteringAngle);
+    EXPECT_FLOAT_EQ(static_config_type::pTPerHelixRadius, pTPerHelixRadius);
+    EXPECT_FLOAT_EQ(
+        static_config_type::minHelixDiameter2,
+        std::pow(config_copy.minPt * 2 / pTPerHelixRadius, 2));
+    EXPECT_FLOAT_EQ(static_config_type::pT2perRadius,
+                    std::pow(highland / pTPerHelixRadius, 2));
+
+    // The parameters, in internal units.
+    const traccc::seedfinder_config runtime_config =
+        static_config_type::runtime_config().toInternalUnits();
+    EXPECT_FLOAT_EQ(runtime_config.minPt, config_copy.minPt);
+    EXPECT_FLOAT_EQ(runtime_config.maxPtScattering,
+                    config_copy.maxPtScattering);
+    EXPECT_FLOAT_EQ(runtime_config.bFieldInZ, config_copy.bFieldInZ);
+    EXPECT_FLOAT_EQ(runtime_config.deltaRMax, config_copy.deltaRMax);
+    EXPECT_FLOAT_EQ(runtime_config.collisionRegionMin,
+                    config_copy.collisionRegionMin);
+    EXPECT_FLOAT_EQ(runtime_config.zMax, config_copy.zMax);
+    EXPECT_EQ(static_config_type::get_max_neighbor_bins(),
+              config.get_max_neighbor_bins());
+}
+
+// The seeding helpers must make the same decisions with both configurations.
+TEST(seeding, static_seedfinder_config_compatibility) {
+
+    using internal_sp = traccc::internal_spacepoint<traccc::spacepoint>;
+
+    // Generate some random spacepoints.
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<traccc::scalar> r_dist(33., 200.);
+    std::uniform_real_distribution<traccc::scalar> phi_dist(-0.1, 0.1);
+    std::uniform_real_distribution<traccc::scalar> z_dist(-300., 300.);
+    std::vector<internal_sp> spacepoints;
+    for (unsigned int i = 0; i < 300; ++i) {
+        const traccc::scalar r = r_dist(gen);
+        const traccc::scalar phi = phi_dist(gen);
+        traccc::spacepoint sp;
+        sp.global =
+            traccc::point3{r * std::cos(phi), r * std::sin(phi), z_dist(gen)};
+        spacepoints.emplace_back(sp, i, traccc::vector2{0., 0.});
+    }
+
+    const traccc::seedfinder_config runtime_config =
+        static_config_type::runtime_config().toInternalUnits();
+    const static_config_type static_config{};
+
+    std::size_t n_doublets = 0, n_triplets = 0;
+    for (const internal_sp& spM : spacepoints) {
+
+        std::vector<traccc::lin_circle> bottoms, tops;
+        for (const internal_sp& sp : spacepoints) {
+            const bool bottom_runtime =
+                traccc::doublet_finding_helper::isCompatible<
+                    traccc::details::spacepoint_type::bottom>(spM, sp,
+                                                              runtime_config);
+            const bool bottom_static =
+                traccc::doublet_finding_helper::isCompatible<
+                    traccc::details::spacepoint_type::bottom>(spM, sp,
+                                                              static_config);
+            ASSERT_EQ(bottom_runtime, bottom_static);
+            if (bottom_runtime) {
+                bottoms.push_back(
+                    traccc::doublet_finding_helper::transform_coordinates<
+                        traccc::details::spacepoint_type::bottom>(spM, sp));
+            }
+            const bool top_runtime =
+                traccc::doublet_finding_helper::isCompatible<
+                    traccc::details::spacepoint_type::top>(spM, sp,
+                                                           runtime_config);
+            const bool top_static =
+                traccc::doublet_finding_helper::isCompatible<
+                    traccc::details::spacepoint_type::top>(spM, sp,
+                                                           static_config);
+            ASSERT_EQ(top_runtime, top_static);
+            if (top_runtime) {
+                tops.push_back(
+                    traccc::doublet_finding_helper::transform_coordinates<
+                        traccc::details::spacepoint_type::top>(spM, sp));
+            }
+        }
+        n_doublets += bottoms.size() + tops.size();
+
+        for (const traccc::lin_circle& lb : bottoms) {
+            const traccc::scalar iSinTheta2 = 1 + lb.cotTheta() * lb.cotTheta();
+            const traccc::scalar scatteringInRegion2 =
+                runtime_config.maxScatteringAngle2 * iSinTheta2;
+            for (const traccc::lin_circle& lt : tops) {
+                traccc::scalar curvature_runtime = 0., impact_runtime = 0.;
+                traccc::scalar curvature_static = 0., impact_static = 0.;
+                const bool triplet_runtime =
+                    traccc::triplet_finding_helper::isCompatible(
+                        spM, lb, lt, runtime_config, iSinTheta2,
+                        scatteringInRegion2, curvature_runtime,
+                        impact_runtime);
+                const bool triplet_static =
+                    traccc::triplet_finding_helper::isCompatible(
+                        spM, lb, lt, static_config, iSinTheta2,
+                        scatteringInRegion2, curvature_static, impact_static);
+                ASSERT_EQ(triplet_runtime, triplet_static);
+                if (triplet_runtime) {
+                    EXPECT_FLOAT_EQ(curvature_runtime, curvature_static);
+                    EXPECT_FLOAT_EQ(impact_runtime, impact_static);
+                    ++n_triplets;
+                }
+            }
+        }
+    }
+
+    // Make sure that the test actually tested something.
+    EXPECT_GT(n_doublets, 0u);
+    EXPECT_GT(n_triplets, 0u);
+}
+
+// The seed finding must find the same seeds with both configurations.
+TEST(seeding, static_seed_finding) {
+
+    // Memory resource used in the test.
+    vecmem::host_memory_resource host_mr;
+
+    // Read the spacepoints of one event.
+    auto surface_transforms =
+        traccc::io::read_geometry("tml_detector/trackml-detector.csv");
+    traccc::spacepoint_container_types::host spacepoints =
+        traccc::io::read_spacepoints(0, "tml_full/ttbar_mu200/",
+                                     surface_transforms,
+                                     traccc::data_format::csv, &host_mr);
+
+    // Set up the grid with the runtime version of the configuration.
+    const traccc::seedfinder_config config =
+        static_config_type::runtime_config();
+    traccc::spacepoint_grid_config grid_config;
+    grid_config.bFieldInZ = config.bFieldInZ;
+    grid_config.minPt = config.minPt;
+    grid_config.rMax = config.rMax;
+    grid_config.zMax = config.zMax;
+    grid_config.zMin = config.zMin;
+    grid_config.deltaRMax = config.deltaRMax;
+    grid_config.cotThetaMax = config.cotThetaMax;
+    grid_config.impactMax = config.impactMax;
+    grid_config.phiMax = config.phiMax;
+    grid_config.phiMin = config.phiMin;
+    grid_config.phiBinDeflectionCoverage = config.phiBinDeflectionCoverage;
+    traccc::spacepoint_binning sb(config, grid_config, host_mr);
+    const traccc::sp_grid grid = sb(spacepoints);
+
+    // Run the seed finding with both configurations.
+    const traccc::seedfilter_config filter_config;
+    traccc::seed_finding sf_runtime(config, filter_config);
+    traccc::static_seed_finding<static_config_type> sf_static(filter_config);
+    const traccc::seed_finding::output_type runtime_seeds =
+        sf_runtime(spacepoints, grid);
+    const traccc::seed_finding::output_type static_seeds =
+        sf_static(spacepoints, grid);
+
+    // Compare the two results.
+    ASSERT_GT(runtime_seeds.size(), 0u);
+    ASSERT_EQ(runtime_seeds.size(), static_seeds.size());
+    for (std::size_t i = 0; i < runtime_seeds.size(); ++i) {
+        EXPECT_EQ(runtime_seeds[i].spB_link, static_seeds[i].spB_link);
+        EXPECT_EQ(runtime_seeds[i].spM_link, static_seeds[i].spM_link);
+        EXPECT_EQ(runtime_seeds[i].spT_link, static_seeds[i].spT_link);
+        EXPECT_FLOAT_EQ(runtime_seeds[i].weight, static_seeds[i].weight);
+        EXPECT_FLOAT_EQ(runtime_seeds[i].z_vertex, static_seeds[i].z_vertex);
+    }
+}
@@ -0,0 +1,202 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/clusterization/clusterization_algorithm.hpp"
+#include "traccc/clusterization/spacepoint_formation.hpp"
+#include "traccc/io/read_cells.hpp"
+#include "traccc/io/read_digitization_config.hpp"
+#include "traccc/io/read_geometry.hpp"
+#include "traccc/seeding/seeding_algorithm.hpp"
+#include "traccc/streaming/time_slice_reconstruction.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <random>
+#include <set>
+#include <utility>
+
+namespace {
+
+/// Feed a cell stream in chunks to the reconstruction, collecting all slices
+traccc::time_slice_reconstruction::output_type run_stream(
+    traccc::time_slice_reconstruction& reco,
+    const traccc::alt_cell_collection_types::host& stream,
+    std::size_t chunk_size, vecmem::memory_resource& mr,
+    std::size_t* max_buffered = nullptr) {
+
+    traccc::time_slice_reconstruction::output_type result;
+    for (std::size_t i = 0; i < stream.size(); i += chunk_size) {
+        traccc::alt_cell_collection_types::host chunk(&mr);
+        chunk.assign(stream.begin() + i,
+                     stream.begin() + std::min(i + chunk_size, stream.size()));
+        for (traccc::time_slice& slice : reco(chunk)) {
+            result.push_back(std::move(slice));
+        }
+        if (max_buffered != nullptr) {
+            *max_buffered = std::max(*max_buffered, reco.buffered_cells());
+        }
+    }
+    for (traccc::time_slice& slice : reco.finish()) {
+        result.push_back(std::move(slice));
+    }
+    return result;
+}
+
+}  // namespace
+
+// Clusters crossing the boundaries of the time slices must be reconstructed
+// exactly once, and the buffered cells must stay bounded.
+TEST(time_slicing, synthetic_stream) {
+
+    // Memory resource used in the test.
+    vecmem::host_memory_resource host_mr;
+
+    // A single module, with default segmentation.
+    traccc::cell_module_collection_types::host modules(&host_mr);
+    modules.push_back({});
+
+    // Create a continuous stream of two-cell clusters, at random times and
+    // at unique positions.
+    const std::size_t n_clusters = 3000;
+    std::mt19937 engine(1234u);
+    std::uniform_real_distribution<traccc::scalar> time_dist(0.f, 10000.f);
+    std::vector<traccc::scalar> times(n_clusters);
+    for (traccc::scalar& t : times) {
+        t = time_dist(engine);
+    }
+    std::sort(times.begin(), times.end());
+    traccc::alt_cell_collection_types::host stream(&host_mr);
+    for (std::size_t i = 0; i < n_clusters; ++i) {
+        const traccc::channel_id ch0 =
+            static_cast<traccc::channel_id>(3 * (i % 300));
+        const traccc::channel_id ch1 =
+            static_cast<traccc::channel_id>(3 * (i / 300));
+        stream.push_back({{ch0, ch1, 1.f, times[i]}, 0u});
+        stream.push_back({{ch0 + 1, ch1, 1.f, times[i] + 0.5f}, 0u});
+    }
+    std::stable_sort(stream.begin(), stream.end(),
+                     [](const traccc::alt_cell& c1,
+                        const traccc::alt_cell& c2) {
+                         return c1.c.time < c2.c.time;
+                     });
+
+    // Reconstruct the stream.
+    traccc::time_slicing_config cfg;
+    cfg.slice_length = 250.f;
+    cfg.overlap = 5.f;
+    traccc::time_slice_reconstruction reco(cfg, modules, host_mr);
+    std::size_t max_buffered = 0;
+    const traccc::time_slice_reconstruction::output_type slices =
+        run_stream(reco, stream, 100, host_mr, &max_buffered);
+
+    // Every cluster has to be found exactly once.
+    std::set<std::pair<traccc::scalar, traccc::scalar>> positions;
+    std::size_t n_measurements = 0;
+    for (const traccc::time_slice& slice : slices) {
+        EXPECT_LE(slice.n_cells, stream.size());
+        for (const auto& module_measurements :
+             slice.measurements.get_items()) {
+            for (const traccc::measurement& meas : module_measurements) {
+                positions.insert({meas.local[0], meas.local[1]});
+                ++n_measurements;
+            }
+        }
+    }
+    EXPECT_EQ(n_measurements, n_clusters);
+    EXPECT_EQ(positions.size(), n_clusters);
+
+    // Only (about) one slice worth of cells may be buffered at any time.
+    EXPECT_LT(max_buffered, stream.size() / 10);
+}
+
+// Events laid out in time, with one event per slice, must give the same
+// results as the per-event reconstruction.
+TEST(time_slicing, ttbar_events) {
+
+    // Memory resource used in the test.
+    vecmem::host_memory_resource host_mr;
+
+    // Read the detector description.
+    const traccc::geometry surface_transforms =
+        traccc::io::read_geometry("tml_detector/trackml-detector.csv");
+    const traccc::digitization_config digi_cfg =
+        traccc::io::read_digitization_config(
+            "tml_detector/default-geometric-config-generic.json");
+
+    // Algorithms for the per-event reconstruction.
+    traccc::clusterization_algorithm ca(host_mr);
+    traccc::spacepoint_formation sf(host_mr);
+    traccc::seeding_algorithm sa(host_mr);
+
+    // Create a stream out of the events, and reconstruct them one by one.
+    const std::size_t n_events = 3;
+    const traccc::scalar event_spacing = 1000.f;
+    traccc::cell_module_collection_types::host modules(&host_mr);
+    std::map<traccc::geometry_id, unsigned int> module_links;
+    traccc::alt_cell_collection_types::host stream(&host_mr);
+    std::vector<std::size_t> event_measurements, event_seeds;
+    for (std::size_t event = 0; event < n_events; ++event) {
+
+        const traccc::cell_container_types::host cells =
+            traccc::io::read_cells(event, "tml_full/ttbar_mu200/",
+                                   traccc::data_format::csv,
+                                   &surface_transforms, &digi_cfg, &host_mr);
+        const traccc::measurement_container_types::host measurements =
+            ca(cells);
+        event_measurements.push_back(measurements.total_size());
+        event_seeds.push_back(sa(sf(measurements)).size());
+
+        for (std::size_t i = 0; i < cells.size(); ++i) {
+            const traccc::cell_module& module = cells.get_headers()[i];
+            auto it = module_links.find(module.module);
+            if (it == module_links.end()) {
+                it = module_links
+                         .insert({module.module,
+                                  static_cast<unsigned int>(modules.size())})
+                         .first;
+                modules.push_back(module);
+            }
+            for (traccc::cell c : cells.get_items()[i]) {
+                c.time = static_cast<traccc::scalar>(event) * event_spacing;
+                stream.push_back({c, it->second});
+            }
+        }
+    }
+
+    // Reconstruct the stream.
+    traccc::time_slicing_config cfg;
+    cfg.slice_length = event_spacing;
+    cfg.overlap = 0.1f * event_spacing;
+    cfg.start_time = -0.5f * event_spacing;
+    traccc::time_slice_reconstruction reco(cfg, modules, host_mr);
+    const traccc::time_slice_reconstruction::output_type slices =
+        run_stream(reco, stream, 10000, host_mr);
+
+    // Compare the results.
+    ASSERT_EQ(slices.size(), n_events);
+    for (std::size_t event = 0; event < n_events; ++event) {
+        EXPECT_EQ(slices[event].index, event);
+        EXPECT_EQ(slices[event].measurements.total_size(),
+                  event_measurements[event]);
+        EXPECT_EQ(slices[event].spacepoints.total_size(),
+                  event_measurements[event]);
+        // The order of the modules is different in the slices, which can
+        // change the seeds slightly.
+        EXPECT_NEAR(static_cast<double>(slices[event].seeds.size()),
+                    static_cast<double>(event_seeds[event]),
+                    0.01 * static_cast<double>(event_seeds[event]));
+    }
+}
@@ -0,0 +1,149 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/track_parametrization.hpp"
+#include "traccc/field/field_map.hpp"
+#include "traccc/io/read_geometry.hpp"
+#include "traccc/io/read_spacepoints.hpp"
+#include "traccc/seeding/seeding_algorithm.hpp"
+#include "traccc/seeding/track_params_estimation.hpp"
+#include "traccc/seeding/track_params_estimation_helper.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+// The batched parameter estimation must reproduce the parameters of the
+// per-seed helper function, on the seeds of a ttbar event.
+TEST(track_params_estimation, batched_ttbar) {
+
+    // Memory resource used in the test.
+    vecmem::host_memory_resource host_mr;
+
+    // Read the spacepoints of one event, and find seeds on them.
+    auto surface_transforms =
+        traccc::io::read_geometry("tml_detector/trackml-detector.csv");
+    const traccc::spacepoint_container_types::host spacepoints =
+        traccc::io::read_spacepoints(0, "tml_full/ttbar_mu200/",
+                                     surface_transforms,
+                                     traccc::data_format::csv, &host_mr);
+    traccc::seeding_algorithm sa(host_mr);
+    const traccc::seeding_algorithm::output_type seeds = sa(spacepoints);
+    // Make sure that multiple, and partially filled blocks are used.
+    ASSERT_GT(seeds.size(), 1000u);
+
+    // Estimate the parameters of all seeds with the algorithm.
+    traccc::track_params_estimation tp(host_mr);
+    const traccc::track_params_estimation::output_type params =
+        tp(spacepoints, seeds);
+    ASSERT_EQ(params.size(), seeds.size());
+
+    // Compare them to the parameters of the helper function.
+    //
+    // The two calculations differ in the rounding of a few operations: the
+    // helper re-derives the Y axis of the seed's frame as Z x X inside of
+    // its transform3, and rotates into the frame with the algebra plugin's
+    // matrix product; it divides by the squared radius in the conformal map
+    // and by the field strength for q/pt, where the batched code multiplies
+    // with precomputed inverses; and it normalizes the direction before
+    // rotating it back, and divides by the velocity for the time. All of
+    // this happens in traccc::fitting_scalar. In double precision these
+    // differences stay well below the single precision of the parameters,
+    // even after the cancellation in the curvature of straight seeds.
+    using matrix_operator = traccc::transform3::matrix_actor;
+    const traccc::vector3 bfield{0, 0, 2};
+    const traccc::scalar tolerance =
+        std::is_same_v<traccc::fitting_scalar, double> ? 1e-6f : 1e-3f;
+    for (std::size_t i = 0; i < seeds.size(); ++i) {
+        const traccc::bound_vector reference = traccc::seed_to_bound_vector(
+            spacepoints, seeds[i], bfield, traccc::PION_MASS_MEV);
+        const traccc::bound_vector& batched = params[i].vector();
+        auto element = [](const traccc::bound_vector& v, unsigned int j) {
+            return matrix_operator().element(v, j, 0);
+        };
+
+        // The local positions are taken from the measurements directly.
+        EXPECT_EQ(element(reference, traccc::e_bound_loc0),
+                  element(batched, traccc::e_bound_loc0));
+        EXPECT_EQ(element(reference, traccc::e_bound_loc1),
+                  element(batched, traccc::e_bound_loc1));
+
+        // Every estimated parameter has to agree.
+        EXPECT_NEAR(std::remainder(element(reference, traccc::e_bound_phi) -
+                                       element(batched, traccc::e_bound_phi),
+                                   2 * M_PI),
+                    0., tolerance * M_PI);
+        EXPECT_NEAR(element(reference, traccc::e_bound_theta),
+                    element(batched, traccc::e_bound_theta),
+                    tolerance * M_PI);
+        EXPECT_NEAR(
+            element(reference, traccc::e_bound_qoverp),
+            element(batched, traccc::e_bound_qoverp),
+            tolerance * std::abs(element(reference, traccc::e_bound_qoverp)));
+        EXPECT_NEAR(
+            element(reference, traccc::e_bound_time),
+            element(batched, traccc::e_bound_time),
+            tolerance * std::abs(element(reference, traccc::e_bound_time)));
+    }
+}
+
+// With a uniform field map the per-seed field lookup must reproduce the
+// parameters of the helper function with the same (constant) field.
+TEST(track_params_estimation, uniform_field_map_ttbar) {
+
+    // Memory resource used in the test.
+    vecmem::host_memory_resource host_mr;
+
+    // Read the spacepoints of one event, and find seeds on them.
+    auto surface_transforms =
+        traccc::io::read_geometry("tml_detector/trackml-detector.csv");
+    const traccc::spacepoint_container_types::host spacepoints =
+        traccc::io::read_spacepoints(0, "tml_full/ttbar_mu200/",
+                                     surface_transforms,
+                                     traccc::data_format::csv, &host_mr);
+    traccc::seeding_algorithm sa(host_mr);
+    const traccc::seeding_algorithm::output_type seeds = sa(spacepoints);
+    ASSERT_GT(seeds.size(), 0u);
+
+    // A 2 T field along z, covering the whole detector.
+    const traccc::scalar bz =
+        static_cast<traccc::scalar>(2. * Acts::UnitConstants::T);
+    const traccc::field_map map(
+        {-1200.f, -1200.f, -3200.f}, {1200.f, 1200.f, 3200.f}, {3, 3, 5},
+        std::vector<traccc::field_map::value_type>(3 * 3 * 5, {0.f, 0.f, bz}));
+
+    traccc::field_map_track_params_estimation tp(host_mr, map.view());
+    const traccc::field_map_track_params_estimation::output_type params =
+        tp(spacepoints, seeds);
+    ASSERT_EQ(params.size(), seeds.size());
+
+    using matrix_operator = traccc::transform3::matrix_actor;
+    const traccc::vector3 bfield{0, 0, 2};
+    for (std::size_t i = 0; i < seeds.size(); ++i) {
+        const traccc::bound_vector reference = traccc::seed_to_bound_vector(
+            spacepoints, seeds[i], bfield, traccc::PION_MASS_MEV);
+        const traccc::bound_vector& estimated = params[i].vector();
+        for (unsigned int j = 0; j < traccc::e_bound_size; ++j) {
+            const traccc::scalar ref =
+                matrix_operator().element(reference, j, 0);
+            EXPECT_NEAR(matrix_operator().element(estimated, j, 0), ref,
+                        1e-4 * std::max<traccc::scalar>(std::abs(ref), 1));
+        }
+    }
+}
@@ -0,0 +1,88 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/performance/tuning_profile.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+// The calibration sweep must find the best configuration of independent
+// parameters, and skip the configurations that can not be used.
+TEST(performance, autotune) {
+
+    // Throughput peaking at a=4 and b=64, with b=256 being unusable.
+    std::size_t n_calls = 0;
+    auto measure = [&n_calls](const traccc::performance::tuning_values& v) {
+        ++n_calls;
+        const std::size_t a = v.at("a"), b = v.at("b");
+        if (b == 256) {
+            throw std::runtime_error("Unusable configuration");
+        }
+        const double da = static_cast<double>(a) - 4.;
+        const double db = static_cast<double>(b) - 64.;
+        return 1000. - da * da - 0.01 * db * db;
+    };
+
+    const traccc::performance::tuning_result result =
+        traccc::performance::autotune(
+            {{"a", 1}, {"b", 32}, {"c", 7}},
+            {{"a", {1, 2, 4, 8}}, {"b", {32, 64, 128, 256}}}, measure);
+    EXPECT_EQ(result.best.at("a"), 4u);
+    EXPECT_EQ(result.best.at("b"), 64u);
+    EXPECT_EQ(result.best.at("c"), 7u);
+    EXPECT_DOUBLE_EQ(result.throughput, 1000.);
+    // The starting point, 3 more values of "a" and 3 more values of "b",
+    // out of which one is unusable.
+    EXPECT_EQ(n_calls, 7u);
+    EXPECT_EQ(result.measurements, 6u);
+
+    // If nothing can be used, the sweep must fail.
+    EXPECT_THROW(traccc::performance::autotune(
+                     {{"b", 256}}, {{"b", {256}}}, measure),
+                 std::runtime_error);
+}
+
+// Tuned values must survive a round trip through a file, with the entries
+// of different hosts/backends kept separate.
+TEST(performance, tuning_profile) {
+
+    const std::string key1 = traccc::performance::tuning_key("CUDA GPU");
+    const std::string key2 = traccc::performance::tuning_key("SYCL=GPU");
+    EXPECT_EQ(key1.find(' '), std::string::npos);
+    EXPECT_EQ(key2.find('='), std::string::npos);
+    EXPECT_NE(key1, key2);
+
+    traccc::performance::tuning_profile profile;
+    profile.data[key1] = {{"threads", 4}, {"target_cells_per_partition", 2048}};
+    profile.data[key2] = {{"threads", 1}};
+    EXPECT_EQ(traccc::performance::to_string(profile.data[key1]),
+              "target_cells_per_partition=2048 threads=4");
+    EXPECT_EQ(profile.find("unknown"), nullptr);
+
+    // Write the profile to a file, and read it back.
+    const std::string filename = "test_tuning_profile.txt";
+    profile.write(filename);
+    traccc::performance::tuning_profile read_back;
+    read_back.data[key2] = {{"threads", 8}};
+    read_back.read(filename);
+    std::remove(filename.c_str());
+    ASSERT_EQ(read_back.data.size(), 2u);
+    ASSERT_NE(read_back.find(key1), nullptr);
+    EXPECT_EQ(*(read_back.find(key1)), profile.data[key1]);
+    ASSERT_NE(read_back.find(key2), nullptr);
+    EXPECT_EQ(read_back.find(key2)->at("threads"), 1u);
+
+    // Reading a non-existent file must fail.
+    EXPECT_THROW(read_back.read("non_existent_tuning_profile.txt"),
+                 std::runtime_error);
+}
@@ -0,0 +1,102 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/io/batch_reader.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+/// Create some files with different sizes and contents
+std::vector<std::string> make_files(const std::filesystem::path& dir,
+                                    std::vector<std::string>& contents) {
+
+    std::filesystem::create_directories(dir);
+    std::vector<std::string> filenames;
+    for (std::size_t i = 0; i < 100; ++i) {
+        // Include an empty file, and files crossing page boundaries.
+        std::string content;
+        for (std::size_t j = 0; j < i * 397; ++j) {
+            content.push_back(static_cast<char>((i + j) % 251));
+        }
+        const std::string filename =
+            (dir / ("file" + std::to_string(i) + ".dat")).string();
+        std::ofstream(filename, std::ios::binary) << content;
+        filenames.push_back(filename);
+        contents.push_back(content);
+    }
+    return filenames;
+}
+
+/// Test reading the files with a given backend
+void test_backend(traccc::io::batch_reader::backend backend) {
+
+    const std::filesystem::path dir =
+        std::filesystem::temp_directory_path() / "traccc_test_batch_reader";
+    std::vector<std::string> contents;
+    const std::vector<std::string> filenames = make_files(dir, contents);
+
+    // Read the files with a queue smaller than the number of files.
+    const traccc::io::batch_reader reader{backend, 8, 4};
+    if (backend == traccc::io::batch_reader::backend::pread) {
+        EXPECT_EQ(reader.active_backend(), backend);
+    }
+    std::vector<std::string> result(filenames.size());
+    std::vector<int> calls(filenames.size(), 0);
+    std::mutex mutex;
+    reader.read(filenames,
+                [&](std::size_t index, const char* data, std::size_t size) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    result.at(index).assign(data, size);
+                    ++calls.at(index);
+                });
+    for (std::size_t i = 0; i < filenames.size(); ++i) {
+        EXPECT_EQ(calls[i], 1);
+        EXPECT_EQ(result[i], contents[i]);
+    }
+
+    // Errors from the callback must reach the caller.
+    EXPECT_THROW(reader.read(filenames,
+                             [](std::size_t index, const char*, std::size_t) {
+                                 if (index == 42) {
+                                     throw std::runtime_error("Test error");
+                                 }
+                             }),
+                 std::runtime_error);
+
+    // Just like missing files.
+    std::vector<std::string> missing = filenames;
+    missing.at(17) = (dir / "missing.dat").string();
+    EXPECT_THROW(
+        reader.read(missing, [](std::size_t, const char*, std::size_t) {}),
+        std::runtime_error);
+
+    std::filesystem::remove_all(dir);
+}
+
+}  // namespace
+
+TEST(io_batch_reader, automatic) {
+
+    test_backend(traccc::io::batch_reader::backend::automatic);
+}
+
+TEST(io_batch_reader, pread) {
+
+    test_backend(traccc::io::batch_reader::backend::pread);
+}
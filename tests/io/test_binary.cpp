@@ -6,11 +6,16 @@
  */
 
 // Project include(s).
+#include "traccc/io/detector_snapshot.hpp"
+#include "traccc/io/cell_compression.hpp"
+#include "traccc/io/details/read_surfaces.hpp"
+#include "traccc/io/event_archive.hpp"
 #include "traccc/io/read_cells.hpp"
 #include "traccc/io/read_digitization_config.hpp"
 #include "traccc/io/read_geometry.hpp"
 #include "traccc/io/read_measurements.hpp"
 #include "traccc/io/read_spacepoints.hpp"
+#include "traccc/io/read_track_candidates.hpp"
 #include "traccc/io/utils.hpp"
 #include "traccc/io/write.hpp"
 
@@ -23,6 +28,7 @@
 // System
 #include <cstdio>
 #include <fstream>
+#include <vector>
 
 // This defines the local frame test suite for binary cell container
 TEST(io_binary, cell) {
@@ -91,6 +97,88 @@ TEST(io_binary, cell) {
     }
 }
 
+// This defines the test suite for the compressed binary cell format
+TEST(io_binary, compressed_cell) {
+
+    // Set event configuration
+    const std::size_t event = 0;
+    const std::string cells_directory = "tml_full/ttbar_mu200/";
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Read the detector description
+    auto surface_transforms =
+        traccc::io::read_geometry("tml_detector/trackml-detector.csv");
+    auto digi_cfg = traccc::io::read_digitization_config(
+        "tml_detector/default-geometric-config-generic.json");
+
+    // Read csv file
+    traccc::cell_container_types::host cells_csv =
+        traccc::io::read_cells(event, cells_directory, traccc::data_format::csv,
+                               &surface_transforms, &digi_cfg, &host_mr);
+
+    // Write and read back a losslessly compressed file
+    traccc::io::write(event, cells_directory, traccc::data_format::compressed,
+                      traccc::get_data(cells_csv));
+    traccc::cell_container_types::host cells_compressed =
+        traccc::io::read_cells(event, cells_directory,
+                               traccc::data_format::compressed,
+                               &surface_transforms, &digi_cfg, &host_mr);
+
+    // Delete the compressed file
+    std::string io_cells_file =
+        traccc::io::data_directory() + cells_directory +
+        traccc::io::get_event_filename(event, "-cells.cdat");
+    std::remove(io_cells_file.c_str());
+
+    ASSERT_TRUE(!std::ifstream(io_cells_file));
+
+    // Compress the cells with quantized activations
+    traccc::io::cell_compression_config quantized;
+    quantized.activation_bits = 24;
+    const std::vector<char> quantized_data =
+        traccc::io::compress_cells(traccc::get_data(cells_csv), quantized);
+    traccc::cell_container_types::host cells_quantized =
+        traccc::io::decompress_cells(quantized_data.data(),
+                                     quantized_data.size(), &host_mr);
+
+    // Check header size
+    ASSERT_TRUE(cells_csv.size() > 0);
+    ASSERT_EQ(cells_csv.size(), cells_compressed.size());
+    ASSERT_EQ(cells_csv.size(), cells_quantized.size());
+
+    for (std::size_t i = 0; i < cells_csv.size(); i++) {
+
+        // Check header content
+        ASSERT_EQ(cells_csv.get_headers()[i].module,
+                  cells_compressed.get_headers()[i].module);
+        ASSERT_EQ(cells_csv.get_headers()[i].placement,
+                  cells_compressed.get_headers()[i].placement);
+        ASSERT_EQ(cells_csv.get_headers()[i].module,
+                  cells_quantized.get_headers()[i].module);
+
+        auto& items_csv = cells_csv.get_items()[i];
+        auto& items_compressed = cells_compressed.get_items()[i];
+        auto& items_quantized = cells_quantized.get_items()[i];
+
+        // Check item size
+        ASSERT_EQ(items_csv.size(), items_compressed.size());
+        ASSERT_EQ(items_csv.size(), items_quantized.size());
+
+        // Check item contents
+        for (std::size_t j = 0; j < items_csv.size(); j++) {
+            ASSERT_EQ(items_csv[j], items_compressed[j]);
+            ASSERT_EQ(items_csv[j].activation, items_compressed[j].activation);
+            ASSERT_EQ(items_csv[j], items_quantized[j]);
+        }
+    }
+
+    // Check that the quantized encoding is smaller than the lossless one
+    EXPECT_LT(quantized_data.size(),
+              traccc::io::compress_cells(traccc::get_data(cells_csv)).size());
+}
+
 // This defines the local frame test suite for binary spacepoint container
 TEST(io_binary, spacepoint) {
 
@@ -210,4 +298,252 @@ TEST(io_binary, measurement) {
             ASSERT_EQ(items_csv[j], items_bin[j]);
         }
     }
-}
\ No newline at end of file
+}
+// This defines the test suite for the binary detector snapshot
+TEST(io_binary, detector_snapshot) {
+
+    // Set event configuration
+    const std::size_t event = 0;
+    const std::string cells_directory = "tml_full/ttbar_mu200/";
+    const std::string snapshot_file = "tml_detector/trackml-detector.snap";
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Read the surface transforms
+    auto surface_map = traccc::io::details::read_surfaces(
+        traccc::io::data_directory() + "tml_detector/trackml-detector.csv");
+    traccc::geometry surface_transforms{surface_map};
+
+    // Read the digitization configuration file
+    auto digi_cfg = traccc::io::read_digitization_config(
+        "tml_detector/default-geometric-config-generic.json");
+
+    // Write and map the snapshot file
+    traccc::io::write_detector_snapshot(snapshot_file, surface_map, digi_cfg);
+    traccc::io::detector_snapshot snapshot{snapshot_file};
+
+    // Delete the snapshot file. (The mapping stays valid.)
+    std::string io_snapshot_file = traccc::io::data_directory() + snapshot_file;
+    std::remove(io_snapshot_file.c_str());
+
+    ASSERT_TRUE(!std::ifstream(io_snapshot_file));
+    ASSERT_EQ(snapshot.size(), surface_map.size());
+    ASSERT_FALSE(snapshot.contains(0u));
+
+    // Read the cells using the two different module descriptions
+    traccc::cell_container_types::host cells_csv =
+        traccc::io::read_cells(event, cells_directory, traccc::data_format::csv,
+                               &surface_transforms, &digi_cfg, &host_mr);
+    traccc::cell_container_types::host cells_snapshot = traccc::io::read_cells(
+        event, cells_directory, snapshot, traccc::data_format::csv, &host_mr);
+
+    // Check header size
+    ASSERT_TRUE(cells_csv.size() > 0);
+    ASSERT_EQ(cells_csv.size(), cells_snapshot.size());
+
+    auto& headers_csv = cells_csv.get_headers();
+    auto& headers_snapshot = cells_snapshot.get_headers();
+
+    for (std::size_t i = 0; i < cells_csv.size(); i++) {
+
+        // Check header content
+        ASSERT_EQ(headers_csv[i].module, headers_snapshot[i].module);
+        ASSERT_EQ(headers_csv[i].placement, headers_snapshot[i].placement);
+        ASSERT_EQ(headers_csv[i].threshold, headers_snapshot[i].threshold);
+        ASSERT_EQ(headers_csv[i].pixel.min_center_x,
+                  headers_snapshot[i].pixel.min_center_x);
+        ASSERT_EQ(headers_csv[i].pixel.min_center_y,
+                  headers_snapshot[i].pixel.min_center_y);
+        ASSERT_EQ(headers_csv[i].pixel.pitch_x,
+                  headers_snapshot[i].pixel.pitch_x);
+        ASSERT_EQ(headers_csv[i].pixel.pitch_y,
+                  headers_snapshot[i].pixel.pitch_y);
+
+        // Check item size
+        ASSERT_EQ(cells_csv.get_items()[i].size(),
+                  cells_snapshot.get_items()[i].size());
+    }
+
+    // Write a snapshot with a non-zero threshold for every module
+    std::vector<traccc::digitization_config::InputElement> threshold_elements;
+    for (std::size_t i = 0; i < digi_cfg.size(); ++i) {
+        traccc::module_digitization_config module_cfg = digi_cfg.valueAt(i);
+        module_cfg.threshold = 0.25f;
+        threshold_elements.emplace_back(digi_cfg.idAt(i), module_cfg);
+    }
+    const traccc::digitization_config threshold_cfg(threshold_elements);
+    traccc::io::write_detector_snapshot(snapshot_file, surface_map,
+                                        threshold_cfg);
+    traccc::io::detector_snapshot threshold_snapshot{snapshot_file};
+    std::remove(io_snapshot_file.c_str());
+
+    // Check that the threshold made it through the file
+    for (const auto& [id, placement] : surface_map) {
+        ASSERT_EQ(threshold_snapshot.at(id).threshold, 0.25f);
+    }
+}
+
+// This defines the test suite for the single-file event archive
+TEST(io_binary, event_archive) {
+
+    // Set event configuration
+    const std::size_t n_events = 2;
+    const std::string cells_directory = "tml_full/ttbar_mu200/";
+    const std::string archive_file = "tml_full/ttbar_mu200/events.archive";
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Read the detector description
+    auto surface_transforms =
+        traccc::io::read_geometry("tml_detector/trackml-detector.csv");
+    auto digi_cfg = traccc::io::read_digitization_config(
+        "tml_detector/default-geometric-config-generic.json");
+
+    // Read the csv files, and pack them into an archive
+    std::vector<traccc::cell_container_types::host> cells_csv;
+    std::vector<traccc::measurement_container_types::host> measurements_csv;
+    {
+        traccc::io::event_archive_writer writer{archive_file};
+        for (std::size_t event = 0; event < n_events; ++event) {
+            cells_csv.push_back(traccc::io::read_cells(
+                event, cells_directory, traccc::data_format::csv,
+                &surface_transforms, &digi_cfg, &host_mr));
+            measurements_csv.push_back(traccc::io::read_measurements(
+                event, cells_directory, traccc::data_format::csv, &host_mr));
+            writer.add(event, cells_csv.back(), nullptr,
+                       &measurements_csv.back());
+        }
+        writer.close();
+    }
+
+    // Open the archive, and delete the file. (The file descriptor stays
+    // valid.)
+    const traccc::io::event_archive archive{archive_file};
+    std::string io_archive_file = traccc::io::data_directory() + archive_file;
+    std::remove(io_archive_file.c_str());
+
+    ASSERT_TRUE(!std::ifstream(io_archive_file));
+    ASSERT_EQ(archive.size(), n_events);
+
+    // Compare the events in reverse order, to exercise the random access
+    for (std::size_t event = n_events; event-- > 0;) {
+
+        ASSERT_EQ(archive.entry(event).event, event);
+        EXPECT_THROW(archive.read_spacepoints(event), std::runtime_error);
+
+        // Check the cells
+        traccc::cell_container_types::host cells_archive =
+            archive.read_cells(event, &host_mr);
+        ASSERT_TRUE(cells_csv[event].size() > 0);
+        ASSERT_EQ(cells_csv[event].size(), cells_archive.size());
+        for (std::size_t i = 0; i < cells_archive.size(); i++) {
+            ASSERT_EQ(cells_csv[event].get_headers()[i].module,
+                      cells_archive.get_headers()[i].module);
+            ASSERT_EQ(cells_csv[event].get_headers()[i].placement,
+                      cells_archive.get_headers()[i].placement);
+            ASSERT_EQ(cells_csv[event].get_items()[i].size(),
+                      cells_archive.get_items()[i].size());
+            for (std::size_t j = 0; j < cells_archive.get_items()[i].size();
+                 j++) {
+                ASSERT_EQ(cells_csv[event].get_items()[i][j],
+                          cells_archive.get_items()[i][j]);
+            }
+        }
+
+        // Check the measurements
+        traccc::measurement_container_types::host measurements_archive =
+            archive.read_measurements(event, &host_mr);
+        ASSERT_EQ(measurements_csv[event].size(), measurements_archive.size());
+        ASSERT_EQ(measurements_csv[event].total_size(),
+                  measurements_archive.total_size());
+
+        // Check the "alt" format of the cells
+        traccc::alt_cell_reader_output_t alt_cells =
+            archive.read_cells_alt(event, &host_mr);
+        ASSERT_EQ(alt_cells.modules.size(), cells_archive.size());
+        ASSERT_EQ(alt_cells.cells.size(), cells_archive.total_size());
+    }
+}
+
+// This defines the test suite for binary track candidate files, and for
+// archives of events without cells
+TEST(io_binary, track_candidates) {
+
+    // Set event configuration
+    const std::size_t event = 0;
+    const std::string directory = "tml_full/ttbar_mu200/";
+    const std::string archive_file =
+        "tml_full/ttbar_mu200/track_candidates.archive";
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Create some track candidates.
+    using matrix_operator = traccc::transform3::matrix_actor;
+    traccc::track_candidate_container_types::host candidates(&host_mr);
+    for (unsigned int i = 0; i < 5; ++i) {
+        traccc::bound_track_parameters seed;
+        traccc::bound_vector vec =
+            matrix_operator().template zero<traccc::e_bound_size, 1>();
+        matrix_operator().element(vec, traccc::e_bound_qoverp, 0) =
+            -1.f / static_cast<traccc::scalar>(i + 1);
+        seed.set_vector(vec);
+
+        vecmem::vector<traccc::track_candidate> items(&host_mr);
+        for (unsigned int j = 0; j < i + 2; ++j) {
+            traccc::measurement meas;
+            meas.local = {0.1f * static_cast<traccc::scalar>(j),
+                          -0.2f * static_cast<traccc::scalar>(i)};
+            meas.variance = {0.0025f, 0.0025f};
+            items.push_back({j, meas});
+        }
+        candidates.push_back(std::move(seed), std::move(items));
+    }
+
+    // Compare two track candidate containers.
+    const auto compare =
+        [](const traccc::track_candidate_container_types::host& lhs,
+           const traccc::track_candidate_container_types::host& rhs) {
+            ASSERT_EQ(lhs.size(), rhs.size());
+            for (std::size_t i = 0; i < lhs.size(); ++i) {
+                EXPECT_EQ(matrix_operator().element(
+                              lhs.get_headers()[i].vector(),
+                              traccc::e_bound_qoverp, 0),
+                          matrix_operator().element(
+                              rhs.get_headers()[i].vector(),
+                              traccc::e_bound_qoverp, 0));
+                ASSERT_EQ(lhs.get_items()[i].size(),
+                          rhs.get_items()[i].size());
+                for (std::size_t j = 0; j < lhs.get_items()[i].size(); ++j) {
+                    EXPECT_EQ(lhs.get_items()[i][j].surface_link,
+                              rhs.get_items()[i][j].surface_link);
+                    EXPECT_EQ(lhs.get_items()[i][j].meas,
+                              rhs.get_items()[i][j].meas);
+                }
+            }
+        };
+
+    // Write and read back a binary file.
+    traccc::io::write(event, directory, traccc::data_format::binary,
+                      traccc::get_data(candidates));
+    compare(candidates,
+            traccc::io::read_track_candidates(
+                event, directory, traccc::data_format::binary, &host_mr));
+
+    // Write and read back an archive.
+    {
+        traccc::io::event_archive_writer writer{archive_file};
+        writer.add(event, candidates);
+        writer.close();
+    }
+    const traccc::io::event_archive archive{archive_file};
+    std::string io_archive_file = traccc::io::data_directory() + archive_file;
+    std::remove(io_archive_file.c_str());
+
+    ASSERT_EQ(archive.size(), 1u);
+    EXPECT_THROW(archive.read_cells(0), std::runtime_error);
+    EXPECT_THROW(archive.read_measurements(0), std::runtime_error);
+    compare(candidates, archive.read_track_candidates(0, &host_mr));
+}
@@ -120,6 +120,22 @@ TEST_F(io, csv_read_cells_alt) {
         }
     }
     EXPECT_EQ(k, alt_cells_csv.size());
+
+    // Read csv file to structure-of-arrays cells + collection of modules
+    traccc::alt_cell_soa_reader_output_t soa_cells_modules_csv =
+        traccc::io::read_cells_alt_soa(event, cells_directory,
+                                       traccc::data_format::csv,
+                                       &surface_transforms, &digi_cfg,
+                                       &host_mr);
+    const traccc::alt_cell_soa_types::host& soa_cells_csv =
+        soa_cells_modules_csv.cells;
+    ASSERT_EQ(soa_cells_csv.size(), alt_cells_csv.size());
+    EXPECT_EQ(soa_cells_modules_csv.modules.size(), alt_modules_csv.size());
+    for (unsigned int i = 0; i < soa_cells_csv.size(); ++i) {
+        const traccc::alt_cell c = soa_cells_csv.get(i);
+        EXPECT_EQ(c.c, alt_cells_csv[i].c);
+        EXPECT_EQ(c.module_link, alt_cells_csv[i].module_link);
+    }
 }
 
 // This reads in the tml pixel barrel first event
@@ -0,0 +1,98 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/io/output_stream.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Test writing seeds and track parameters from multiple threads
+TEST(io_output_stream, seeds_and_track_parameters) {
+
+    const std::string filename = "test_output_stream.dat";
+    std::remove(filename.c_str());
+
+    static constexpr std::size_t n_events = 50;
+    static constexpr std::size_t n_threads = 4;
+
+    // Write the products of a number of events, using small buffers to make
+    // sure that the buffers are swapped many times.
+    vecmem::host_memory_resource host_mr;
+    {
+        traccc::io::output_stream output(filename, 1024);
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < n_threads; ++t) {
+            threads.emplace_back([&, t]() {
+                for (std::size_t event = t; event < n_events;
+                     event += n_threads) {
+                    traccc::seed_collection_types::host seeds(event % 5,
+                                                              &host_mr);
+                    for (traccc::seed& s : seeds) {
+                        s.weight = static_cast<traccc::scalar>(event);
+                        s.z_vertex = -static_cast<traccc::scalar>(event);
+                    }
+                    output.write(event, seeds);
+                    traccc::bound_track_parameters_collection_types::host
+                        params(event % 3, &host_mr);
+                    output.write(event, params);
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+    // Read the file back.
+    std::ifstream in(filename, std::ios::binary);
+    ASSERT_TRUE(in.good());
+    std::size_t n_seed_records = 0, n_param_records = 0;
+    traccc::io::output_record_header header;
+    while (in.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+
+        ASSERT_EQ(header.magic, traccc::io::output_record_magic);
+        ASSERT_LT(header.event, n_events);
+        ASSERT_EQ(header.size, header.n_items * header.item_size);
+
+        if (header.type == traccc::io::output_record_type::seeds) {
+            ++n_seed_records;
+            ASSERT_EQ(header.n_items, header.event % 5);
+            ASSERT_EQ(header.item_size, sizeof(traccc::seed));
+            std::vector<traccc::seed> seeds(header.n_items);
+            in.read(reinterpret_cast<char*>(seeds.data()), header.size);
+            for (const traccc::seed& s : seeds) {
+                EXPECT_EQ(s.weight, static_cast<traccc::scalar>(header.event));
+                EXPECT_EQ(s.z_vertex,
+                          -static_cast<traccc::scalar>(header.event));
+            }
+        } else {
+            ++n_param_records;
+            ASSERT_EQ(header.type,
+                      traccc::io::output_record_type::track_parameters);
+            ASSERT_EQ(header.n_items, header.event % 3);
+            ASSERT_EQ(header.item_size,
+                      sizeof(traccc::bound_track_parameters));
+            in.seekg(static_cast<std::streamoff>(header.size), std::ios::cur);
+        }
+    }
+    EXPECT_EQ(n_seed_records, n_events);
+    EXPECT_EQ(n_param_records, n_events);
+
+    in.close();
+    std::remove(filename.c_str());
+}